@@ -0,0 +1,66 @@
+#include <ciso646>
+#include <iostream>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the textbook transformation, one coordinate pair at a time
+template <typename Points>
+void transform_loop(Points& points, const affine_matrix& m)
+{
+    for (auto& p : points)
+    {
+        double x = p.x;
+        double y = p.y;
+        p.x      = m.a * x + m.b * y + m.xoff;
+        p.y      = m.d * x + m.e * y + m.yoff;
+    }
+}
+
+}  // namespace
+
+// usage: bench_affine [num_points] [ring_size]
+int main(int argc, char** argv)
+{
+    size_t num_points = bench::arg(argc, argv, 1, 1000000);
+    size_t ring_size  = bench::arg(argc, argv, 2, 64);
+
+    auto mp    = bench::random_points(num_points, bounds_t{0, 0, 1000, 1000});
+    auto line  = LineString(mp.begin(), mp.end());
+    auto total = static_cast<double>(num_points);
+    std::cout << num_points << " points, " << simd::width << " lanes\n";
+
+    // a viewport transformation, the y-axis pointing down
+    auto viewport = affine_matrix::translation(960, 540) * affine_matrix::scaling(2.5, -2.5) *
+                    affine_matrix::rotation(15, 500, 500);
+
+    auto baseline = bench::measure([&] { transform_loop(line, viewport); });
+    bench::report("scalar loop", baseline, total);
+    auto batch = bench::measure([&] { affine_transform(line, viewport); });
+    bench::report("affine_transform", batch, total);
+
+    MultiPolygon polygons;
+    for (size_t i = 0; i < num_points / ring_size; ++i)
+    {
+        polygons.push_back(bench::regular_polygon(static_cast<double>(i % 1000), static_cast<double>(i / 1000), 0.4, ring_size - 1));
+    }
+    auto nested = bench::measure([&] { affine_transform(polygons, viewport); });
+    bench::report("affine_transform multipolygon, per polygon", nested, static_cast<double>(polygons.size()));
+
+    LineStringZ line_z;
+    for (const auto& p : mp)
+    {
+        line_z.push_back({p.x, p.y, p.x - p.y});
+    }
+    auto with_z = bench::measure([&] { affine_transform(line_z, viewport); });
+    bench::report("affine_transform z", with_z, total);
+    bench::do_not_optimize(line);
+    bench::do_not_optimize(polygons);
+    bench::do_not_optimize(line_z);
+
+    bench::report_speedup("affine_transform vs scalar loop", baseline, batch);
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_cell_index [num_points] [num_queries] [level]
+int main(int argc, char** argv)
+{
+    size_t num_points  = bench::arg(argc, argv, 1, 1000000);
+    size_t num_queries = bench::arg(argc, argv, 2, 200000);
+    auto level         = static_cast<uint32_t>(bench::arg(argc, argv, 3, 14));
+
+    // uniformly dense points over a region, queried with windows of a few points
+    auto region = bounds_t{-10, 40, 10, 60};
+    auto points = bench::random_points(num_points, region);
+    std::vector<bounds_t> boxes;
+    boxes.reserve(num_points);
+    for (const auto& p : points)
+    {
+        boxes.push_back(bounds_t{p.x, p.y, p.x, p.y});
+    }
+    auto centers = bench::random_points(num_queries, region, 7);
+    double size  = 0.01;
+    std::cout << num_points << " points, " << num_queries << " window queries, level " << level << "\n";
+
+    strtree tree;
+    auto tree_build = bench::measure([&] { tree = strtree(boxes.begin(), boxes.end()); });
+    bench::report("strtree build", tree_build, static_cast<double>(num_points));
+
+    cell_index index;
+    auto index_build = bench::measure([&] { index = cell_index(boxes.begin(), boxes.end(), level); });
+    bench::report("cell_index build", index_build, static_cast<double>(num_points));
+    std::cout << index.num_cells() << " cells\n";
+
+    size_t found      = 0;
+    auto tree_queries = bench::measure([&] {
+        found = 0;
+        for (const auto& c : centers)
+        {
+            tree.query(bounds_t{c.x, c.y, c.x + size, c.y + size}, [&](size_t) { ++found; });
+        }
+    });
+    bench::report("strtree window queries", tree_queries, static_cast<double>(num_queries));
+    std::cout << found << " points found\n";
+
+    auto index_queries = bench::measure([&] {
+        found = 0;
+        for (const auto& c : centers)
+        {
+            index.query(bounds_t{c.x, c.y, c.x + size, c.y + size}, [&](size_t) { ++found; });
+        }
+    });
+    bench::report("cell_index window queries", index_queries, static_cast<double>(num_queries));
+    std::cout << found << " points found\n";
+
+    // polygon covers, from a coarse interior to fine boundary cells
+    auto polygon = bench::regular_polygon(0, 50, 8, 1024);
+    std::vector<quadkey::cell> interior;
+    std::vector<quadkey::cell> boundary;
+    auto covered = bench::measure([&] { quadkey::cover(polygon, 4, level, interior, boundary); });
+    bench::report("quadkey cover", covered, static_cast<double>(interior.size() + boundary.size()));
+    std::cout << interior.size() << " interior cells, " << boundary.size() << " boundary cells\n";
+    bench::do_not_optimize(found);
+
+    bench::report_speedup("window queries, cell_index vs strtree", tree_queries, index_queries);
+    return 0;
+}
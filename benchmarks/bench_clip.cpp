@@ -0,0 +1,91 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the tiles of a grid covering [-1, 1] x [-1, 1]
+std::vector<bounds_t> tiles(size_t k)
+{
+    std::vector<bounds_t> res;
+    double size = 2.0 / static_cast<double>(k);
+    for (size_t i = 0; i < k; ++i)
+    {
+        for (size_t j = 0; j < k; ++j)
+        {
+            double x = -1 + size * static_cast<double>(i);
+            double y = -1 + size * static_cast<double>(j);
+            res.emplace_back(x, y, x + size, y + size);
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+// usage: bench_clip [num_vertices] [tiles_per_side]
+int main(int argc, char** argv)
+{
+    size_t num_vertices = bench::arg(argc, argv, 1, 100000);
+    size_t k            = bench::arg(argc, argv, 2, 32);
+
+    auto grid    = tiles(k);
+    auto polygon = bench::regular_polygon(0, 0, 0.99, num_vertices);
+    auto ring    = bench::regular_ring(0, 0, 0.99, num_vertices);
+    auto line    = LineString(ring.begin(), ring.end());
+    auto total   = static_cast<double>(num_vertices * grid.size());
+    std::cout << num_vertices << " vertices, " << grid.size() << " tiles\n";
+
+    size_t parts   = 0;
+    auto line_once = bench::measure([&] {
+        parts = 0;
+        for (const auto& tile : grid)
+        {
+            parts += clip(line, tile).size();
+        }
+    });
+    bench::report("linestring new result per tile", line_once, total);
+
+    MultiLineString line_parts;
+    auto line_reused = bench::measure([&] {
+        parts = 0;
+        for (const auto& tile : grid)
+        {
+            clip(line, tile, line_parts);
+            parts += line_parts.size();
+        }
+    });
+    bench::report("linestring reused result", line_reused, total);
+    bench::do_not_optimize(parts);
+
+    auto polygon_once = bench::measure([&] {
+        parts = 0;
+        for (const auto& tile : grid)
+        {
+            parts += clip(polygon, tile).size();
+        }
+    });
+    bench::report("polygon new result per tile", polygon_once, total);
+
+    Polygon clipped;
+    clip_buffers<Point> buffers;
+    auto polygon_reused = bench::measure([&] {
+        parts = 0;
+        for (const auto& tile : grid)
+        {
+            clip(polygon, tile, clipped, buffers);
+            parts += clipped.size();
+        }
+    });
+    bench::report("polygon reused buffers", polygon_reused, total);
+    bench::do_not_optimize(parts);
+    std::cout << parts << " rings in the tiles\n";
+
+    bench::report_speedup("linestring reused vs new", line_once, line_reused);
+    bench::report_speedup("polygon reused vs new", polygon_once, polygon_reused);
+    return 0;
+}
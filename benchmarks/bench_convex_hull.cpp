@@ -0,0 +1,72 @@
+#include <ciso646>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the textbook monotone chain, sorting every point
+Polygon sort_based_hull(const MultiPoint& points)
+{
+    std::vector<Point> sorted(points.begin(), points.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Point& a, const Point& b) { return a.x < b.x or (a.x == b.x and a.y < b.y); });
+    auto turn = [](const Point& a, const Point& b, const Point& c) {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    };
+    size_t n = sorted.size();
+    std::vector<Point> res(2 * n);
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        while (k >= 2 and turn(res[k - 2], res[k - 1], sorted[i]) <= 0)
+        {
+            --k;
+        }
+        res[k++] = sorted[i];
+    }
+    for (size_t i = n - 1, lower = k + 1; i > 0; --i)
+    {
+        while (k >= lower and turn(res[k - 2], res[k - 1], sorted[i - 1]) <= 0)
+        {
+            --k;
+        }
+        res[k++] = sorted[i - 1];
+    }
+    res.resize(k);
+    return Polygon{LinearRing(res.begin(), res.end())};
+}
+
+}  // namespace
+
+// usage: bench_convex_hull [num_points] [num_threads]
+int main(int argc, char** argv)
+{
+    size_t num_points  = bench::arg(argc, argv, 1, 10000000);
+    size_t num_threads = bench::arg(argc, argv, 2, 0);
+
+    auto points = bench::random_points(num_points, bounds_t{-1, -1, 1, 1});
+    thread_pool pool(num_threads);
+    std::cout << num_points << " points, " << pool.size() << " threads\n";
+
+    Polygon res;
+    auto sorted = bench::measure([&] { res = sort_based_hull(points); });
+    bench::report("sort every point", sorted, static_cast<double>(num_points));
+    size_t expected = res[0].size();
+
+    auto serial = bench::measure([&] { res = convex_hull(points); });
+    bench::report("convex_hull", serial, static_cast<double>(num_points));
+
+    auto parallel = bench::measure([&] { res = convex_hull(points, pool); });
+    bench::report("convex_hull parallel", parallel, static_cast<double>(num_points));
+    bench::do_not_optimize(res);
+    std::cout << res[0].size() << " hull vertices, " << expected << " without the prefilter\n";
+
+    bench::report_speedup("convex_hull vs sort every point", sorted, serial);
+    bench::report_speedup("parallel vs convex_hull", serial, parallel);
+    return 0;
+}
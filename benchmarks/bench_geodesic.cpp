@@ -0,0 +1,58 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_geodesic [num_points]
+int main(int argc, char** argv)
+{
+    size_t num_points = bench::arg(argc, argv, 1, 1000000);
+
+    auto points = bench::random_points(num_points, bounds_t{-180, -85, 180, 85});
+    auto origin = Point(-73.9857, 40.7484);
+    std::vector<double> lngs;
+    std::vector<double> lats;
+    for (const auto& p : points)
+    {
+        lngs.push_back(p.lng);
+        lats.push_back(p.lat);
+    }
+
+    std::cout << num_points << " points, " << simd::width << " doubles per batch\n";
+
+    std::vector<double> res(num_points);
+    auto scalar = bench::measure([&] {
+        for (size_t i = 0; i < num_points; ++i)
+        {
+            res[i] = geodesic::haversine(origin.lng, origin.lat, lngs[i], lats[i]);
+        }
+    });
+    bench::report("haversine loop", scalar, static_cast<double>(num_points));
+
+    auto batch = bench::measure([&] { geodesic::distances(origin.lng, origin.lat, lngs.data(), lats.data(), num_points, res.data()); });
+    bench::report("distances arrays", batch, static_cast<double>(num_points));
+
+    auto multipoint = bench::measure([&] { res = geodesic::distances(origin, points); });
+    bench::report("distances multipoint", multipoint, static_cast<double>(num_points));
+
+    size_t sample = std::min<size_t>(num_points, 100000);
+    auto vincenty = bench::measure([&] {
+        for (size_t i = 0; i < sample; ++i)
+        {
+            res[i] = geodesic::vincenty(origin.lng, origin.lat, lngs[i], lats[i]);
+        }
+    });
+    bench::report("vincenty loop", vincenty, static_cast<double>(sample));
+
+    LineString track(points.begin(), points.end());
+    double length = 0;
+    auto lineal   = bench::measure([&] { length = geodesic::length(track); });
+    bench::report("length haversine", lineal, static_cast<double>(num_points));
+    bench::do_not_optimize(length);
+    bench::do_not_optimize(res);
+
+    bench::report_speedup("batch vs haversine loop", scalar, batch);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <ciso646>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the textbook encoder, bisecting the longitude and latitude ranges one bit at a time
+uint64_t bisect(double lng, double lat, size_t bits)
+{
+    double lng_min = -180;
+    double lng_max = 180;
+    double lat_min = -90;
+    double lat_max = 90;
+    uint64_t res   = 0;
+    for (size_t i = 0; i < bits; ++i)
+    {
+        res <<= 1;
+        if (i % 2 == 0)
+        {
+            double mid = (lng_min + lng_max) / 2;
+            if (lng >= mid)
+            {
+                res |= 1;
+                lng_min = mid;
+            }
+            else
+            {
+                lng_max = mid;
+            }
+        }
+        else
+        {
+            double mid = (lat_min + lat_max) / 2;
+            if (lat >= mid)
+            {
+                res |= 1;
+                lat_min = mid;
+            }
+            else
+            {
+                lat_max = mid;
+            }
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+// usage: bench_geohash [num_points] [precision]
+int main(int argc, char** argv)
+{
+    size_t num_points = bench::arg(argc, argv, 1, 1000000);
+    size_t precision  = bench::arg(argc, argv, 2, 9);
+
+    auto points = bench::random_points(num_points, bounds_t{-180, -90, 180, 90});
+    auto total  = static_cast<double>(num_points);
+#if defined(SIMO_SHAPES_BMI2)
+    std::cout << num_points << " points, precision " << precision << ", PDEP / PEXT\n";
+#else
+    std::cout << num_points << " points, precision " << precision << ", lookup tables\n";
+#endif
+
+    std::vector<uint64_t> codes(num_points);
+    auto baseline = bench::measure([&] {
+        for (size_t i = 0; i < num_points; ++i)
+        {
+            codes[i] = bisect(points[i].x, points[i].y, precision * geohash::CHAR_BITS);
+        }
+    });
+    bench::report("bisection", baseline, total);
+    auto expected = codes;
+
+    auto batch = bench::measure([&] { geohash::encode(points, precision, codes); });
+    bench::report("encode batch", batch, total);
+    std::cout << (codes == expected ? "same" : "different") << " geohashes\n";
+
+    std::vector<std::string> hashes;
+    auto strings = bench::measure([&] { geohash::encode(points, precision, hashes); });
+    bench::report("encode batch strings", strings, total);
+
+    size_t size = 0;
+    auto single = bench::measure([&] {
+        size = 0;
+        for (const auto& p : points)
+        {
+            size += geohash::encode(p, precision).size();
+        }
+    });
+    bench::report("encode one by one", single, total);
+
+    double area = 0;
+    auto decode = bench::measure([&] {
+        area = 0;
+        for (auto code : codes)
+        {
+            auto b = geohash::decode_int(code, precision);
+            area += b.minx + b.miny;
+        }
+    });
+    bench::report("decode", decode, total);
+
+    auto polygon = bench::regular_polygon(10, 50, 5, 1024);
+    std::vector<uint64_t> cells;
+    auto covered = bench::measure([&] { geohash::cover(polygon, 6, cells); });
+    bench::report("cover precision 6", covered, static_cast<double>(cells.size()));
+    std::cout << cells.size() << " cells\n";
+    bench::do_not_optimize(size);
+    bench::do_not_optimize(area);
+
+    bench::report_speedup("encode batch vs bisection", baseline, batch);
+    bench::report_speedup("encode batch vs one by one", single, batch);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the point at a time construction
+LineString emplace_loop(const std::vector<double>& coords)
+{
+    LineString res;
+    res.reserve(coords.size() / 2);
+    for (size_t i = 0; i < coords.size(); i += 2)
+    {
+        res.emplace_back(coords.begin() + static_cast<std::ptrdiff_t>(i), coords.begin() + static_cast<std::ptrdiff_t>(i + 2));
+    }
+    return res;
+}
+
+}  // namespace
+
+// usage: bench_linestring [num_points]
+int main(int argc, char** argv)
+{
+    size_t num_points = bench::arg(argc, argv, 1, 1000000);
+
+    auto mp    = bench::random_points(num_points, bounds_t{0, 0, 1000, 1000});
+    auto total = static_cast<double>(num_points);
+    std::vector<double> coords;
+    std::vector<float> floats;
+    coords.reserve(2 * num_points);
+    for (const auto& p : mp)
+    {
+        coords.push_back(p.x);
+        coords.push_back(p.y);
+        floats.push_back(static_cast<float>(p.x));
+        floats.push_back(static_cast<float>(p.y));
+    }
+    std::cout << num_points << " points\n";
+
+    auto baseline = bench::measure([&] {
+        auto ls = emplace_loop(coords);
+        bench::do_not_optimize(ls);
+    });
+    bench::report("emplace loop", baseline, total);
+    auto from_iterators = bench::measure([&] {
+        LineString ls(coords.begin(), coords.end());
+        bench::do_not_optimize(ls);
+    });
+    bench::report("constructor from iterators", from_iterators, total);
+    auto from_array = bench::measure([&] {
+        LineString ls(coords.data(), coords.size());
+        bench::do_not_optimize(ls);
+    });
+    bench::report("constructor from array", from_array, total);
+
+    // the storage is reused
+    LineString ls;
+    auto assign = bench::measure([&] { ls.assign(coords.data(), coords.size()); });
+    bench::report("assign", assign, total);
+    bench::do_not_optimize(ls);
+
+    auto converted = bench::measure([&] {
+        LineString ls(floats.begin(), floats.end());
+        bench::do_not_optimize(ls);
+    });
+    bench::report("constructor from floats", converted, total);
+
+    bench::report_speedup("constructor from array vs emplace loop", baseline, from_array);
+    bench::report_speedup("assign vs emplace loop", baseline, assign);
+    return 0;
+}
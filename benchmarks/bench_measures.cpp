@@ -0,0 +1,60 @@
+#include <ciso646>
+#include <cmath>
+#include <iostream>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_measures [num_vertices]
+int main(int argc, char** argv)
+{
+    size_t num_vertices = bench::arg(argc, argv, 1, 1000000);
+
+    // a large ring far from the origin, where the naive shoelace cancels badly
+    auto ring    = bench::regular_ring(5e6, 5e6, 1000, num_vertices);
+    auto polygon = Polygon{ring};
+    auto line    = LineString(ring.begin(), ring.end());
+
+    std::cout << num_vertices << " vertices, " << simd::width << " doubles per batch\n";
+
+    double naive_area = 0;
+    auto naive        = bench::measure([&] {
+        double sum = 0;
+        for (size_t i = 0; i + 1 < ring.size(); ++i)
+        {
+            sum += ring[i].x * ring[i + 1].y - ring[i + 1].x * ring[i].y;
+        }
+        naive_area = std::abs(sum) / 2;
+    }, 10);
+    bench::report("naive shoelace loop", naive, static_cast<double>(num_vertices));
+
+    double res = 0;
+    auto fast  = bench::measure([&] { res = area(polygon); }, 10);
+    bench::report("area", fast, static_cast<double>(num_vertices));
+    std::printf("%-40s %.12g vs %.12g\n", "naive vs compensated", naive_area, res);
+
+    double naive_length = 0;
+    auto naive_len      = bench::measure([&] {
+        double sum = 0;
+        for (size_t i = 0; i + 1 < line.size(); ++i)
+        {
+            sum += std::hypot(line[i + 1].x - line[i].x, line[i + 1].y - line[i].y);
+        }
+        naive_length = sum;
+    }, 10);
+    bench::report("naive length loop", naive_len, static_cast<double>(num_vertices));
+
+    auto fast_len = bench::measure([&] { res = length(line); }, 10);
+    bench::report("length", fast_len, static_cast<double>(num_vertices));
+
+    basic_point<double> c;
+    auto cen = bench::measure([&] { c = centroid(polygon); }, 10);
+    bench::report("centroid", cen, static_cast<double>(num_vertices));
+    bench::do_not_optimize(c);
+    bench::do_not_optimize(res);
+    bench::do_not_optimize(naive_length);
+
+    bench::report_speedup("area vs naive loop", naive, fast);
+    bench::report_speedup("length vs naive loop", naive_len, fast_len);
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <ciso646>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_mvt [num_features] [vertices_per_feature]
+int main(int argc, char** argv)
+{
+    size_t num_features = bench::arg(argc, argv, 1, 100000);
+    size_t num_vertices = bench::arg(argc, argv, 2, 64);
+
+    // the features of a tile covering [0, 1] x [0, 1]
+    auto bounds = bounds_t{0, 0, 1, 1};
+    auto side   = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(num_features))));
+    auto cell   = 1.0 / static_cast<double>(side);
+    std::vector<Polygon> polygons;
+    std::vector<LineString> linestrings;
+    for (size_t i = 0; i < num_features; ++i)
+    {
+        double cx = (static_cast<double>(i % side) + 0.5) * cell;
+        double cy = (static_cast<double>(i / side) + 0.5) * cell;
+        polygons.push_back(Polygon{bench::regular_ring(cx, cy, cell / 2, num_vertices)});
+        const auto& ring = polygons.back()[0];
+        linestrings.emplace_back(ring.begin(), ring.begin() + static_cast<std::ptrdiff_t>(num_vertices / 2));
+    }
+    mvt::properties props = {{"kind", "building"}, {"height", 12}};
+    auto total            = static_cast<double>(num_features);
+    std::cout << num_features << " features, " << num_vertices << " vertices each\n";
+
+    size_t bytes = 0;
+    auto json    = bench::measure([&] {
+        bytes = 0;
+        for (const auto& polygon : polygons)
+        {
+            bytes += polygon.json().size();
+        }
+    });
+    bench::report("polygons geojson", json, total);
+
+    auto polygon_tile = bench::measure([&] {
+        mvt::layer_encoder layer("buildings", bounds);
+        for (const auto& polygon : polygons)
+        {
+            layer.add_feature(polygon, props);
+        }
+        bytes = layer.serialize().size();
+    });
+    bench::report("polygons mvt", polygon_tile, total);
+    std::cout << bytes << " bytes\n";
+
+    auto linestring_json = bench::measure([&] {
+        bytes = 0;
+        for (const auto& linestring : linestrings)
+        {
+            bytes += linestring.json().size();
+        }
+    });
+    bench::report("linestrings geojson", linestring_json, total);
+
+    auto linestring_tile = bench::measure([&] {
+        mvt::layer_encoder layer("roads", bounds);
+        for (const auto& linestring : linestrings)
+        {
+            layer.add_feature(linestring, props);
+        }
+        bytes = layer.serialize().size();
+    });
+    bench::report("linestrings mvt", linestring_tile, total);
+    bench::do_not_optimize(bytes);
+    std::cout << bytes << " bytes\n";
+
+    mvt::layer_encoder encoder("buildings", bounds);
+    for (const auto& polygon : polygons)
+    {
+        encoder.add_feature(polygon, props);
+    }
+    auto tile = encoder.serialize();
+
+    size_t vertices = 0;
+    auto decoded    = bench::measure([&] {
+        vertices = 0;
+        MultiPolygon mp;
+        for (const auto& layer : mvt::read_layers(tile))
+        {
+            for (size_t i = 0; i < layer.size(); ++i)
+            {
+                layer[i].polygons(mp, bounds);
+                vertices += mp.empty() ? 0 : mp[0][0].size();
+            }
+        }
+    });
+    bench::report("polygons decode", decoded, total);
+
+    double extent  = 0;
+    auto inspected = bench::measure([&] {
+        extent = 0;
+        for (const auto& layer : mvt::read_layers(tile))
+        {
+            auto b = layer.bounds();
+            extent += b.maxx - b.minx;
+        }
+    });
+    bench::report("polygons decode bounds only", inspected, total);
+    bench::do_not_optimize(vertices);
+    bench::do_not_optimize(extent);
+
+    bench::report_speedup("polygons mvt vs geojson", json, polygon_tile);
+    bench::report_speedup("linestrings mvt vs geojson", linestring_json, linestring_tile);
+    bench::report_speedup("bounds only vs decode", decoded, inspected);
+    return 0;
+}
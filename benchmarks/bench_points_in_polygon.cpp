@@ -0,0 +1,55 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_points_in_polygon [num_points] [num_vertices]
+int main(int argc, char** argv)
+{
+    size_t num_points   = bench::arg(argc, argv, 1, 1000000);
+    size_t num_vertices = bench::arg(argc, argv, 2, 64);
+
+    auto polygon = bench::regular_polygon(0, 0, 1, num_vertices);
+    auto points  = bench::random_points(num_points, bounds_t{-1, -1, 1, 1});
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (const auto& p : points)
+    {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+
+    std::cout << num_points << " points, " << num_vertices << " vertices in the shell, " << simd::width
+              << " doubles per batch\n";
+
+    std::vector<uint8_t> res(num_points);
+    auto scalar = bench::measure([&] {
+        for (size_t i = 0; i < num_points; ++i)
+        {
+            res[i] = point_in_polygon(points[i].x, points[i].y, polygon) ? 1 : 0;
+        }
+    });
+    bench::report("point_in_polygon loop", scalar, static_cast<double>(num_points));
+
+    auto multipoint = bench::measure([&] { res = points_in_polygon(points, polygon); });
+    bench::report("points_in_polygon multipoint", multipoint, static_cast<double>(num_points));
+
+    auto arrays = bench::measure([&] { points_in_polygon(xs.data(), ys.data(), num_points, polygon, res.data()); });
+    bench::report("points_in_polygon arrays", arrays, static_cast<double>(num_points));
+    bench::do_not_optimize(res);
+
+    prepared_polygon prepared(polygon);
+    auto indexed = bench::measure([&] {
+        for (size_t i = 0; i < num_points; ++i)
+        {
+            res[i] = prepared.intersects(points[i].x, points[i].y) ? 1 : 0;
+        }
+    });
+    bench::report("prepared_polygon loop", indexed, static_cast<double>(num_points));
+    bench::do_not_optimize(res);
+
+    bench::report_speedup("batch vs point_in_polygon loop", scalar, arrays);
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+constexpr double PI = 3.14159265358979323846;
+
+// the textbook projection, one point at a time with libm
+void web_mercator_libm(LineString& ls)
+{
+    for (auto& p : ls)
+    {
+        double lat = std::min(projection::WEB_MERCATOR_MAX_LATITUDE, std::max(-projection::WEB_MERCATOR_MAX_LATITUDE, p.y));
+        p.x        = projection::WEB_MERCATOR_RADIUS * p.x * PI / 180;
+        p.y        = projection::WEB_MERCATOR_RADIUS * std::log(std::tan(PI / 4 + lat * PI / 360));
+    }
+}
+
+// the same Krüger series, one point at a time with libm
+void utm_libm(LineString& ls, const detail::utm_parameters& params)
+{
+    for (auto& p : ls)
+    {
+        double lambda = (p.x - params.lng0) * PI / 180;
+        double s      = std::sin(p.y * PI / 180);
+        double tau    = std::sinh(std::atanh(s) - params.e * std::atanh(params.e * s));
+        double xi     = std::atan2(tau, std::cos(lambda));
+        double eta    = std::atanh(std::sin(lambda) / std::sqrt(1 + tau * tau));
+        double x      = eta;
+        double y      = xi;
+        for (size_t j = 0; j < 4; ++j)
+        {
+            double k = 2.0 * static_cast<double>(j + 1);
+            x += params.alpha[j] * std::cos(k * xi) * std::sinh(k * eta);
+            y += params.alpha[j] * std::sin(k * xi) * std::cosh(k * eta);
+        }
+        p.x = params.scale * x + projection::UTM_FALSE_EASTING;
+        p.y = params.scale * y + params.false_northing;
+    }
+}
+
+double max_difference(const LineString& a, const LineString& b)
+{
+    double res = 0;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        res = std::max(res, std::max(std::abs(a[i].x - b[i].x), std::abs(a[i].y - b[i].y)));
+    }
+    return res;
+}
+
+}  // namespace
+
+// usage: bench_projection [num_points]
+int main(int argc, char** argv)
+{
+    size_t num_points = bench::arg(argc, argv, 1, 1000000);
+
+    auto world  = bench::random_points(num_points, bounds_t{-180, -85, 180, 85});
+    auto zone   = bench::random_points(num_points, bounds_t{12, -80, 18, 84}, 7);
+    auto total  = static_cast<double>(num_points);
+    auto coords = LineString(world.begin(), world.end());
+    auto utm    = LineString(zone.begin(), zone.end());
+    std::cout << num_points << " points, " << simd::width << " lanes\n";
+
+    LineString expected;
+    auto mercator_libm = bench::measure([&] {
+        expected = coords;
+        web_mercator_libm(expected);
+    });
+    bench::report("web mercator libm", mercator_libm, total);
+    LineString projected;
+    auto mercator_simd = bench::measure([&] {
+        projected = coords;
+        projection::to_web_mercator(projected);
+    });
+    bench::report("to_web_mercator", mercator_simd, total);
+    std::cout << "max difference " << max_difference(expected, projected) << " m\n";
+    auto mercator_inverse = bench::measure([&] {
+        auto ls = projected;
+        projection::from_web_mercator(ls);
+        bench::do_not_optimize(ls);
+    });
+    bench::report("from_web_mercator", mercator_inverse, total);
+
+    detail::utm_parameters params(33, true);
+    auto utm_baseline = bench::measure([&] {
+        expected = utm;
+        utm_libm(expected, params);
+    });
+    bench::report("utm libm", utm_baseline, total);
+    auto utm_simd = bench::measure([&] {
+        projected = utm;
+        projection::to_utm(projected, 33);
+    });
+    bench::report("to_utm", utm_simd, total);
+    std::cout << "max difference " << max_difference(expected, projected) << " m\n";
+    auto utm_inverse = bench::measure([&] {
+        auto ls = projected;
+        projection::from_utm(ls, 33);
+        bench::do_not_optimize(ls);
+    });
+    bench::report("from_utm", utm_inverse, total);
+
+    bench::report_speedup("web mercator vs libm", mercator_libm, mercator_simd);
+    bench::report_speedup("utm vs libm", utm_baseline, utm_simd);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <ciso646>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// a wobbly edge between two grid nodes, shared by the cells on both sides
+std::vector<Point> edge(double x1, double y1, double x2, double y2, size_t n)
+{
+    std::vector<Point> res;
+    for (size_t k = 0; k <= n; ++k)
+    {
+        double t      = static_cast<double>(k) / static_cast<double>(n);
+        double wobble = k == 0 or k == n ? 0 : 0.02 * std::sin(t * 37 + x1 * 3 + y1 * 5);
+        res.emplace_back(x1 + t * (x2 - x1) + wobble * (y2 - y1), y1 + t * (y2 - y1) - wobble * (x2 - x1));
+    }
+    return res;
+}
+
+void append(LinearRing& ring, const std::vector<Point>& points, bool reversed)
+{
+    if (reversed)
+    {
+        ring.insert(ring.end(), points.rbegin() + (ring.empty() ? 0 : 1), points.rend());
+    }
+    else
+    {
+        ring.insert(ring.end(), points.begin() + (ring.empty() ? 0 : 1), points.end());
+    }
+}
+
+}  // namespace
+
+// usage: bench_simplify_coverage [grid_size] [vertices_per_edge]
+int main(int argc, char** argv)
+{
+    size_t grid_size = bench::arg(argc, argv, 1, 100);
+    size_t n         = bench::arg(argc, argv, 2, 200);
+
+    // a grid of cells, the neighbors share their wobbly borders vertex by vertex
+    std::vector<std::vector<std::vector<Point>>> horizontal(grid_size + 1, std::vector<std::vector<Point>>(grid_size));
+    std::vector<std::vector<std::vector<Point>>> vertical(grid_size, std::vector<std::vector<Point>>(grid_size + 1));
+    for (size_t i = 0; i <= grid_size; ++i)
+    {
+        for (size_t j = 0; j < grid_size; ++j)
+        {
+            auto y           = static_cast<double>(i);
+            auto x           = static_cast<double>(j);
+            horizontal[i][j] = edge(x, y, x + 1, y, n);
+            vertical[j][i]   = edge(y, x, y, x + 1, n);
+        }
+    }
+    std::vector<Polygon> cells;
+    for (size_t i = 0; i < grid_size; ++i)
+    {
+        for (size_t j = 0; j < grid_size; ++j)
+        {
+            LinearRing ring;
+            append(ring, horizontal[i][j], false);
+            append(ring, vertical[i][j + 1], false);
+            append(ring, horizontal[i + 1][j], true);
+            append(ring, vertical[i][j], true);
+            cells.push_back(Polygon{ring});
+        }
+    }
+    std::cout << cells.size() << " cells, " << 4 * n << " vertices per cell\n";
+
+    auto independent = bench::measure([&] {
+        auto copy = cells;
+        for (auto& cell : copy)
+        {
+            simplify(cell, 0.01);
+        }
+        bench::do_not_optimize(copy);
+    });
+    bench::report("simplify each polygon", independent, static_cast<double>(cells.size()));
+
+    size_t arcs = 0;
+    auto shared = bench::measure([&] {
+        auto copy = cells;
+        arcs      = simplify_coverage(copy, 0.01);
+        bench::do_not_optimize(copy);
+    });
+    bench::report("simplify_coverage", shared, static_cast<double>(cells.size()));
+    std::cout << arcs << " arcs for " << 4 * cells.size() << " cell edges\n";
+
+    auto copy_only = bench::measure([&] {
+        auto copy = cells;
+        bench::do_not_optimize(copy);
+    });
+    bench::report("copy of the input", copy_only, static_cast<double>(cells.size()));
+    bench::report_speedup("coverage vs each polygon", independent, shared);
+    return 0;
+}
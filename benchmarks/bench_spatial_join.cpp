@@ -0,0 +1,68 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_spatial_join [num_points] [grid_size] [num_vertices]
+int main(int argc, char** argv)
+{
+    size_t num_points   = bench::arg(argc, argv, 1, 1000000);
+    size_t grid_size    = bench::arg(argc, argv, 2, 100);
+    size_t num_vertices = bench::arg(argc, argv, 3, 64);
+
+    // a grid of multipolygons, each one made of two wobbly polygons with holes
+    std::vector<MultiPolygon> zones;
+    zones.reserve(grid_size * grid_size);
+    for (size_t i = 0; i < grid_size; ++i)
+    {
+        for (size_t j = 0; j < grid_size; ++j)
+        {
+            double cx = static_cast<double>(i) + 0.5;
+            double cy = static_cast<double>(j) + 0.5;
+            zones.push_back(MultiPolygon{bench::regular_polygon(cx - 0.2, cy, 0.25, num_vertices),
+                                         bench::regular_polygon(cx + 0.25, cy, 0.2, num_vertices)});
+        }
+    }
+    auto extent = static_cast<double>(grid_size);
+    auto mp     = bench::random_points(num_points, bounds_t{0, 0, extent, extent});
+    std::vector<Point> points(mp.begin(), mp.end());
+
+    std::cout << num_points << " points, " << zones.size() << " multipolygons, " << num_vertices << " vertices per ring\n";
+
+    // brute force over a sample, extrapolated to the whole input
+    size_t sample = std::min<size_t>(num_points, 2000);
+    size_t found  = 0;
+    auto naive    = bench::measure([&] {
+        for (size_t i = 0; i < sample; ++i)
+        {
+            for (const auto& zone : zones)
+            {
+                found += intersects(points[i], zone) ? 1 : 0;
+            }
+        }
+    }, 1);
+    bench::do_not_optimize(found);
+    naive *= static_cast<double>(num_points) / static_cast<double>(sample);
+    bench::report("nested loop (extrapolated)", naive, static_cast<double>(num_points));
+
+    spatial_join_options options;
+    std::vector<std::pair<size_t, size_t>> pairs;
+    options.num_threads = 1;
+    auto serial         = bench::measure([&] { pairs = spatial_join(points, zones, spatial_predicate::WITHIN, options); });
+    bench::report("spatial_join within, 1 thread", serial, static_cast<double>(num_points));
+
+    options.num_threads = 0;
+    auto parallel       = bench::measure([&] { pairs = spatial_join(points, zones, spatial_predicate::WITHIN, options); });
+    bench::report("spatial_join within, " + std::to_string(thread_pool::default_concurrency()) + " threads", parallel,
+                  static_cast<double>(num_points));
+
+    options.distance = 0.05;
+    auto dwithin     = bench::measure([&] { pairs = spatial_join(points, zones, spatial_predicate::DWITHIN, options); }, 1);
+    bench::report("spatial_join dwithin, all threads", dwithin, static_cast<double>(num_points));
+
+    bench::report_speedup("index vs nested loop", naive, serial);
+    bench::report_speedup("threads vs 1 thread", serial, parallel);
+    return 0;
+}
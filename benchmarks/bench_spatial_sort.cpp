@@ -0,0 +1,99 @@
+#include <ciso646>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+// usage: bench_spatial_sort [num_points] [grid_size] [num_threads]
+int main(int argc, char** argv)
+{
+    size_t num_points  = bench::arg(argc, argv, 1, 1000000);
+    size_t grid_size   = bench::arg(argc, argv, 2, 100);
+    size_t num_threads = bench::arg(argc, argv, 3, 0);
+
+    auto extent = static_cast<double>(grid_size);
+    auto world  = bounds_t{0, 0, extent, extent};
+    auto mp     = bench::random_points(num_points, world);
+    std::vector<Point> points(mp.begin(), mp.end());
+    std::vector<Polygon> zones;
+    for (size_t i = 0; i < grid_size * grid_size; ++i)
+    {
+        double cx = static_cast<double>(i % grid_size) + 0.5;
+        double cy = static_cast<double>(i / grid_size) + 0.5;
+        zones.push_back(bench::regular_polygon(cx, cy, 0.45, 64));
+    }
+    std::shuffle(zones.begin(), zones.end(), std::mt19937(42));
+
+    thread_pool pool(num_threads);
+    auto total = static_cast<double>(num_points);
+    std::cout << num_points << " points, " << zones.size() << " polygons, " << pool.size() << " threads\n";
+
+    std::vector<uint64_t> keys;
+    auto morton = bench::measure([&] { morton_keys(mp, world, keys); });
+    bench::report("morton_keys", morton, total);
+    auto hilbert = bench::measure([&] { hilbert_keys(mp, world, keys); });
+    bench::report("hilbert_keys", hilbert, total);
+
+    auto sorted_points = points;
+    auto serial        = bench::measure([&] {
+        sorted_points = points;
+        spatial_sort(sorted_points.begin(), sorted_points.end());
+    }, 1);
+    bench::report("spatial_sort points 1 thread", serial, total);
+    auto parallel = bench::measure([&] {
+        sorted_points = points;
+        spatial_sort(sorted_points.begin(), sorted_points.end(), pool);
+    }, 1);
+    bench::report("spatial_sort points", parallel, total);
+
+    auto sorted_zones = zones;
+    spatial_sort(sorted_zones.begin(), sorted_zones.end(), pool);
+
+    // the index build reads the bounds of every polygon, then the queries visit the polygons
+    size_t found = 0;
+    auto index   = [&](const std::vector<Polygon>& polygons) {
+        return bench::measure([&] {
+            std::vector<bounds_t> boxes;
+            boxes.reserve(polygons.size());
+            for (const auto& polygon : polygons)
+            {
+                boxes.push_back(polygon.bounds());
+            }
+            strtree tree(boxes.begin(), boxes.end());
+            found = 0;
+            for (size_t i = 0; i < num_points; i += 16)
+            {
+                tree.query(bounds_t{points[i].x, points[i].y, points[i].x, points[i].y}, [&](size_t j) {
+                    found += polygons[j].size();
+                });
+            }
+        });
+    };
+    auto index_random = index(zones);
+    bench::report("index build and query, insertion order", index_random, static_cast<double>(zones.size()));
+    auto index_sorted = index(sorted_zones);
+    bench::report("index build and query, hilbert order", index_sorted, static_cast<double>(zones.size()));
+
+    spatial_join_options options;
+    options.num_threads = 1;
+    size_t pairs        = 0;
+    auto join_random    = bench::measure([&] {
+        pairs = spatial_join(points, zones, spatial_predicate::WITHIN, options).size();
+    }, 1);
+    bench::report("spatial_join, insertion order", join_random, total);
+    auto join_sorted = bench::measure([&] {
+        pairs = spatial_join(sorted_points, sorted_zones, spatial_predicate::WITHIN, options).size();
+    }, 1);
+    bench::report("spatial_join, hilbert order", join_sorted, total);
+    bench::do_not_optimize(found);
+    bench::do_not_optimize(pairs);
+    std::cout << pairs << " pairs\n";
+
+    bench::report_speedup("spatial_sort vs 1 thread", serial, parallel);
+    bench::report_speedup("index, hilbert vs insertion order", index_random, index_sorted);
+    bench::report_speedup("spatial_join, hilbert vs insertion order", join_random, join_sorted);
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <ciso646>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// builds the pyramid one zoom level at a time, assigning every geometry to the tile range of its bounds
+size_t level_by_level(const std::vector<Polygon>& geoms, const pyramid_options& options, thread_pool& pool)
+{
+    std::atomic<size_t> bytes{0};
+    for (uint32_t z = 0; z <= options.max_zoom; ++z)
+    {
+        uint32_t n  = 1u << z;
+        double size = (options.bounds.maxx - options.bounds.minx) / n;
+        double pad  = size * options.buffer / options.extent;
+        std::vector<std::pair<uint64_t, uint32_t>> pairs;
+        for (size_t i = 0; i < geoms.size(); ++i)
+        {
+            auto b    = geoms[i].bounds();
+            auto col  = [&](double x) { return std::min<double>(n - 1, std::max(0.0, std::floor(x / size))); };
+            auto minx = static_cast<uint32_t>(col(b.minx - pad - options.bounds.minx));
+            auto maxx = static_cast<uint32_t>(col(b.maxx + pad - options.bounds.minx));
+            auto miny = static_cast<uint32_t>(col(options.bounds.maxy - b.maxy - pad));
+            auto maxy = static_cast<uint32_t>(col(options.bounds.maxy - b.miny + pad));
+            for (uint32_t y = miny; y <= maxy; ++y)
+            {
+                for (uint32_t x = minx; x <= maxx; ++x)
+                {
+                    pairs.emplace_back(static_cast<uint64_t>(y) * n + x, static_cast<uint32_t>(i));
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < pairs.size(); ++i)
+        {
+            if (i == 0 or pairs[i].first != pairs[i - 1].first)
+            {
+                starts.push_back(i);
+            }
+        }
+        starts.push_back(pairs.size());
+
+        parallel_for(pool, 0, starts.size() - 1, 16, [&](size_t lo, size_t hi) {
+            Polygon clipped;
+            clip_buffers<Point> buffers;
+            for (size_t t = lo; t < hi; ++t)
+            {
+                auto key    = pairs[starts[t]].first;
+                double minx = options.bounds.minx + size * static_cast<double>(key % n);
+                double maxy = options.bounds.maxy - size * static_cast<double>(key / n);
+                auto tile   = bounds_t{minx, maxy - size, minx + size, maxy};
+                auto padded = bounds_t{tile.minx - pad, tile.miny - pad, tile.maxx + pad, tile.maxy + pad};
+                mvt::layer_encoder layer(options.layer, tile, options.extent);
+                for (size_t i = starts[t]; i < starts[t + 1]; ++i)
+                {
+                    clip(geoms[pairs[i].second], padded, clipped, buffers);
+                    simplify(clipped, options.tolerance * size / options.extent);
+                    layer.add_feature(clipped, {}, pairs[i].second);
+                }
+                if (layer.size() > 0)
+                {
+                    bytes += layer.serialize().size();
+                }
+            }
+        });
+    }
+    return bytes;
+}
+
+}  // namespace
+
+// usage: bench_tile_pyramid [num_polygons] [max_zoom] [num_threads]
+int main(int argc, char** argv)
+{
+    size_t num_polygons = bench::arg(argc, argv, 1, 20000);
+    auto max_zoom       = static_cast<uint32_t>(bench::arg(argc, argv, 2, 8));
+    size_t num_threads  = bench::arg(argc, argv, 3, 0);
+
+    pyramid_options options;
+    options.bounds   = bounds_t{0, 0, 1, 1};
+    options.max_zoom = max_zoom;
+
+    auto centers = bench::random_points(num_polygons, bounds_t{0.01, 0.01, 0.99, 0.99});
+    std::vector<Polygon> geoms;
+    for (const auto& c : centers)
+    {
+        geoms.push_back(Polygon{bench::regular_ring(c.x, c.y, 0.005, 64)});
+    }
+    // a few large polygons spanning many tiles
+    for (size_t i = 0; i < 4; ++i)
+    {
+        geoms.push_back(bench::regular_polygon(0.25 + 0.5 * (i % 2), 0.25 + 0.5 * (i / 2), 0.2, 4096));
+    }
+
+    thread_pool pool(num_threads);
+    thread_pool single(1);
+    std::cout << geoms.size() << " polygons, zoom 0 to " << max_zoom << ", " << pool.size() << " threads\n";
+
+    size_t bytes = 0;
+    size_t tiles = 0;
+    auto run     = [&](thread_pool& workers) {
+        std::atomic<size_t> total{0};
+        std::atomic<size_t> count{0};
+        generate_pyramid(geoms, options, workers, [&](const tile_id&, std::string&& tile) {
+            total += tile.size();
+            ++count;
+        });
+        bytes = total;
+        tiles = count;
+    };
+
+    auto baseline = bench::measure([&] { bytes = level_by_level(geoms, options, pool); }, 1);
+    bench::report("level by level", baseline, static_cast<double>(geoms.size()));
+    std::cout << bytes << " bytes\n";
+
+    auto serial = bench::measure([&] { run(single); }, 1);
+    bench::report("generate_pyramid 1 thread", serial, static_cast<double>(geoms.size()));
+
+    auto parallel = bench::measure([&] { run(pool); }, 1);
+    bench::report("generate_pyramid", parallel, static_cast<double>(geoms.size()));
+    bench::do_not_optimize(bytes);
+    std::cout << tiles << " tiles, " << bytes << " bytes\n";
+
+    bench::report_speedup("generate_pyramid vs level by level", baseline, parallel);
+    bench::report_speedup("generate_pyramid vs 1 thread", serial, parallel);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <ciso646>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the previous is_valid(), catching the error thrown for invalid geometries
+template <typename Geometry>
+bool valid_by_exception(const Geometry& geom)
+{
+    try
+    {
+        geom.throw_for_invalid();
+    }
+    catch (const exceptions::geometry_error&)
+    {
+        return false;
+    }
+    return true;
+}
+
+template <typename Geometry>
+void run(const std::string& name, const std::vector<Geometry>& corpus)
+{
+    size_t valid = 0;
+    auto thrown  = bench::measure([&] {
+        valid = 0;
+        for (const auto& geom : corpus)
+        {
+            valid += valid_by_exception(geom) ? 1 : 0;
+        }
+    });
+    bench::report(name + " throw_for_invalid", thrown, static_cast<double>(corpus.size()));
+
+    auto reported = bench::measure([&] {
+        valid = 0;
+        for (const auto& geom : corpus)
+        {
+            valid += geom.is_valid() ? 1 : 0;
+        }
+    });
+    bench::report(name + " is_valid", reported, static_cast<double>(corpus.size()));
+    bench::do_not_optimize(valid);
+    std::cout << valid << " of " << corpus.size() << " valid\n";
+    bench::report_speedup(name + " is_valid vs throw_for_invalid", thrown, reported);
+}
+
+}  // namespace
+
+// usage: bench_validate [num_geometries]
+int main(int argc, char** argv)
+{
+    size_t n = bench::arg(argc, argv, 1, 1000000);
+
+    // every other record is invalid, the errors rotate between the kinds found in real data
+    std::vector<LineString> linestrings;
+    std::vector<Polygon> polygons;
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto x = static_cast<double>(i % 1000);
+        auto y = static_cast<double>(i / 1000);
+        if (i % 2 == 0)
+        {
+            linestrings.push_back(LineString{{x, y}, {x + 1, y}, {x + 1, y + 1}});
+            polygons.push_back(Polygon{{{x, y}, {x + 1, y}, {x + 1, y + 1}, {x, y + 1}, {x, y}}});
+            continue;
+        }
+        switch (i / 2 % 3)
+        {
+            case 0:
+                linestrings.push_back(LineString{{x, y}});
+                polygons.push_back(Polygon{{{x, y}, {x + 1, y}, {x + 1, y + 1}, {x, y + 1}}});
+                break;
+            case 1:
+                linestrings.push_back(LineString{{x, y}, {x, y}});
+                polygons.push_back(Polygon{{{x, y}, {x + 1, y + 1}, {x + 1, y}, {x, y + 1}, {x, y}}});
+                break;
+            default:
+                linestrings.push_back(LineString{{x, y}});
+                polygons.push_back(Polygon{{{x, y}, {x + 1, y}, {x + 1, y + 1}, {x, y + 1}, {x, y}},
+                                           {{x + 2, y}, {x + 3, y}, {x + 3, y + 1}, {x + 2, y}}});
+                break;
+        }
+    }
+
+    std::cout << n << " geometries, half of them invalid\n";
+    run("linestrings", linestrings);
+    run("polygons", polygons);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <benchmark.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// a circle whose vertices alternate between two radii, every edge changes direction
+LinearRing jagged(size_t n)
+{
+    LinearRing res;
+    double spacing = 2 * std::acos(-1.0) / static_cast<double>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        double angle  = spacing * static_cast<double>(i);
+        double radius = i % 2 == 0 ? 1.0 : 1.0 - 5 * spacing;
+        res.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    res.push_back(res.front());
+    return res;
+}
+
+double cross(const Point& a, const Point& b, const Point& c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+// tests every pair of non adjacent edges for a proper crossing
+bool pairwise_simple(const LinearRing& ring)
+{
+    size_t n = ring.size() - 1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = i + 2; j < n; ++j)
+        {
+            if (i == 0 and j == n - 1)
+            {
+                continue;
+            }
+            const auto& a = ring[i];
+            const auto& b = ring[i + 1];
+            const auto& c = ring[j];
+            const auto& d = ring[j + 1];
+            if (cross(a, b, c) * cross(a, b, d) < 0 and cross(c, d, a) * cross(c, d, b) < 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void run(const std::string& name, const Polygon& polygon, bool with_pairwise)
+{
+    size_t n   = polygon[0].size() - 1;
+    bool valid = false;
+    auto sweep = bench::measure([&] { valid = polygon.is_valid(); });
+    bench::report(name + " is_valid", sweep, static_cast<double>(n));
+    bench::do_not_optimize(valid);
+    if (with_pairwise)
+    {
+        auto pairwise = bench::measure([&] { valid = pairwise_simple(polygon[0]); }, 1);
+        bench::report(name + " pairwise", pairwise, static_cast<double>(n));
+        bench::report_speedup(name + " sweep vs pairwise", pairwise, sweep);
+    }
+}
+
+}  // namespace
+
+// usage: bench_validity [num_vertices] [pairwise_vertices]
+int main(int argc, char** argv)
+{
+    size_t num_vertices      = bench::arg(argc, argv, 1, 1000000);
+    size_t pairwise_vertices = bench::arg(argc, argv, 2, 10000);
+
+    std::cout << num_vertices << " vertices, pairwise check up to " << pairwise_vertices << " vertices\n";
+    for (size_t n = pairwise_vertices; n <= num_vertices; n *= 10)
+    {
+        auto suffix = " " + std::to_string(n);
+        run("wobbly" + suffix, Polygon{bench::regular_ring(0, 0, 1, n)}, n == pairwise_vertices);
+        run("jagged" + suffix, Polygon{jagged(n)}, n == pairwise_vertices);
+    }
+    return 0;
+}
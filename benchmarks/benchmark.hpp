@@ -0,0 +1,99 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <simo/shapes.hpp>
+
+namespace bench
+{
+
+/*!
+ * @brief Runs f the given number of times
+ *
+ * @return the fastest run in seconds
+ */
+template <typename F>
+double measure(F f, size_t repeat = 3)
+{
+    double res = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < repeat; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        res                                   = std::min(res, elapsed.count());
+    }
+    return res;
+}
+
+/// prints a benchmark result, the throughput is reported in items per second
+inline void report(const std::string& name, double seconds, double items)
+{
+    std::printf("%-40s %12.3f ms %16.0f items/s\n", name.c_str(), seconds * 1000.0, items / seconds);
+}
+
+/// prints the speedup of the candidate with respect to the baseline
+inline void report_speedup(const std::string& name, double baseline, double candidate)
+{
+    std::printf("%-40s %12.2fx\n", name.c_str(), baseline / candidate);
+}
+
+/// returns the positional argument pos as a number, or the fallback value if missing
+inline size_t arg(int argc, char** argv, int pos, size_t fallback)
+{
+    return pos < argc ? static_cast<size_t>(std::strtoull(argv[pos], nullptr, 10)) : fallback;
+}
+
+/// keeps the compiler from discarding a computed value
+template <typename T>
+void do_not_optimize(const T& value)
+{
+    static const void* volatile sink = nullptr;
+    sink                             = &value;
+    (void)sink;
+}
+
+/// returns n points uniformly distributed in the given bounds
+inline simo::shapes::MultiPoint random_points(size_t n, const simo::shapes::bounds_t& b, unsigned seed = 42)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> x(b.minx, b.maxx);
+    std::uniform_real_distribution<double> y(b.miny, b.maxy);
+    simo::shapes::MultiPoint res;
+    res.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        res.emplace_back(x(gen), y(gen));
+    }
+    return res;
+}
+
+/// returns a closed ring approximating a circle with the given number of vertices, with a wobbly radius
+inline simo::shapes::LinearRing regular_ring(double cx, double cy, double radius, size_t n, bool clockwise = false)
+{
+    simo::shapes::LinearRing res;
+    res.reserve(n + 1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        double angle = 2 * std::acos(-1.0) * static_cast<double>(i) / static_cast<double>(n);
+        double r     = radius * (0.8 + 0.2 * std::sin(7 * angle));
+        res.emplace_back(cx + r * std::cos(clockwise ? -angle : angle), cy + r * std::sin(clockwise ? -angle : angle));
+    }
+    res.push_back(res.front());
+    return res;
+}
+
+/// returns a polygon with a wobbly shell and a hole in the middle
+inline simo::shapes::Polygon regular_polygon(double cx, double cy, double radius, size_t n)
+{
+    return simo::shapes::Polygon{regular_ring(cx, cy, radius, n), regular_ring(cx, cy, radius / 4, std::max<size_t>(3, n / 4), true)};
+}
+
+}  // namespace bench
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <simo/algorithm/measures.hpp>
+#include <simo/algorithm/detail/kernel.hpp>
+#include <simo/algorithm/detail/simd.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief A 3D affine transformation, x' = a x + b y + c z + xoff and so on for y' and z'
+ *
+ * @since 0.0.1
+ */
+struct affine_matrix
+{
+    /// the coefficients of x'
+    double a, b, c;
+
+    /// the coefficients of y'
+    double d, e, f;
+
+    /// the coefficients of z'
+    double g, h, i;
+
+    /// the offsets
+    double xoff, yoff, zoff;
+
+    /*!
+     * @brief Creates the identity transformation
+     *
+     * @since 0.0.1
+     */
+    affine_matrix() noexcept
+        : affine_matrix(1, 0, 0, 1, 0, 0)
+    {}
+
+    /*!
+     * @brief Creates a 2D transformation, the z-coordinates are left unchanged
+     *
+     * @param a the coefficient of x in x'
+     * @param b the coefficient of y in x'
+     * @param d the coefficient of x in y'
+     * @param e the coefficient of y in y'
+     * @param xoff the offset of x'
+     * @param yoff the offset of y'
+     *
+     * @since 0.0.1
+     */
+    affine_matrix(double a, double b, double d, double e, double xoff, double yoff) noexcept
+        : affine_matrix(a, b, 0, d, e, 0, 0, 0, 1, xoff, yoff, 0)
+    {}
+
+    /*!
+     * @brief Creates a 3D transformation
+     *
+     * @since 0.0.1
+     */
+    affine_matrix(double a, double b, double c, double d, double e, double f, double g, double h, double i, double xoff,
+                  double yoff, double zoff) noexcept
+        : a(a), b(b), c(c), d(d), e(e), f(f), g(g), h(h), i(i), xoff(xoff), yoff(yoff), zoff(zoff)
+    {}
+
+    /*!
+     * @param dx the offset of x
+     * @param dy the offset of y
+     * @param dz the offset of z
+     * @return the translation by the given offsets
+     *
+     * @since 0.0.1
+     */
+    static affine_matrix translation(double dx, double dy, double dz = 0) noexcept
+    {
+        return {1, 0, 0, 0, 1, 0, 0, 0, 1, dx, dy, dz};
+    }
+
+    /*!
+     * @param sx the factor of x
+     * @param sy the factor of y
+     * @param sz the factor of z
+     * @return the scaling about the origin by the given factors
+     *
+     * @since 0.0.1
+     */
+    static affine_matrix scaling(double sx, double sy, double sz = 1) noexcept
+    {
+        return {sx, 0, 0, 0, sy, 0, 0, 0, sz, 0, 0, 0};
+    }
+
+    /*!
+     * @param angle the angle in degrees, counter-clockwise
+     * @param ox the x-coordinate of the center of the rotation
+     * @param oy the y-coordinate of the center of the rotation
+     * @return the rotation in the xy plane about the given center
+     *
+     * @since 0.0.1
+     */
+    static affine_matrix rotation(double angle, double ox = 0, double oy = 0) noexcept
+    {
+        // the multiples of 90 degrees are exact
+        double quarter = angle / 90;
+        double cos_a   = std::cos(angle * 0.017453292519943295);
+        double sin_a   = std::sin(angle * 0.017453292519943295);
+        if (quarter == std::floor(quarter))
+        {
+            auto q = static_cast<long long>(quarter) % 4;
+            q      = q < 0 ? q + 4 : q;
+            cos_a  = q == 0 ? 1 : (q == 2 ? -1 : 0);
+            sin_a  = q == 1 ? 1 : (q == 3 ? -1 : 0);
+        }
+        return {cos_a, -sin_a, sin_a, cos_a, ox - cos_a * ox + sin_a * oy, oy - sin_a * ox - cos_a * oy};
+    }
+
+    /*!
+     * @param other the transformation applied first
+     * @return the transformation applying other, then this one
+     *
+     * @since 0.0.1
+     */
+    affine_matrix operator*(const affine_matrix& other) const noexcept
+    {
+        const auto& o = other;
+        return {a * o.a + b * o.d + c * o.g, a * o.b + b * o.e + c * o.h, a * o.c + b * o.f + c * o.i,
+                d * o.a + e * o.d + f * o.g, d * o.b + e * o.e + f * o.h, d * o.c + e * o.f + f * o.i,
+                g * o.a + h * o.d + i * o.g, g * o.b + h * o.e + i * o.h, g * o.c + h * o.f + i * o.i,
+                a * o.xoff + b * o.yoff + c * o.zoff + xoff, d * o.xoff + e * o.yoff + f * o.zoff + yoff,
+                g * o.xoff + h * o.yoff + i * o.zoff + zoff};
+    }
+};
+
+namespace detail
+{
+
+/// @private applies an affine transformation to the runs of points, simd::width points at a time
+struct affine_points
+{
+    /// the transformation
+    affine_matrix m;
+
+    template <typename Point>
+    void operator()(Point* points, size_t n) const
+    {
+        apply(points, n, typename is_flat_xy<Point>::type{}, typename is_3d<Point>::type{});
+    }
+
+    /// the points are contiguous (x, y) doubles, transformed without copies
+    template <typename Point>
+    void apply(Point* points, size_t n, std::true_type, std::false_type) const
+    {
+        double* p = &points[0].x;
+        auto a    = simd::set1(m.a);
+        auto b    = simd::set1(m.b);
+        auto d    = simd::set1(m.d);
+        auto e    = simd::set1(m.e);
+        auto xoff = simd::set1(m.xoff);
+        auto yoff = simd::set1(m.yoff);
+        size_t i  = 0;
+        for (; i + simd::width <= n; i += simd::width)
+        {
+            simd::batch x, y;
+            simd::load_xy(p + 2 * i, x, y);
+            simd::store_xy(p + 2 * i, a * x + b * y + xoff, d * x + e * y + yoff);
+        }
+        for (; i < n; ++i)
+        {
+            double x    = points[i].x;
+            double y    = points[i].y;
+            points[i].x = m.a * x + m.b * y + m.xoff;
+            points[i].y = m.d * x + m.e * y + m.yoff;
+        }
+    }
+
+    /// the coordinates are copied to a batch, the missing lanes are zeros
+    template <typename Point>
+    void apply(Point* points, size_t n, std::false_type, std::false_type) const
+    {
+        using coord_type = typename Point::coord_type;
+        double xs[simd::width];
+        double ys[simd::width];
+        for (size_t i = 0; i < n; i += simd::width)
+        {
+            size_t count = std::min(simd::width, n - i);
+            for (size_t j = 0; j < simd::width; ++j)
+            {
+                xs[j] = j < count ? static_cast<double>(points[i + j].x) : 0;
+                ys[j] = j < count ? static_cast<double>(points[i + j].y) : 0;
+            }
+            auto x = simd::load(xs);
+            auto y = simd::load(ys);
+            simd::store(xs, simd::set1(m.a) * x + simd::set1(m.b) * y + simd::set1(m.xoff));
+            simd::store(ys, simd::set1(m.d) * x + simd::set1(m.e) * y + simd::set1(m.yoff));
+            for (size_t j = 0; j < count; ++j)
+            {
+                points[i + j].x = static_cast<coord_type>(xs[j]);
+                points[i + j].y = static_cast<coord_type>(ys[j]);
+            }
+        }
+    }
+
+    /// the z-coordinates take part in the transformation, a point at a time since the stride is not 2
+    template <typename Point>
+    void apply(Point* points, size_t n, std::false_type, std::true_type) const
+    {
+        using coord_type = typename Point::coord_type;
+        for (size_t i = 0; i < n; ++i)
+        {
+            auto x      = static_cast<double>(points[i].x);
+            auto y      = static_cast<double>(points[i].y);
+            auto z      = static_cast<double>(points[i].z);
+            points[i].x = static_cast<coord_type>(m.a * x + m.b * y + m.c * z + m.xoff);
+            points[i].y = static_cast<coord_type>(m.d * x + m.e * y + m.f * z + m.yoff);
+            points[i].z = static_cast<coord_type>(m.g * x + m.h * y + m.i * z + m.zoff);
+        }
+    }
+};
+
+}  // namespace detail
+
+/*!
+ * @brief Applies an affine transformation to every point of a geometry, in place
+ *
+ * The points of every part of the geometry are transformed in a single pass, the (x, y) double
+ * points are loaded and stored in simd::width wide batches straight from the interleaved
+ * storage, the points with a z-coordinate go through the full 3D transformation, the
+ * m-coordinates are left unchanged. The integer coordinates are truncated.
+ *
+ * @param geom the geometry
+ * @param matrix the transformation, the z terms are ignored for the 2D points
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void affine_transform(Geometry& geom, const affine_matrix& matrix)
+{
+    detail::affine_points f{matrix};
+    detail::for_each_point_run(geom, typename geometry_traits<Geometry>::tag{}, f);
+}
+
+/*!
+ * @brief Translates a geometry, in place
+ *
+ * @param geom the geometry
+ * @param dx the offset of x
+ * @param dy the offset of y
+ * @param dz the offset of z, ignored for the 2D points
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void translate(Geometry& geom, double dx, double dy, double dz = 0)
+{
+    affine_transform(geom, affine_matrix::translation(dx, dy, dz));
+}
+
+/*!
+ * @brief Scales a geometry about the origin, in place
+ *
+ * @param geom the geometry
+ * @param sx the factor of x
+ * @param sy the factor of y
+ * @param sz the factor of z, ignored for the 2D points
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void scale(Geometry& geom, double sx, double sy, double sz = 1)
+{
+    affine_transform(geom, affine_matrix::scaling(sx, sy, sz));
+}
+
+/*!
+ * @brief Rotates a geometry in the xy plane, in place
+ *
+ * @param geom the geometry
+ * @param angle the angle in degrees, counter-clockwise
+ * @param ox the x-coordinate of the center of the rotation
+ * @param oy the y-coordinate of the center of the rotation
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void rotate(Geometry& geom, double angle, double ox = 0, double oy = 0)
+{
+    affine_transform(geom, affine_matrix::rotation(angle, ox, oy));
+}
+
+}  // namespace shapes
+}  // namespace simo
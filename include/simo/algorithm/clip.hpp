@@ -0,0 +1,540 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <simo/geom/detail/bounds.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief Scratch memory reused across the polygons clipped by one thread
+ *
+ * @tparam Point the point type of the polygons
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+struct clip_buffers
+{
+    /// the ring clipped so far
+    std::vector<Point> ring;
+
+    /// the output of the current clipping edge
+    std::vector<Point> scratch;
+};
+
+namespace detail
+{
+
+/// the outcode bits of the Cohen-Sutherland algorithm
+constexpr static const uint8_t CLIP_LEFT   = 1;
+constexpr static const uint8_t CLIP_RIGHT  = 2;
+constexpr static const uint8_t CLIP_BOTTOM = 4;
+constexpr static const uint8_t CLIP_TOP    = 8;
+
+/// @private
+template <typename Point>
+uint8_t outcode(const Point& p, const bounds_t& bounds) noexcept
+{
+    auto x       = static_cast<double>(p.x);
+    auto y       = static_cast<double>(p.y);
+    uint8_t code = 0;
+    if (x < bounds.minx)
+    {
+        code |= CLIP_LEFT;
+    }
+    else if (x > bounds.maxx)
+    {
+        code |= CLIP_RIGHT;
+    }
+    if (y < bounds.miny)
+    {
+        code |= CLIP_BOTTOM;
+    }
+    else if (y > bounds.maxy)
+    {
+        code |= CLIP_TOP;
+    }
+    return code;
+}
+
+/// @private the point at t along a -> b, every coordinate is interpolated
+template <typename Point>
+Point interpolate(const Point& a, const Point& b, double t) noexcept
+{
+    using coord_type = typename Point::coord_type;
+
+    Point res = a;
+    for (size_t i = 0; i < Point::N; ++i)
+    {
+        auto from     = static_cast<double>(a.coords[i]);
+        res.coords[i] = static_cast<coord_type>(from + t * (static_cast<double>(b.coords[i]) - from));
+    }
+    return res;
+}
+
+/// @private shrinks [t0, t1] to the part of a -> b inside the bounds (Liang-Barsky)
+template <typename Point>
+bool clip_parameters(const Point& a, const Point& b, const bounds_t& bounds, double& t0, double& t1) noexcept
+{
+    auto ax = static_cast<double>(a.x);
+    auto ay = static_cast<double>(a.y);
+    auto dx = static_cast<double>(b.x) - ax;
+    auto dy = static_cast<double>(b.y) - ay;
+
+    double p[4] = {-dx, dx, -dy, dy};
+    double q[4] = {ax - bounds.minx, bounds.maxx - ax, ay - bounds.miny, bounds.maxy - ay};
+    t0          = 0;
+    t1          = 1;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        if (p[i] == 0)
+        {
+            if (q[i] < 0)
+            {
+                return false;
+            }
+            continue;
+        }
+        double t = q[i] / p[i];
+        if (p[i] < 0)
+        {
+            t0 = std::max(t0, t);
+        }
+        else
+        {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @private appends a point unless it repeats the last one
+template <typename Points, typename Point>
+void push_distinct(Points& points, const Point& p)
+{
+    if (points.empty() or not(points.back().x == p.x and points.back().y == p.y))
+    {
+        points.push_back(p);
+    }
+}
+
+/// @private the next part of a multi geometry, reusing the memory of the previous clipping
+template <typename Multi>
+typename Multi::value_type& next_part(Multi& res, size_t& count)
+{
+    if (count == res.size())
+    {
+        res.emplace_back();
+    }
+    auto& part = res[count++];
+    part.clear();
+    return part;
+}
+
+/// @private drops the parts left over from the previous clipping
+template <typename Multi>
+void trim_parts(Multi& res, size_t count)
+{
+    res.erase(res.begin() + static_cast<std::ptrdiff_t>(count), res.end());
+}
+
+/// @private drops the last part if it collapsed to a point
+template <typename MultiLineString>
+void close_part(MultiLineString& res, size_t& count)
+{
+    if (res[count - 1].size() < 2)
+    {
+        --count;
+    }
+}
+
+/// @private appends the parts of a path inside the bounds (Cohen-Sutherland and Liang-Barsky)
+template <typename Path, typename MultiLineString>
+void clip_path(const Path& path, const bounds_t& bounds, MultiLineString& res, size_t& count)
+{
+    if (path.empty())
+    {
+        return;
+    }
+    typename MultiLineString::value_type* part = nullptr;
+    auto code_a                                = outcode(path[0], bounds);
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        const auto& a = path[i - 1];
+        const auto& b = path[i];
+        auto code_b   = outcode(b, bounds);
+        auto codes    = static_cast<uint8_t>(code_a | code_b);
+        auto outside  = static_cast<uint8_t>(code_a & code_b);
+        code_a        = code_b;
+        if (codes == 0)
+        {
+            if (part == nullptr)
+            {
+                part = &next_part(res, count);
+                part->push_back(a);
+            }
+            push_distinct(*part, b);
+            continue;
+        }
+        double t0 = 0;
+        double t1 = 1;
+        if (outside != 0 or not clip_parameters(a, b, bounds, t0, t1))
+        {
+            continue;
+        }
+        if (part == nullptr)
+        {
+            part = &next_part(res, count);
+            part->push_back(t0 == 0 ? a : interpolate(a, b, t0));
+        }
+        push_distinct(*part, code_b == 0 ? b : interpolate(a, b, t1));
+        if (code_b != 0)
+        {
+            close_part(res, count);
+            part = nullptr;
+        }
+    }
+    if (part != nullptr)
+    {
+        close_part(res, count);
+    }
+}
+
+/// @private keeps the part of an open ring on one side of an axis-parallel line (Sutherland-Hodgman)
+template <typename Point>
+void clip_ring_edge(const Point* ring, size_t n, std::vector<Point>& res, size_t axis, double value, bool keep_above)
+{
+    using coord_type = typename Point::coord_type;
+
+    res.clear();
+    if (n == 0)
+    {
+        return;
+    }
+    auto inside = [&](const Point& p) {
+        auto coord = static_cast<double>(p.coords[axis]);
+        return keep_above ? coord >= value : coord <= value;
+    };
+    const Point* prev = ring + n - 1;
+    bool prev_inside  = inside(*prev);
+    for (const Point* it = ring; it != ring + n; ++it)
+    {
+        const auto& p = *it;
+        bool p_inside = inside(p);
+        if (p_inside != prev_inside)
+        {
+            auto from  = static_cast<double>(prev->coords[axis]);
+            auto t     = (value - from) / (static_cast<double>(p.coords[axis]) - from);
+            auto cross = interpolate(*prev, p, t);
+            // the crossing lies exactly on the edge
+            cross.coords[axis] = static_cast<coord_type>(value);
+            push_distinct(res, cross);
+        }
+        if (p_inside)
+        {
+            push_distinct(res, p);
+        }
+        prev        = &p;
+        prev_inside = p_inside;
+    }
+    if (res.size() > 1 and res.front().x == res.back().x and res.front().y == res.back().y)
+    {
+        res.pop_back();
+    }
+}
+
+/// @private twice the signed area of an open ring
+template <typename Point>
+double ring_area(const std::vector<Point>& ring) noexcept
+{
+    double sum = 0;
+    for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+    {
+        sum += (static_cast<double>(ring[j].x) - static_cast<double>(ring[i].x)) *
+               (static_cast<double>(ring[j].y) + static_cast<double>(ring[i].y));
+    }
+    return sum;
+}
+
+/// @private whether an open ring clipped to the bounds is the bounds themselves
+template <typename Point>
+bool covers_bounds(const std::vector<Point>& ring, const bounds_t& bounds) noexcept
+{
+    // a ring with its vertices on the edges may still have a wedge crossing the bounds, only the area tells
+    return std::abs(ring_area(ring)) == 2 * (bounds.maxx - bounds.minx) * (bounds.maxy - bounds.miny);
+}
+
+/// the outcome of clipping one ring
+enum class ring_clip : uint8_t
+{
+    /// the ring has no area inside the bounds
+    OUTSIDE = 0,
+    /// the part of the ring inside the bounds was written
+    CLIPPED = 1,
+    /// the ring encloses the bounds
+    COVERS = 2
+};
+
+/// @private clips a closed ring to the bounds, the result is closed
+template <typename LinearRing, typename Point>
+ring_clip clip_ring(const LinearRing& ring, const bounds_t& bounds, LinearRing& res, clip_buffers<Point>& buffers)
+{
+    if (ring.size() < 4)
+    {
+        return ring_clip::OUTSIDE;
+    }
+    bounds_t extent;
+    for (const auto& p : ring)
+    {
+        extent.minx = std::min(extent.minx, static_cast<double>(p.x));
+        extent.miny = std::min(extent.miny, static_cast<double>(p.y));
+        extent.maxx = std::max(extent.maxx, static_cast<double>(p.x));
+        extent.maxy = std::max(extent.maxy, static_cast<double>(p.y));
+    }
+    if (extent.minx > bounds.maxx or extent.maxx < bounds.minx or extent.miny > bounds.maxy or
+        extent.maxy < bounds.miny)
+    {
+        return ring_clip::OUTSIDE;
+    }
+    if (extent.minx >= bounds.minx and extent.maxx <= bounds.maxx and extent.miny >= bounds.miny and
+        extent.maxy <= bounds.maxy)
+    {
+        res.assign(ring.begin(), ring.end());
+        return ring_clip::CLIPPED;
+    }
+
+    auto& current = buffers.ring;
+    auto& next    = buffers.scratch;
+    clip_ring_edge(ring.data(), ring.size() - 1, next, 0, bounds.minx, true);
+    clip_ring_edge(next.data(), next.size(), current, 0, bounds.maxx, false);
+    clip_ring_edge(current.data(), current.size(), next, 1, bounds.miny, true);
+    clip_ring_edge(next.data(), next.size(), current, 1, bounds.maxy, false);
+    if (current.size() < 3 or ring_area(current) == 0)
+    {
+        return ring_clip::OUTSIDE;
+    }
+    if (covers_bounds(current, bounds))
+    {
+        return ring_clip::COVERS;
+    }
+    res.assign(current.begin(), current.end());
+    res.push_back(current.front());
+    return ring_clip::CLIPPED;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Clips a multipoint to the given bounds
+ *
+ * @param multipoint the multipoint to clip
+ * @param bounds the clipping rectangle, its edges are inside
+ * @param res the points inside the bounds, its memory is reused
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void clip(const basic_multipoint<T>& multipoint, const bounds_t& bounds, basic_multipoint<T>& res)
+{
+    res.clear();
+    for (const auto& p : multipoint)
+    {
+        if (detail::outcode(p, bounds) == 0)
+        {
+            res.push_back(p);
+        }
+    }
+}
+
+/*!
+ * @brief Clips a linestring to the given bounds
+ *
+ * Every segment gets the Cohen-Sutherland outcodes of its ends, the segments trivially inside
+ * or outside are kept or skipped, the others are cut with the Liang-Barsky algorithm. The z and m
+ * coordinates of the cut points are interpolated.
+ *
+ * @param linestring the linestring to clip
+ * @param bounds the clipping rectangle, its edges are inside
+ * @param res the parts of the linestring inside the bounds, its memory is reused
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void clip(const basic_linestring<T>& linestring, const bounds_t& bounds,
+          basic_multilinestring<basic_linestring<T>>& res)
+{
+    size_t count = 0;
+    detail::clip_path(linestring, bounds, res, count);
+    detail::trim_parts(res, count);
+}
+
+/*!
+ * @brief Clips a multilinestring to the given bounds
+ *
+ * @param multilinestring the multilinestring to clip
+ * @param bounds the clipping rectangle, its edges are inside
+ * @param res the parts of the linestrings inside the bounds, its memory is reused
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void clip(const basic_multilinestring<T>& multilinestring, const bounds_t& bounds, basic_multilinestring<T>& res)
+{
+    size_t count = 0;
+    for (const auto& linestring : multilinestring)
+    {
+        detail::clip_path(linestring, bounds, res, count);
+    }
+    detail::trim_parts(res, count);
+}
+
+/*!
+ * @brief Clips a polygon to the given bounds
+ *
+ * Every ring is clipped against the four edges with the Sutherland-Hodgman algorithm. The holes
+ * outside the bounds are dropped, the polygon is empty if its shell misses the bounds or a hole
+ * encloses them. The clipped rings may run along the edges of the bounds, as the tiles of a
+ * vector tile set do.
+ *
+ * @param polygon the polygon to clip
+ * @param bounds the clipping rectangle
+ * @param res the part of the polygon inside the bounds, its memory is reused
+ * @param buffers the scratch memory, reused across calls
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void clip(const basic_polygon<T>& polygon, const bounds_t& bounds, basic_polygon<T>& res,
+          clip_buffers<typename T::point_type>& buffers)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        auto& ring   = detail::next_part(res, count);
+        auto outcome = detail::clip_ring(polygon[i], bounds, ring, buffers);
+        if (outcome == detail::ring_clip::COVERS and i == 0)
+        {
+            // the shell is the bounds
+            ring.assign(buffers.ring.begin(), buffers.ring.end());
+            ring.push_back(buffers.ring.front());
+            continue;
+        }
+        if (outcome == detail::ring_clip::COVERS or (outcome == detail::ring_clip::OUTSIDE and i == 0))
+        {
+            count = 0;
+            break;
+        }
+        if (outcome == detail::ring_clip::OUTSIDE)
+        {
+            --count;
+        }
+    }
+    detail::trim_parts(res, count);
+}
+
+/*!
+ * @brief Clips a multipolygon to the given bounds
+ *
+ * @param multipolygon the multipolygon to clip
+ * @param bounds the clipping rectangle
+ * @param res the parts of the polygons inside the bounds, its memory is reused
+ * @param buffers the scratch memory, reused across calls
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void clip(const basic_multipolygon<T>& multipolygon, const bounds_t& bounds, basic_multipolygon<T>& res,
+          clip_buffers<typename T::point_type>& buffers)
+{
+    size_t count = 0;
+    for (const auto& polygon : multipolygon)
+    {
+        auto& part = detail::next_part(res, count);
+        clip(polygon, bounds, part, buffers);
+        if (part.empty())
+        {
+            --count;
+        }
+    }
+    detail::trim_parts(res, count);
+}
+
+namespace detail
+{
+
+/// @private
+template <typename Geometry, typename Point>
+void clip_geometry(const Geometry& geom, const bounds_t& bounds, Geometry& res, clip_buffers<Point>& buffers)
+{
+    clip(geom, bounds, res, buffers);
+}
+
+/// @private
+template <typename T, typename Point>
+void clip_geometry(const basic_multipoint<T>& geom, const bounds_t& bounds, basic_multipoint<T>& res,
+                   clip_buffers<Point>&)
+{
+    clip(geom, bounds, res);
+}
+
+/// @private
+template <typename T, typename Point>
+void clip_geometry(const basic_multilinestring<T>& geom, const bounds_t& bounds, basic_multilinestring<T>& res,
+                   clip_buffers<Point>&)
+{
+    clip(geom, bounds, res);
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Clips a geometry to the given bounds
+ *
+ * A convenience for a single clipping, clipping against many bounds should reuse the result
+ * and the buffers.
+ *
+ * @param geom the multipoint, multilinestring, polygon or multipolygon to clip
+ * @param bounds the clipping rectangle
+ * @return the part of the geometry inside the bounds
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+Geometry clip(const Geometry& geom, const bounds_t& bounds)
+{
+    Geometry res;
+    clip_buffers<typename Geometry::point_type> buffers;
+    detail::clip_geometry(geom, bounds, res, buffers);
+    return res;
+}
+
+/*!
+ * @brief Clips a linestring to the given bounds
+ *
+ * @param linestring the linestring to clip
+ * @param bounds the clipping rectangle
+ * @return the parts of the linestring inside the bounds
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+basic_multilinestring<basic_linestring<T>> clip(const basic_linestring<T>& linestring, const bounds_t& bounds)
+{
+    basic_multilinestring<basic_linestring<T>> res;
+    clip(linestring, bounds, res);
+    return res;
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,428 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <simo/thread_pool.hpp>
+#include <simo/algorithm/detail/kernel.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// a contiguous run of points of a geometry
+template <typename Point>
+struct point_span
+{
+    /// the first point
+    const Point* data;
+
+    /// the number of points
+    size_t size;
+};
+
+/// @private
+template <typename Geometry, typename Tag, typename Point>
+void collect_spans(const Geometry&, Tag, std::vector<point_span<Point>>&)
+{}
+
+/// @private
+template <typename Point>
+void collect_spans(const Point& point, point_tag, std::vector<point_span<Point>>& res)
+{
+    res.push_back({&point, 1});
+}
+
+/// @private
+template <typename Path, typename Point>
+void collect_path(const Path& path, std::vector<point_span<Point>>& res)
+{
+    if (not path.empty())
+    {
+        res.push_back({path.data(), path.size()});
+    }
+}
+
+/// @private
+template <typename MultiPoint, typename Point>
+void collect_spans(const MultiPoint& multipoint, multipoint_tag, std::vector<point_span<Point>>& res)
+{
+    collect_path(multipoint, res);
+}
+
+/// @private
+template <typename LineString, typename Point>
+void collect_spans(const LineString& linestring, linestring_tag, std::vector<point_span<Point>>& res)
+{
+    collect_path(linestring, res);
+}
+
+/// @private
+template <typename MultiLineString, typename Point>
+void collect_spans(const MultiLineString& multilinestring, multilinestring_tag, std::vector<point_span<Point>>& res)
+{
+    for (const auto& linestring : multilinestring)
+    {
+        collect_path(linestring, res);
+    }
+}
+
+/// @private
+template <typename Polygon, typename Point>
+void collect_spans(const Polygon& polygon, polygon_tag, std::vector<point_span<Point>>& res)
+{
+    // the holes lie inside the shell
+    if (not polygon.empty())
+    {
+        collect_path(polygon[0], res);
+    }
+}
+
+/// @private
+template <typename MultiPolygon, typename Point>
+void collect_spans(const MultiPolygon& multipolygon, multipolygon_tag, std::vector<point_span<Point>>& res)
+{
+    for (const auto& polygon : multipolygon)
+    {
+        collect_spans(polygon, polygon_tag{}, res);
+    }
+}
+
+/// @private
+template <typename Point>
+bool xy_less(const Point& a, const Point& b) noexcept
+{
+    return a.x < b.x or (a.x == b.x and a.y < b.y);
+}
+
+/*!
+ * @brief The points extreme in eight directions, in counter-clockwise order
+ *
+ * The octagon they form is inscribed in the convex hull, the points strictly inside it
+ * cannot be hull vertices (Akl-Toussaint heuristic).
+ */
+template <typename Point>
+struct octagon
+{
+    /// the extreme point of each direction
+    Point points[8];
+
+    /// the projection of each extreme point on its direction
+    double values[8];
+
+    /// the number of distinct vertices after update() calls are done, see close()
+    size_t size = 0;
+
+    octagon()
+    {
+        std::fill(values, values + 8, -std::numeric_limits<double>::infinity());
+    }
+
+    void update(const Point& p) noexcept
+    {
+        auto x = static_cast<double>(p.x);
+        auto y = static_cast<double>(p.y);
+        // the directions (0, -1), (1, -1), (1, 0), (1, 1), (0, 1), (-1, 1), (-1, 0), (-1, -1)
+        const double projections[8] = {-y, x - y, x, x + y, y, y - x, -x, -x - y};
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (projections[i] > values[i])
+            {
+                values[i] = projections[i];
+                points[i] = p;
+            }
+        }
+    }
+
+    void merge(const octagon& other) noexcept
+    {
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (other.values[i] > values[i])
+            {
+                values[i] = other.values[i];
+                points[i] = other.points[i];
+            }
+        }
+    }
+
+    /// removes the repeated vertices
+    void close() noexcept
+    {
+        size = 0;
+        if (values[0] == -std::numeric_limits<double>::infinity())
+        {
+            return;
+        }
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (size == 0 or points[i].x != points[size - 1].x or points[i].y != points[size - 1].y)
+            {
+                points[size++] = points[i];
+            }
+        }
+        while (size > 1 and points[0].x == points[size - 1].x and points[0].y == points[size - 1].y)
+        {
+            --size;
+        }
+    }
+
+    /// @return true if p lies strictly inside the octagon, otherwise false
+    bool contains(const Point& p) const noexcept
+    {
+        if (size < 3)
+        {
+            return false;
+        }
+        auto x = static_cast<double>(p.x);
+        auto y = static_cast<double>(p.y);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto& a = points[i];
+            const auto& b = points[i + 1 == size ? 0 : i + 1];
+            if (cross(static_cast<double>(a.x), static_cast<double>(a.y), static_cast<double>(b.x),
+                      static_cast<double>(b.y), x, y) <= 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// @private
+template <typename Point>
+bool turns_left(const Point& a, const Point& b, const Point& c) noexcept
+{
+    return cross(static_cast<double>(a.x), static_cast<double>(a.y), static_cast<double>(b.x), static_cast<double>(b.y),
+                 static_cast<double>(c.x), static_cast<double>(c.y)) > 0;
+}
+
+/*!
+ * @brief Computes the convex hull of the points with Andrew's monotone chain algorithm
+ *
+ * @param points the points, sorted in place
+ * @return the hull vertices in counter-clockwise order without collinear vertices, not closed
+ */
+template <typename Point>
+std::vector<Point> monotone_chain(std::vector<Point>& points)
+{
+    std::sort(points.begin(), points.end(), xy_less<Point>);
+    points.erase(std::unique(points.begin(), points.end(),
+                             [](const Point& a, const Point& b) { return a.x == b.x and a.y == b.y; }),
+                 points.end());
+    size_t n = points.size();
+    if (n < 3)
+    {
+        return points;
+    }
+
+    std::vector<Point> res(2 * n);
+    size_t k = 0;
+    // the lower chain from left to right, then the upper chain back
+    for (size_t i = 0; i < n; ++i)
+    {
+        while (k >= 2 and not turns_left(res[k - 2], res[k - 1], points[i]))
+        {
+            --k;
+        }
+        res[k++] = points[i];
+    }
+    for (size_t i = n - 1, lower = k + 1; i > 0; --i)
+    {
+        while (k >= lower and not turns_left(res[k - 2], res[k - 1], points[i - 1]))
+        {
+            --k;
+        }
+        res[k++] = points[i - 1];
+    }
+    // the last vertex repeats the first
+    res.resize(k - 1);
+    return res;
+}
+
+/// @private
+template <typename Point>
+void update_octagon(const std::vector<point_span<Point>>& spans, size_t lo, size_t hi, octagon<Point>& res)
+{
+    for (size_t i = lo; i < hi; ++i)
+    {
+        for (size_t j = 0; j < spans[i].size; ++j)
+        {
+            res.update(spans[i].data[j]);
+        }
+    }
+}
+
+/// @private
+template <typename Point>
+void append_candidates(const std::vector<point_span<Point>>& spans, size_t lo, size_t hi, const octagon<Point>& filter,
+                       std::vector<Point>& res)
+{
+    for (size_t i = lo; i < hi; ++i)
+    {
+        for (size_t j = 0; j < spans[i].size; ++j)
+        {
+            const auto& p = spans[i].data[j];
+            if (not filter.contains(p))
+            {
+                res.push_back(p);
+            }
+        }
+    }
+}
+
+/// @private
+template <typename Point, typename Geometry>
+std::vector<point_span<Point>> collect_spans(const Geometry& geom)
+{
+    std::vector<point_span<Point>> res;
+    collect_spans(geom, typename geometry_traits<Geometry>::tag{}, res);
+    return res;
+}
+
+/*!
+ * @brief Splits the spans in chunks of about grain points
+ *
+ * @param spans the spans, the longer ones are cut in place
+ * @param grain the number of points per chunk
+ * @return the first span of every chunk followed by the number of spans
+ */
+template <typename Point>
+std::vector<size_t> split_spans(std::vector<point_span<Point>>& spans, size_t grain)
+{
+    std::vector<point_span<Point>> pieces;
+    for (const auto& span : spans)
+    {
+        for (size_t lo = 0; lo < span.size; lo += grain)
+        {
+            pieces.push_back({span.data + lo, std::min(grain, span.size - lo)});
+        }
+    }
+    spans.swap(pieces);
+
+    std::vector<size_t> res(1, 0);
+    size_t count = 0;
+    for (size_t i = 0; i < spans.size(); ++i)
+    {
+        count += spans[i].size;
+        if (count >= grain)
+        {
+            res.push_back(i + 1);
+            count = 0;
+        }
+    }
+    if (res.back() != spans.size())
+    {
+        res.push_back(spans.size());
+    }
+    return res;
+}
+
+/// @private
+template <typename Point>
+basic_polygon<basic_linestring<Point>> make_hull(std::vector<Point> vertices)
+{
+    basic_polygon<basic_linestring<Point>> res;
+    if (vertices.empty())
+    {
+        return res;
+    }
+    basic_linestring<Point> ring(vertices.begin(), vertices.end());
+    ring.push_back(vertices.front());
+    res.push_back(std::move(ring));
+    return res;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Computes the convex hull of a geometry
+ *
+ * The points strictly inside the octagon of the extreme points in eight directions are
+ * discarded first (Akl-Toussaint heuristic), the remaining ones are hulled with Andrew's
+ * monotone chain algorithm in O(n log n).
+ *
+ * @param geom the geometry
+ * @return a polygon whose shell is the hull in counter-clockwise order, without collinear
+ * vertices. The shell of a degenerate hull is the closed sequence of its one or two extreme
+ * points, the polygon is empty if the geometry is empty
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+basic_polygon<basic_linestring<typename Geometry::point_type>> convex_hull(const Geometry& geom)
+{
+    using point_type = typename Geometry::point_type;
+
+    auto spans = detail::collect_spans<point_type>(geom);
+    detail::octagon<point_type> filter;
+    detail::update_octagon(spans, 0, spans.size(), filter);
+    filter.close();
+
+    std::vector<point_type> candidates;
+    detail::append_candidates(spans, 0, spans.size(), filter, candidates);
+    return detail::make_hull(detail::monotone_chain(candidates));
+}
+
+/*!
+ * @brief Computes the convex hull of a geometry in parallel
+ *
+ * The points are split in chunks, the extreme points and the hull of every chunk are
+ * computed on the pool threads. The hull of the chunk hulls is the result.
+ *
+ * @param geom the geometry
+ * @param pool the thread pool
+ * @return the same polygon as convex_hull(geom)
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+basic_polygon<basic_linestring<typename Geometry::point_type>> convex_hull(const Geometry& geom, thread_pool& pool)
+{
+    using point_type = typename Geometry::point_type;
+
+    auto spans   = detail::collect_spans<point_type>(geom);
+    size_t total = 0;
+    for (const auto& span : spans)
+    {
+        total += span.size;
+    }
+    // a few chunks per thread balance the uneven filtering
+    size_t grain = std::max<size_t>(1024, total / (4 * pool.size()) + 1);
+    auto chunks  = detail::split_spans(spans, grain);
+    size_t n     = chunks.size() - 1;
+
+    std::vector<detail::octagon<point_type>> octagons(n);
+    parallel_for(pool, 0, n, 1, [&spans, &chunks, &octagons](size_t i, size_t) {
+        detail::update_octagon(spans, chunks[i], chunks[i + 1], octagons[i]);
+    });
+    detail::octagon<point_type> filter;
+    for (const auto& octagon : octagons)
+    {
+        filter.merge(octagon);
+    }
+    filter.close();
+
+    std::vector<std::vector<point_type>> hulls(n);
+    parallel_for(pool, 0, n, 1, [&spans, &chunks, &filter, &hulls](size_t i, size_t) {
+        std::vector<point_type> candidates;
+        detail::append_candidates(spans, chunks[i], chunks[i + 1], filter, candidates);
+        hulls[i] = detail::monotone_chain(candidates);
+    });
+
+    std::vector<point_type> vertices;
+    for (const auto& hull : hulls)
+    {
+        vertices.insert(vertices.end(), hull.begin(), hull.end());
+    }
+    return detail::make_hull(detail::monotone_chain(vertices));
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#    define SIMO_SHAPES_BMI2 1
+#    include <immintrin.h>
+#endif
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// the even bits of a 64 bit word
+constexpr static const uint64_t EVEN_BITS = 0x5555555555555555ULL;
+
+/// the odd bits of a 64 bit word
+constexpr static const uint64_t ODD_BITS = 0xAAAAAAAAAAAAAAAAULL;
+
+/// the bit interleaving tables, for the targets without PDEP / PEXT
+struct interleave_tables
+{
+    /// the bits of a byte moved to the even bits of a 16 bit word
+    uint16_t spread[256];
+
+    /// the even bits of a byte in the low nibble, the odd bits in the high nibble
+    uint8_t compact[256];
+
+    interleave_tables() noexcept
+    {
+        for (uint32_t v = 0; v < 256; ++v)
+        {
+            uint32_t wide = 0;
+            uint32_t even = 0;
+            uint32_t odd  = 0;
+            for (uint32_t bit = 0; bit < 8; ++bit)
+            {
+                wide |= ((v >> bit) & 1) << (2 * bit);
+                if (bit % 2 == 0)
+                {
+                    even |= ((v >> bit) & 1) << (bit / 2);
+                }
+                else
+                {
+                    odd |= ((v >> bit) & 1) << (bit / 2);
+                }
+            }
+            spread[v]  = static_cast<uint16_t>(wide);
+            compact[v] = static_cast<uint8_t>(even | (odd << 4));
+        }
+    }
+};
+
+/// @private
+inline const interleave_tables& get_interleave_tables() noexcept
+{
+    static const interleave_tables tables;
+    return tables;
+}
+
+/// @private moves bit i of value to bit 2i
+inline uint64_t spread_bits(uint32_t value) noexcept
+{
+#if defined(SIMO_SHAPES_BMI2)
+    return _pdep_u64(value, EVEN_BITS);
+#else
+    const auto& tables = get_interleave_tables();
+    return static_cast<uint64_t>(tables.spread[value & 0xff]) |
+           static_cast<uint64_t>(tables.spread[(value >> 8) & 0xff]) << 16 |
+           static_cast<uint64_t>(tables.spread[(value >> 16) & 0xff]) << 32 |
+           static_cast<uint64_t>(tables.spread[value >> 24]) << 48;
+#endif
+}
+
+/// @private moves bit 2i of value to bit i, the odd bits are ignored
+inline uint32_t compact_bits(uint64_t value) noexcept
+{
+#if defined(SIMO_SHAPES_BMI2)
+    return static_cast<uint32_t>(_pext_u64(value, EVEN_BITS));
+#else
+    const auto& tables = get_interleave_tables();
+    uint32_t res       = 0;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        res |= static_cast<uint32_t>(tables.compact[(value >> (8 * i)) & 0xff] & 0xf) << (4 * i);
+    }
+    return res;
+#endif
+}
+
+/// @private maps a coordinate in [min, min + range] to a 32 bit fraction, clamping the values out of range
+inline uint32_t quantize_bits(double value, double min, double range) noexcept
+{
+    // branchless, nan is mapped to 0
+    double q = std::min(4294967295.0, std::max(0.0, (value - min) / range * 4294967296.0));
+    return static_cast<uint32_t>(q);
+}
+
+/// @private interleaves the bits of x and y, x takes the odd bits and y the even bits
+inline uint64_t interleave_bits(uint32_t x, uint32_t y) noexcept
+{
+    return spread_bits(x) << 1 | spread_bits(y);
+}
+
+}  // namespace detail
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <simo/geom/detail/traits.hpp>
+#include <simo/algorithm/detail/primitives.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+// segments
+
+/// @private
+template <typename Points>
+void append_path_segments(const Points& points, bool closed, std::vector<segment>& res)
+{
+    size_t n = points.size();
+    if (n == 1)
+    {
+        res.push_back({points[0].x, points[0].y, points[0].x, points[0].y});
+        return;
+    }
+    for (size_t i = 1; i < n; ++i)
+    {
+        res.push_back({points[i - 1].x, points[i - 1].y, points[i].x, points[i].y});
+    }
+    if (closed and n > 2 and (points[0].x != points[n - 1].x or points[0].y != points[n - 1].y))
+    {
+        res.push_back({points[n - 1].x, points[n - 1].y, points[0].x, points[0].y});
+    }
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, point_tag)
+{
+    res.push_back({geom.x, geom.y, geom.x, geom.y});
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, multipoint_tag)
+{
+    for (const auto& p : geom)
+    {
+        res.push_back({p.x, p.y, p.x, p.y});
+    }
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, linestring_tag)
+{
+    append_path_segments(geom, false, res);
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, multilinestring_tag)
+{
+    for (const auto& ls : geom)
+    {
+        append_path_segments(ls, false, res);
+    }
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, polygon_tag)
+{
+    for (const auto& ring : geom)
+    {
+        append_path_segments(ring, true, res);
+    }
+}
+
+template <typename Geometry>
+void append_segments(const Geometry& geom, std::vector<segment>& res, multipolygon_tag)
+{
+    for (const auto& polygon : geom)
+    {
+        append_segments(polygon, res, polygon_tag{});
+    }
+}
+
+/*!
+ * @return the segments of the geometry, points are returned as degenerate segments
+ */
+template <typename Geometry>
+std::vector<segment> segments(const Geometry& geom)
+{
+    std::vector<segment> res;
+    append_segments(geom, res, typename geometry_traits<Geometry>::tag{});
+    return res;
+}
+
+// location
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, point_tag) noexcept
+{
+    return (geom.x == x and geom.y == y) ? location::INTERIOR : location::EXTERIOR;
+}
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, multipoint_tag) noexcept
+{
+    for (const auto& p : geom)
+    {
+        if (p.x == x and p.y == y)
+        {
+            return location::INTERIOR;
+        }
+    }
+    return location::EXTERIOR;
+}
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, linestring_tag) noexcept
+{
+    size_t n = geom.size();
+    if (n == 0)
+    {
+        return location::EXTERIOR;
+    }
+    bool closed = geom[0].x == geom[n - 1].x and geom[0].y == geom[n - 1].y;
+    if (not closed and ((geom[0].x == x and geom[0].y == y) or (geom[n - 1].x == x and geom[n - 1].y == y)))
+    {
+        return location::BOUNDARY;
+    }
+    if (n == 1)
+    {
+        return (geom[0].x == x and geom[0].y == y) ? location::INTERIOR : location::EXTERIOR;
+    }
+    for (size_t i = 1; i < n; ++i)
+    {
+        if (on_segment(x, y, geom[i - 1].x, geom[i - 1].y, geom[i].x, geom[i].y))
+        {
+            return location::INTERIOR;
+        }
+    }
+    return location::EXTERIOR;
+}
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, multilinestring_tag) noexcept
+{
+    auto res = location::EXTERIOR;
+    for (const auto& ls : geom)
+    {
+        auto loc = locate(x, y, ls, linestring_tag{});
+        if (loc == location::INTERIOR)
+        {
+            return loc;
+        }
+        if (loc == location::BOUNDARY)
+        {
+            res = loc;
+        }
+    }
+    return res;
+}
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, polygon_tag) noexcept
+{
+    return locate_in_polygon(x, y, geom);
+}
+
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom, multipolygon_tag) noexcept
+{
+    auto res = location::EXTERIOR;
+    for (const auto& polygon : geom)
+    {
+        auto loc = locate_in_polygon(x, y, polygon);
+        if (loc == location::INTERIOR)
+        {
+            return loc;
+        }
+        if (loc == location::BOUNDARY)
+        {
+            res = loc;
+        }
+    }
+    return res;
+}
+
+// dimension
+
+/// @private
+inline int topological_dimension(point_tag) noexcept
+{
+    return 0;
+}
+
+/// @private
+inline int topological_dimension(multipoint_tag) noexcept
+{
+    return 0;
+}
+
+/// @private
+inline int topological_dimension(linestring_tag) noexcept
+{
+    return 1;
+}
+
+/// @private
+inline int topological_dimension(multilinestring_tag) noexcept
+{
+    return 1;
+}
+
+/// @private
+inline int topological_dimension(polygon_tag) noexcept
+{
+    return 2;
+}
+
+/// @private
+inline int topological_dimension(multipolygon_tag) noexcept
+{
+    return 2;
+}
+
+// point runs
+
+/// @private calls f(points, n) for the point
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, point_tag, F& f)
+{
+    f(&geom, 1);
+}
+
+/// @private calls f(points, n) for every contiguous run of points of the geometry
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, multipoint_tag, F& f)
+{
+    if (not geom.empty())
+    {
+        f(&geom[0], geom.size());
+    }
+}
+
+/// @private
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, linestring_tag, F& f)
+{
+    if (not geom.empty())
+    {
+        f(&geom[0], geom.size());
+    }
+}
+
+/// @private
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, multilinestring_tag, F& f)
+{
+    for (auto& linestring : geom)
+    {
+        for_each_point_run(linestring, linestring_tag{}, f);
+    }
+}
+
+/// @private
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, polygon_tag, F& f)
+{
+    for (auto& ring : geom)
+    {
+        for_each_point_run(ring, linestring_tag{}, f);
+    }
+}
+
+/// @private
+template <typename Geometry, typename F>
+void for_each_point_run(Geometry& geom, multipolygon_tag, F& f)
+{
+    for (auto& polygon : geom)
+    {
+        for_each_point_run(polygon, polygon_tag{}, f);
+    }
+}
+
+}  // namespace detail
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief Location of a point with respect to a geometry
+ *
+ * @since 0.0.1
+ */
+enum class location : uint8_t
+{
+    INTERIOR = 0,
+    BOUNDARY = 1,
+    EXTERIOR = 2
+};
+
+namespace detail
+{
+
+/// a planar (x, y) segment
+struct segment
+{
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+};
+
+/*!
+ * @return twice the signed area of the triangle (a, b, c), positive if counter-clockwise
+ */
+inline double cross(double ax, double ay, double bx, double by, double cx, double cy) noexcept
+{
+    return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+}
+
+/*!
+ * @return the sign of the orientation of the triangle (a, b, c)
+ */
+inline int orientation(double ax, double ay, double bx, double by, double cx, double cy) noexcept
+{
+    double value = cross(ax, ay, bx, by, cx, cy);
+    return (value > 0) - (value < 0);
+}
+
+/*!
+ * @return true if p lies on the closed segment (a, b), otherwise false
+ */
+inline bool on_segment(double px, double py, double ax, double ay, double bx, double by) noexcept
+{
+    return orientation(ax, ay, bx, by, px, py) == 0 and
+           px >= std::min(ax, bx) and px <= std::max(ax, bx) and
+           py >= std::min(ay, by) and py <= std::max(ay, by);
+}
+
+/*!
+ * @return true if the closed segments s and t share at least one point, otherwise false
+ */
+inline bool segments_intersect(const segment& s, const segment& t) noexcept
+{
+    int o1 = orientation(s.x1, s.y1, s.x2, s.y2, t.x1, t.y1);
+    int o2 = orientation(s.x1, s.y1, s.x2, s.y2, t.x2, t.y2);
+    int o3 = orientation(t.x1, t.y1, t.x2, t.y2, s.x1, s.y1);
+    int o4 = orientation(t.x1, t.y1, t.x2, t.y2, s.x2, s.y2);
+    if (o1 * o2 < 0 and o3 * o4 < 0)
+    {
+        return true;
+    }
+    return (o1 == 0 and on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2)) or
+           (o2 == 0 and on_segment(t.x2, t.y2, s.x1, s.y1, s.x2, s.y2)) or
+           (o3 == 0 and on_segment(s.x1, s.y1, t.x1, t.y1, t.x2, t.y2)) or
+           (o4 == 0 and on_segment(s.x2, s.y2, t.x1, t.y1, t.x2, t.y2));
+}
+
+/*!
+ * @return the squared distance between the point p and the segment s
+ */
+inline double point_segment_distance2(double px, double py, const segment& s) noexcept
+{
+    double dx  = s.x2 - s.x1;
+    double dy  = s.y2 - s.y1;
+    double len = dx * dx + dy * dy;
+    double t   = len > 0 ? ((px - s.x1) * dx + (py - s.y1) * dy) / len : 0;
+    t          = std::max(0.0, std::min(1.0, t));
+    double ex  = s.x1 + t * dx - px;
+    double ey  = s.y1 + t * dy - py;
+    return ex * ex + ey * ey;
+}
+
+/*!
+ * @return the squared distance between the segments s and t
+ */
+inline double segment_distance2(const segment& s, const segment& t) noexcept
+{
+    if (segments_intersect(s, t))
+    {
+        return 0;
+    }
+    return std::min(std::min(point_segment_distance2(s.x1, s.y1, t), point_segment_distance2(s.x2, s.y2, t)),
+                    std::min(point_segment_distance2(t.x1, t.y1, s), point_segment_distance2(t.x2, t.y2, s)));
+}
+
+/*!
+ * @brief Appends the parameters in (0, 1) where the segment t touches the segment s
+ *
+ * @param s the segment to split
+ * @param t the other segment
+ * @param params the output parameters along s
+ */
+inline void split_params(const segment& s, const segment& t, std::vector<double>& params)
+{
+    double d1 = cross(t.x1, t.y1, t.x2, t.y2, s.x1, s.y1);
+    double d2 = cross(t.x1, t.y1, t.x2, t.y2, s.x2, s.y2);
+    double d3 = cross(s.x1, s.y1, s.x2, s.y2, t.x1, t.y1);
+    double d4 = cross(s.x1, s.y1, s.x2, s.y2, t.x2, t.y2);
+    if (((d1 > 0 and d2 < 0) or (d1 < 0 and d2 > 0)) and ((d3 > 0 and d4 < 0) or (d3 < 0 and d4 > 0)))
+    {
+        params.push_back(d1 / (d1 - d2));
+        return;
+    }
+    double dx  = s.x2 - s.x1;
+    double dy  = s.y2 - s.y1;
+    double len = dx * dx + dy * dy;
+    if (len == 0)
+    {
+        return;
+    }
+    // the endpoints of t lying on s, covers both touching and collinear overlaps
+    if (d3 == 0 and on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2))
+    {
+        params.push_back(((t.x1 - s.x1) * dx + (t.y1 - s.y1) * dy) / len);
+    }
+    if (d4 == 0 and on_segment(t.x2, t.y2, s.x1, s.y1, s.x2, s.y2))
+    {
+        params.push_back(((t.x2 - s.x1) * dx + (t.y2 - s.y1) * dy) / len);
+    }
+}
+
+/*!
+ * @brief Locates a point with respect to a ring using the crossing number rule
+ *
+ * @param x the x-coordinate of the point
+ * @param y the y-coordinate of the point
+ * @param ring the ring, it can be explicitly or implicitly closed
+ * @return the point location
+ */
+template <typename Ring>
+location locate_in_ring(double x, double y, const Ring& ring) noexcept
+{
+    size_t n = ring.size();
+    if (n == 0)
+    {
+        return location::EXTERIOR;
+    }
+    bool inside = false;
+    for (size_t i = 0, j = n - 1; i < n; j = i++)
+    {
+        const auto& a = ring[j];
+        const auto& b = ring[i];
+        if (on_segment(x, y, a.x, a.y, b.x, b.y))
+        {
+            return location::BOUNDARY;
+        }
+        if ((b.y > y) != (a.y > y) and x < (a.x - b.x) * (y - b.y) / (a.y - b.y) + b.x)
+        {
+            inside = not inside;
+        }
+    }
+    return inside ? location::INTERIOR : location::EXTERIOR;
+}
+
+/*!
+ * @brief Locates a point with respect to a polygon, the first ring is the shell and the rest are holes
+ */
+template <typename Polygon>
+location locate_in_polygon(double x, double y, const Polygon& polygon) noexcept
+{
+    if (polygon.empty())
+    {
+        return location::EXTERIOR;
+    }
+    auto res = locate_in_ring(x, y, polygon[0]);
+    if (res != location::INTERIOR)
+    {
+        return res;
+    }
+    for (size_t i = 1; i < polygon.size(); ++i)
+    {
+        auto hole = locate_in_ring(x, y, polygon[i]);
+        if (hole == location::BOUNDARY)
+        {
+            return location::BOUNDARY;
+        }
+        if (hole == location::INTERIOR)
+        {
+            return location::EXTERIOR;
+        }
+    }
+    return location::INTERIOR;
+}
+
+}  // namespace detail
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <vector>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/index/strtree.hpp>
+#include <simo/algorithm/detail/primitives.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// a run of consecutive segments monotone in x and y, the segments of a chain only touch their neighbors
+struct segment_chain
+{
+    /// the first segment
+    size_t first;
+
+    /// the past-the-end segment
+    size_t last;
+
+    /// the bounds of the chain, spanned by its endpoints
+    bounds_t bounds;
+};
+
+/// @private
+inline int sign(double value) noexcept
+{
+    return (value > 0) - (value < 0);
+}
+
+/*!
+ * @brief Finds the intersecting pairs of a set of segments with monotone chains
+ *
+ * The paths are cut in chains monotone in x and y, and the chains are packed in an STR
+ * tree. Every chain queries the tree for the chains after it, and the pairs of chains whose
+ * bounds overlap are halved until single segments remain. The search costs O(n log n) plus
+ * the number of overlapping bounds, close to O((n + k) log n) for k intersections unless
+ * long thin spikes pack into each other. An x sweep line over a list of active chains is
+ * quadratic as soon as many chains span the same x range, the tree is not.
+ */
+class segment_intersector
+{
+  public:
+    /*!
+     * @param segments the segments, consecutive segments of a path share their endpoints
+     * @param paths the first segment of every path followed by the number of segments
+     */
+    segment_intersector(const std::vector<segment>& segments, const std::vector<size_t>& paths)
+        : m_segments(segments)
+    {
+        for (size_t k = 0; k + 1 < paths.size(); ++k)
+        {
+            add_path(paths[k], paths[k + 1]);
+        }
+        if (m_chains.size() <= small_size)
+        {
+            return;
+        }
+        std::vector<bounds_t> bounds;
+        bounds.reserve(m_chains.size());
+        for (const auto& chain : m_chains)
+        {
+            bounds.push_back(chain.bounds);
+        }
+        m_tree = strtree(bounds.begin(), bounds.end());
+    }
+
+    /*!
+     * @brief Visits the intersecting pairs of segments from different chains
+     *
+     * @param f the visitor, called as f(i, j) with i < j, returns false to stop the traversal
+     * @return false if the traversal was stopped, otherwise true
+     */
+    template <typename F>
+    bool for_each(F f) const
+    {
+        if (m_chains.size() <= small_size)
+        {
+            // comparing every pair is faster than building a tree for a few chains
+            for (size_t c = 0; c < m_chains.size(); ++c)
+            {
+                for (size_t a = c + 1; a < m_chains.size(); ++a)
+                {
+                    const auto& chain = m_chains[c];
+                    const auto& other = m_chains[a];
+                    if (chain.bounds.intersects(other.bounds) and
+                        not overlaps(chain.first, chain.last, other.first, other.last, f))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        bool res = true;
+        for (size_t c = 0; c < m_chains.size() and res; ++c)
+        {
+            const auto& chain = m_chains[c];
+            m_tree.query(chain.bounds, [this, c, &chain, &f, &res](size_t a) {
+                // each pair of chains is visited once
+                if (res and a > c)
+                {
+                    const auto& other = m_chains[a];
+                    res               = overlaps(chain.first, chain.last, other.first, other.last, f);
+                }
+            });
+        }
+        return res;
+    }
+
+  private:
+    /// the number of chains below which every pair is compared
+    constexpr static const size_t small_size = 32;
+
+    /// @private
+    void add_path(size_t first, size_t last)
+    {
+        size_t lo = first;
+        int sx    = 0;
+        int sy    = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+            const auto& s = m_segments[i];
+            int dx        = sign(s.x2 - s.x1);
+            int dy        = sign(s.y2 - s.y1);
+            if (sx * dx < 0 or sy * dy < 0)
+            {
+                add_chain(lo, i);
+                lo = i;
+                sx = 0;
+                sy = 0;
+            }
+            sx = sx == 0 ? dx : sx;
+            sy = sy == 0 ? dy : sy;
+        }
+        if (lo < last)
+        {
+            add_chain(lo, last);
+        }
+    }
+
+    /// @private
+    void add_chain(size_t first, size_t last)
+    {
+        m_chains.push_back({first, last, range_bounds(first, last)});
+    }
+
+    /// @return the bounds of the segments [first, last) of a chain
+    bounds_t range_bounds(size_t first, size_t last) const noexcept
+    {
+        const auto& a = m_segments[first];
+        const auto& b = m_segments[last - 1];
+        return {std::min(a.x1, b.x2), std::min(a.y1, b.y2), std::max(a.x1, b.x2), std::max(a.y1, b.y2)};
+    }
+
+    /// @private
+    template <typename F>
+    bool overlaps(size_t a0, size_t a1, size_t b0, size_t b1, F& f) const
+    {
+        auto a = range_bounds(a0, a1);
+        auto b = range_bounds(b0, b1);
+        if (a.maxx < b.minx or b.maxx < a.minx or a.maxy < b.miny or b.maxy < a.miny)
+        {
+            return true;
+        }
+        if (a1 - a0 == 1 and b1 - b0 == 1)
+        {
+            if (not segments_intersect(m_segments[a0], m_segments[b0]))
+            {
+                return true;
+            }
+            return a0 < b0 ? f(a0, b0) : f(b0, a0);
+        }
+        // halves the longer range, the halves of a monotone chain are monotone too
+        if (a1 - a0 >= b1 - b0)
+        {
+            size_t mid = a0 + (a1 - a0) / 2;
+            return overlaps(a0, mid, b0, b1, f) and overlaps(mid, a1, b0, b1, f);
+        }
+        size_t mid = b0 + (b1 - b0) / 2;
+        return overlaps(a0, a1, b0, mid, f) and overlaps(a0, a1, mid, b1, f);
+    }
+
+    /// the segments
+    const std::vector<segment>& m_segments;
+
+    /// the monotone chains
+    std::vector<segment_chain> m_chains;
+
+    /// the index of the chain bounds
+    strtree m_tree;
+};
+
+}  // namespace detail
+}  // namespace shapes
+}  // namespace simo
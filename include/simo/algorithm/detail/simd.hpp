@@ -0,0 +1,599 @@
+#pragma once
+
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__)
+#    define SIMO_SHAPES_SIMD_AVX512 1
+#    include <immintrin.h>
+#elif defined(__AVX__)
+#    define SIMO_SHAPES_SIMD_AVX 1
+#    include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define SIMO_SHAPES_SIMD_SSE2 1
+#    include <emmintrin.h>
+#endif
+
+namespace simo
+{
+namespace shapes
+{
+
+// A minimal wrapper over the widest double precision vector the target supports, the width
+// is selected at compile time (AVX-512: 8 lanes, AVX: 4 lanes, SSE2: 2 lanes, otherwise 1 lane)
+// and the kernels are written once in terms of batch and batch_mask.
+namespace simd
+{
+
+#if defined(SIMO_SHAPES_SIMD_AVX512)
+
+/// the number of doubles per batch
+static const size_t width = 8;
+
+struct batch
+{
+    __m512d v;
+};
+
+struct batch_mask
+{
+    __mmask8 v;
+};
+
+inline batch load(const double* p) noexcept
+{
+    return {_mm512_loadu_pd(p)};
+}
+
+inline void store(double* p, batch a) noexcept
+{
+    _mm512_storeu_pd(p, a.v);
+}
+
+/// loads width interleaved (x, y) pairs, the lanes follow an order shared by every call
+inline void load_xy(const double* p, batch& x, batch& y) noexcept
+{
+    auto a = _mm512_loadu_pd(p);
+    auto b = _mm512_loadu_pd(p + 8);
+    x      = {_mm512_unpacklo_pd(a, b)};
+    y      = {_mm512_unpackhi_pd(a, b)};
+}
+
+/// stores width interleaved (x, y) pairs, in the lane order of load_xy
+inline void store_xy(double* p, batch x, batch y) noexcept
+{
+    _mm512_storeu_pd(p, _mm512_unpacklo_pd(x.v, y.v));
+    _mm512_storeu_pd(p + 8, _mm512_unpackhi_pd(x.v, y.v));
+}
+
+inline batch set1(double value) noexcept
+{
+    return {_mm512_set1_pd(value)};
+}
+
+inline batch operator+(batch a, batch b) noexcept
+{
+    return {_mm512_add_pd(a.v, b.v)};
+}
+
+inline batch operator-(batch a, batch b) noexcept
+{
+    return {_mm512_sub_pd(a.v, b.v)};
+}
+
+inline batch operator*(batch a, batch b) noexcept
+{
+    return {_mm512_mul_pd(a.v, b.v)};
+}
+
+inline batch operator/(batch a, batch b) noexcept
+{
+    return {_mm512_div_pd(a.v, b.v)};
+}
+
+inline batch min(batch a, batch b) noexcept
+{
+    return {_mm512_min_pd(a.v, b.v)};
+}
+
+inline batch max(batch a, batch b) noexcept
+{
+    return {_mm512_max_pd(a.v, b.v)};
+}
+
+inline batch sqrt(batch a) noexcept
+{
+    return {_mm512_sqrt_pd(a.v)};
+}
+
+/// rounds to the nearest integer, ties to even
+inline batch round(batch a) noexcept
+{
+    return {_mm512_roundscale_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+}
+
+inline batch_mask operator<(batch a, batch b) noexcept
+{
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)};
+}
+
+inline batch_mask operator<=(batch a, batch b) noexcept
+{
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ)};
+}
+
+inline batch_mask operator==(batch a, batch b) noexcept
+{
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline batch_mask operator&(batch_mask a, batch_mask b) noexcept
+{
+    return {static_cast<__mmask8>(a.v & b.v)};
+}
+
+inline batch_mask operator|(batch_mask a, batch_mask b) noexcept
+{
+    return {static_cast<__mmask8>(a.v | b.v)};
+}
+
+inline batch_mask operator^(batch_mask a, batch_mask b) noexcept
+{
+    return {static_cast<__mmask8>(a.v ^ b.v)};
+}
+
+inline batch_mask false_mask() noexcept
+{
+    return {0};
+}
+
+inline batch select(batch_mask m, batch a, batch b) noexcept
+{
+    return {_mm512_mask_blend_pd(m.v, b.v, a.v)};
+}
+
+/// returns the mask as a bit set, bit i is lane i
+inline uint32_t bits(batch_mask m) noexcept
+{
+    return m.v;
+}
+
+#elif defined(SIMO_SHAPES_SIMD_AVX)
+
+/// the number of doubles per batch
+static const size_t width = 4;
+
+struct batch
+{
+    __m256d v;
+};
+
+struct batch_mask
+{
+    __m256d v;
+};
+
+inline batch load(const double* p) noexcept
+{
+    return {_mm256_loadu_pd(p)};
+}
+
+inline void store(double* p, batch a) noexcept
+{
+    _mm256_storeu_pd(p, a.v);
+}
+
+/// loads width interleaved (x, y) pairs, the lanes follow an order shared by every call
+inline void load_xy(const double* p, batch& x, batch& y) noexcept
+{
+    auto a = _mm256_loadu_pd(p);
+    auto b = _mm256_loadu_pd(p + 4);
+    x      = {_mm256_unpacklo_pd(a, b)};
+    y      = {_mm256_unpackhi_pd(a, b)};
+}
+
+/// stores width interleaved (x, y) pairs, in the lane order of load_xy
+inline void store_xy(double* p, batch x, batch y) noexcept
+{
+    _mm256_storeu_pd(p, _mm256_unpacklo_pd(x.v, y.v));
+    _mm256_storeu_pd(p + 4, _mm256_unpackhi_pd(x.v, y.v));
+}
+
+inline batch set1(double value) noexcept
+{
+    return {_mm256_set1_pd(value)};
+}
+
+inline batch operator+(batch a, batch b) noexcept
+{
+    return {_mm256_add_pd(a.v, b.v)};
+}
+
+inline batch operator-(batch a, batch b) noexcept
+{
+    return {_mm256_sub_pd(a.v, b.v)};
+}
+
+inline batch operator*(batch a, batch b) noexcept
+{
+    return {_mm256_mul_pd(a.v, b.v)};
+}
+
+inline batch operator/(batch a, batch b) noexcept
+{
+    return {_mm256_div_pd(a.v, b.v)};
+}
+
+inline batch min(batch a, batch b) noexcept
+{
+    return {_mm256_min_pd(a.v, b.v)};
+}
+
+inline batch max(batch a, batch b) noexcept
+{
+    return {_mm256_max_pd(a.v, b.v)};
+}
+
+inline batch sqrt(batch a) noexcept
+{
+    return {_mm256_sqrt_pd(a.v)};
+}
+
+/// rounds to the nearest integer, ties to even
+inline batch round(batch a) noexcept
+{
+    return {_mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+}
+
+inline batch_mask operator<(batch a, batch b) noexcept
+{
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+}
+
+inline batch_mask operator<=(batch a, batch b) noexcept
+{
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)};
+}
+
+inline batch_mask operator==(batch a, batch b) noexcept
+{
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline batch_mask operator&(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm256_and_pd(a.v, b.v)};
+}
+
+inline batch_mask operator|(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm256_or_pd(a.v, b.v)};
+}
+
+inline batch_mask operator^(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm256_xor_pd(a.v, b.v)};
+}
+
+inline batch_mask false_mask() noexcept
+{
+    return {_mm256_setzero_pd()};
+}
+
+inline batch select(batch_mask m, batch a, batch b) noexcept
+{
+    return {_mm256_blendv_pd(b.v, a.v, m.v)};
+}
+
+/// returns the mask as a bit set, bit i is lane i
+inline uint32_t bits(batch_mask m) noexcept
+{
+    return static_cast<uint32_t>(_mm256_movemask_pd(m.v));
+}
+
+#elif defined(SIMO_SHAPES_SIMD_SSE2)
+
+/// the number of doubles per batch
+static const size_t width = 2;
+
+struct batch
+{
+    __m128d v;
+};
+
+struct batch_mask
+{
+    __m128d v;
+};
+
+inline batch load(const double* p) noexcept
+{
+    return {_mm_loadu_pd(p)};
+}
+
+inline void store(double* p, batch a) noexcept
+{
+    _mm_storeu_pd(p, a.v);
+}
+
+/// loads width interleaved (x, y) pairs, the lanes follow an order shared by every call
+inline void load_xy(const double* p, batch& x, batch& y) noexcept
+{
+    auto a = _mm_loadu_pd(p);
+    auto b = _mm_loadu_pd(p + 2);
+    x      = {_mm_unpacklo_pd(a, b)};
+    y      = {_mm_unpackhi_pd(a, b)};
+}
+
+/// stores width interleaved (x, y) pairs, in the lane order of load_xy
+inline void store_xy(double* p, batch x, batch y) noexcept
+{
+    _mm_storeu_pd(p, _mm_unpacklo_pd(x.v, y.v));
+    _mm_storeu_pd(p + 2, _mm_unpackhi_pd(x.v, y.v));
+}
+
+inline batch set1(double value) noexcept
+{
+    return {_mm_set1_pd(value)};
+}
+
+inline batch operator+(batch a, batch b) noexcept
+{
+    return {_mm_add_pd(a.v, b.v)};
+}
+
+inline batch operator-(batch a, batch b) noexcept
+{
+    return {_mm_sub_pd(a.v, b.v)};
+}
+
+inline batch operator*(batch a, batch b) noexcept
+{
+    return {_mm_mul_pd(a.v, b.v)};
+}
+
+inline batch operator/(batch a, batch b) noexcept
+{
+    return {_mm_div_pd(a.v, b.v)};
+}
+
+inline batch min(batch a, batch b) noexcept
+{
+    return {_mm_min_pd(a.v, b.v)};
+}
+
+inline batch max(batch a, batch b) noexcept
+{
+    return {_mm_max_pd(a.v, b.v)};
+}
+
+inline batch sqrt(batch a) noexcept
+{
+    return {_mm_sqrt_pd(a.v)};
+}
+
+/// rounds to the nearest integer, ties to even, exact for |a| < 2^51
+inline batch round(batch a) noexcept
+{
+    // SSE2 has no rounding instruction, adding 1.5 * 2^52 drops the fractional bits
+    auto magic = _mm_set1_pd(6755399441055744.0);
+    return {_mm_sub_pd(_mm_add_pd(a.v, magic), magic)};
+}
+
+inline batch_mask operator<(batch a, batch b) noexcept
+{
+    return {_mm_cmplt_pd(a.v, b.v)};
+}
+
+inline batch_mask operator<=(batch a, batch b) noexcept
+{
+    return {_mm_cmple_pd(a.v, b.v)};
+}
+
+inline batch_mask operator==(batch a, batch b) noexcept
+{
+    return {_mm_cmpeq_pd(a.v, b.v)};
+}
+
+inline batch_mask operator&(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm_and_pd(a.v, b.v)};
+}
+
+inline batch_mask operator|(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm_or_pd(a.v, b.v)};
+}
+
+inline batch_mask operator^(batch_mask a, batch_mask b) noexcept
+{
+    return {_mm_xor_pd(a.v, b.v)};
+}
+
+inline batch_mask false_mask() noexcept
+{
+    return {_mm_setzero_pd()};
+}
+
+inline batch select(batch_mask m, batch a, batch b) noexcept
+{
+    return {_mm_or_pd(_mm_and_pd(m.v, a.v), _mm_andnot_pd(m.v, b.v))};
+}
+
+/// returns the mask as a bit set, bit i is lane i
+inline uint32_t bits(batch_mask m) noexcept
+{
+    return static_cast<uint32_t>(_mm_movemask_pd(m.v));
+}
+
+#else
+
+/// the number of doubles per batch
+static const size_t width = 1;
+
+struct batch
+{
+    double v;
+};
+
+struct batch_mask
+{
+    bool v;
+};
+
+inline batch load(const double* p) noexcept
+{
+    return {*p};
+}
+
+inline void store(double* p, batch a) noexcept
+{
+    *p = a.v;
+}
+
+/// loads width interleaved (x, y) pairs, the lanes follow an order shared by every call
+inline void load_xy(const double* p, batch& x, batch& y) noexcept
+{
+    x = {p[0]};
+    y = {p[1]};
+}
+
+/// stores width interleaved (x, y) pairs, in the lane order of load_xy
+inline void store_xy(double* p, batch x, batch y) noexcept
+{
+    p[0] = x.v;
+    p[1] = y.v;
+}
+
+inline batch set1(double value) noexcept
+{
+    return {value};
+}
+
+inline batch operator+(batch a, batch b) noexcept
+{
+    return {a.v + b.v};
+}
+
+inline batch operator-(batch a, batch b) noexcept
+{
+    return {a.v - b.v};
+}
+
+inline batch operator*(batch a, batch b) noexcept
+{
+    return {a.v * b.v};
+}
+
+inline batch operator/(batch a, batch b) noexcept
+{
+    return {a.v / b.v};
+}
+
+inline batch min(batch a, batch b) noexcept
+{
+    return {b.v < a.v ? b.v : a.v};
+}
+
+inline batch max(batch a, batch b) noexcept
+{
+    return {a.v < b.v ? b.v : a.v};
+}
+
+inline batch sqrt(batch a) noexcept
+{
+    return {std::sqrt(a.v)};
+}
+
+/// rounds to the nearest integer, ties to even
+inline batch round(batch a) noexcept
+{
+    return {std::nearbyint(a.v)};
+}
+
+inline batch_mask operator<(batch a, batch b) noexcept
+{
+    return {a.v < b.v};
+}
+
+inline batch_mask operator<=(batch a, batch b) noexcept
+{
+    return {a.v <= b.v};
+}
+
+inline batch_mask operator==(batch a, batch b) noexcept
+{
+    return {a.v == b.v};
+}
+
+inline batch_mask operator&(batch_mask a, batch_mask b) noexcept
+{
+    return {a.v and b.v};
+}
+
+inline batch_mask operator|(batch_mask a, batch_mask b) noexcept
+{
+    return {a.v or b.v};
+}
+
+inline batch_mask operator^(batch_mask a, batch_mask b) noexcept
+{
+    return {a.v != b.v};
+}
+
+inline batch_mask false_mask() noexcept
+{
+    return {false};
+}
+
+inline batch select(batch_mask m, batch a, batch b) noexcept
+{
+    return m.v ? a : b;
+}
+
+/// returns the mask as a bit set, bit i is lane i
+inline uint32_t bits(batch_mask m) noexcept
+{
+    return m.v ? 1u : 0u;
+}
+
+#endif
+
+inline batch_mask operator>(batch a, batch b) noexcept
+{
+    return b < a;
+}
+
+inline batch_mask operator>=(batch a, batch b) noexcept
+{
+    return b <= a;
+}
+
+inline batch operator-(batch a) noexcept
+{
+    return set1(0) - a;
+}
+
+inline batch abs(batch a) noexcept
+{
+    return max(a, -a);
+}
+
+/// returns the sum of the lanes
+inline double reduce_add(batch a) noexcept
+{
+    double lanes[width];
+    store(lanes, a);
+    double res = 0;
+    for (size_t i = 0; i < width; ++i)
+    {
+        res += lanes[i];
+    }
+    return res;
+}
+
+}  // namespace simd
+}  // namespace shapes
+}  // namespace simo
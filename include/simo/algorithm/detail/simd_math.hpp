@@ -0,0 +1,216 @@
+#pragma once
+
+#include <ciso646>
+#include <simo/algorithm/detail/simd.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace simd
+{
+
+// Polynomial approximations of the trigonometric functions, evaluated the same way for every
+// lane. The coefficients are the Taylor series truncated where the error falls below 1e-15.
+
+/// @private
+inline batch sin_kernel(batch x) noexcept
+{
+    // sin(x) for |x| <= pi/2, through x^19, absolute error below 5e-16
+    static const double coeffs[] = {-8.2206352466243295e-18, 2.8114572543455206e-15, -7.6471637318198164e-13,
+                                    1.6059043836821613e-10,  -2.505210838544172e-08,  2.7557319223985893e-06,
+                                    -0.00019841269841269841, 0.0083333333333333332,   -0.16666666666666666,
+                                    1.0};
+    auto x2 = x * x;
+    auto p  = set1(coeffs[0]);
+    for (size_t i = 1; i < sizeof(coeffs) / sizeof(coeffs[0]); ++i)
+    {
+        p = p * x2 + set1(coeffs[i]);
+    }
+    return p * x;
+}
+
+/// @private
+inline batch asin_kernel(batch x) noexcept
+{
+    // asin(x) for 0 <= x <= 0.5, through x^43, relative error below 5e-16
+    static const double coeffs[] = {
+        0.0028461784011089421, 0.0030578216492580306, 0.0032970595034734849, 0.0035692053938259347,
+        0.0038809645588376691, 0.0042409070936793632, 0.0046601434869150962, 0.0051533096823199046,
+        0.0057400376708419236, 0.0064472103118896487, 0.0073125258735988454, 0.0083903358096168151,
+        0.0097616095291940784, 0.011551800896139705,  0.013964843750000001,  0.017352764423076924,
+        0.022372159090909092,  0.030381944444444444,  0.044642857142857144,  0.074999999999999997,
+        0.16666666666666666,   1.0};
+    auto x2 = x * x;
+    auto p  = set1(coeffs[0]);
+    for (size_t i = 1; i < sizeof(coeffs) / sizeof(coeffs[0]); ++i)
+    {
+        p = p * x2 + set1(coeffs[i]);
+    }
+    return p * x;
+}
+
+/// @private
+inline batch reduce_pi(batch x, batch k) noexcept
+{
+    // pi split in three parts whose products with k are exact (Cody-Waite)
+    return ((x - k * set1(3.141592651605606)) - k * set1(1.9841871479187034e-09)) - k * set1(1.1442377452219664e-17);
+}
+
+/*!
+ * @brief Computes the sine of every lane
+ *
+ * @param x the angles in radians, the reduction is accurate for |x| < 2^20
+ * @return the sines, absolute error below 1e-15
+ */
+inline batch sin(batch x) noexcept
+{
+    // x = k * pi + r with |r| <= pi/2, sin(x) = (-1)^k sin(r)
+    auto k   = round(x * set1(0.31830988618379067));
+    auto r   = reduce_pi(x, k);
+    auto odd = abs(k - set1(2) * round(k * set1(0.5))) == set1(1);
+    auto res = sin_kernel(r);
+    return select(odd, -res, res);
+}
+
+/*!
+ * @brief Computes the cosine of every lane
+ *
+ * @param x the angles in radians, the reduction is accurate for |x| < 2^20
+ * @return the cosines, absolute error below 1e-15
+ */
+inline batch cos(batch x) noexcept
+{
+    // x = k * pi + r with |r| <= pi/2, cos(x) = (-1)^k sin(pi/2 - |r|)
+    auto k   = round(x * set1(0.31830988618379067));
+    auto r   = reduce_pi(x, k);
+    auto odd = abs(k - set1(2) * round(k * set1(0.5))) == set1(1);
+    auto res = sin_kernel(set1(1.5707963267948966) - abs(r));
+    return select(odd, -res, res);
+}
+
+/*!
+ * @brief Computes the arc sine of every lane
+ *
+ * @param x the values in [-1, 1]
+ * @return the arc sines in [-pi/2, pi/2], relative error below 1e-15
+ */
+inline batch asin(batch x) noexcept
+{
+    // asin(h) = pi/2 - 2 asin(sqrt((1 - h) / 2)) brings h > 0.5 back to [0, 0.5]
+    auto h     = abs(x);
+    auto large = h > set1(0.5);
+    auto z     = select(large, sqrt((set1(1) - h) * set1(0.5)), h);
+    auto p     = asin_kernel(z);
+    auto res   = select(large, set1(1.5707963267948966) - set1(2) * p, p);
+    return select(x < set1(0), -res, res);
+}
+
+/// @private
+inline batch exp_kernel(batch x) noexcept
+{
+    // exp(x) for |x| <= 0.5, through x^14, relative error below 5e-17
+    static const double coeffs[] = {1.1470745597729725e-11, 1.6059043836821613e-10, 2.08767569878681e-09,
+                                    2.505210838544172e-08,  2.755731922398589e-07,  2.7557319223985893e-06,
+                                    2.48015873015873e-05,   0.0001984126984126984,  0.001388888888888889,
+                                    0.008333333333333333,   0.041666666666666664,   0.16666666666666666,
+                                    0.5,                    1.0,                    1.0};
+    auto p = set1(coeffs[0]);
+    for (size_t i = 1; i < sizeof(coeffs) / sizeof(coeffs[0]); ++i)
+    {
+        p = p * x + set1(coeffs[i]);
+    }
+    return p;
+}
+
+/// @private
+inline batch atan_kernel(batch x) noexcept
+{
+    // atan(x) for |x| <= tan(pi/16), through x^23, absolute error below 1e-17
+    static const double coeffs[] = {-0.043478260869565216, 0.047619047619047616, -0.05263157894736842,
+                                    0.058823529411764705,  -0.06666666666666667, 0.07692307692307693,
+                                    -0.09090909090909091,  0.1111111111111111,   -0.14285714285714285,
+                                    0.2,                   -0.3333333333333333,  1.0};
+    auto x2 = x * x;
+    auto p  = set1(coeffs[0]);
+    for (size_t i = 1; i < sizeof(coeffs) / sizeof(coeffs[0]); ++i)
+    {
+        p = p * x2 + set1(coeffs[i]);
+    }
+    return p * x;
+}
+
+/// @private
+inline batch atanh_kernel(batch x) noexcept
+{
+    // atanh(x) for |x| <= 0.1, through x^17, absolute error below 1e-19
+    static const double coeffs[] = {0.058823529411764705, 0.06666666666666667, 0.07692307692307693,
+                                    0.09090909090909091,  0.1111111111111111,  0.14285714285714285,
+                                    0.2,                  0.3333333333333333,  1.0};
+    auto x2 = x * x;
+    auto p  = set1(coeffs[0]);
+    for (size_t i = 1; i < sizeof(coeffs) / sizeof(coeffs[0]); ++i)
+    {
+        p = p * x2 + set1(coeffs[i]);
+    }
+    return p * x;
+}
+
+/*!
+ * @brief Computes the exponential of every lane
+ *
+ * @param x the values, |x| <= 8
+ * @return the exponentials, relative error below 4e-15
+ */
+inline batch exp(batch x) noexcept
+{
+    // exp(x) = exp(x / 16)^16, the squarings multiply the relative error by 16
+    auto res = exp_kernel(x * set1(0.0625));
+    res      = res * res;
+    res      = res * res;
+    res      = res * res;
+    return res * res;
+}
+
+/*!
+ * @brief Computes the arc tangent of every lane
+ *
+ * @param x the values
+ * @return the arc tangents in [-pi/2, pi/2], absolute error below 1e-15
+ */
+inline batch atan(batch x) noexcept
+{
+    // atan(a) = pi/2 - atan(1/a) brings a > 1 back to [0, 1], then two
+    // halvings atan(a) = 2 atan(a / (1 + sqrt(1 + a^2))) bring it to [0, tan(pi/16)]
+    auto one    = set1(1);
+    auto a      = abs(x);
+    auto invert = a > one;
+    auto z      = select(invert, one / a, a);
+    z           = z / (one + sqrt(one + z * z));
+    z           = z / (one + sqrt(one + z * z));
+    auto p      = set1(4) * atan_kernel(z);
+    auto res    = select(invert, set1(1.5707963267948966) - p, p);
+    return select(x < set1(0), -res, res);
+}
+
+/*!
+ * @brief Computes the inverse hyperbolic tangent of every lane
+ *
+ * @param x the values, |x| <= 0.999
+ * @return the inverse hyperbolic tangents, absolute error below 5e-14
+ */
+inline batch atanh(batch x) noexcept
+{
+    // five halvings atanh(a) = 2 atanh(a / (1 + sqrt(1 - a^2))) bring |a| <= 0.999 to [0, 0.1]
+    auto one = set1(1);
+    auto z   = x;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        z = z / (one + sqrt((one - z) * (one + z)));
+    }
+    return set1(32) * atanh_kernel(z);
+}
+
+}  // namespace simd
+}  // namespace shapes
+}  // namespace simo
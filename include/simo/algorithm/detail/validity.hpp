@@ -0,0 +1,386 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/geom/detail/geometry.hpp>
+#include <simo/algorithm/detail/primitives.hpp>
+#include <simo/algorithm/detail/segment_intersector.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// the segments of the rings of a polygon, repeated points are skipped
+struct ring_segments
+{
+    /// the segments of every ring
+    std::vector<segment> segments;
+
+    /// the first segment of every ring followed by the number of segments
+    std::vector<size_t> rings;
+
+    /// @return the ring of the segment i
+    size_t ring_of(size_t i) const noexcept
+    {
+        return static_cast<size_t>(std::upper_bound(rings.begin(), rings.end(), i) - rings.begin()) - 1;
+    }
+
+    /// @return the segment before i in its ring
+    size_t prev(size_t i) const noexcept
+    {
+        size_t r = ring_of(i);
+        return i == rings[r] ? rings[r + 1] - 1 : i - 1;
+    }
+
+    /// @return the segment after i in its ring
+    size_t next(size_t i) const noexcept
+    {
+        size_t r = ring_of(i);
+        return i + 1 == rings[r + 1] ? rings[r] : i + 1;
+    }
+};
+
+/// @private
+inline bool same_point(double ax, double ay, double bx, double by) noexcept
+{
+    return ax == bx and ay == by;
+}
+
+/// @return true if the collinear segments s and t share more than one point, otherwise false
+inline bool collinear_overlap(const segment& s, const segment& t) noexcept
+{
+    // the overlap is measured along the dominant axis of s
+    bool use_x = std::abs(s.x2 - s.x1) >= std::abs(s.y2 - s.y1);
+    double s1  = use_x ? s.x1 : s.y1;
+    double s2  = use_x ? s.x2 : s.y2;
+    double t1  = use_x ? t.x1 : t.y1;
+    double t2  = use_x ? t.x2 : t.y2;
+    return std::min(std::max(s1, s2), std::max(t1, t2)) > std::max(std::min(s1, s2), std::min(t1, t2));
+}
+
+/// @return the angle of the direction from (x, y) to (px, py)
+inline double direction(double x, double y, double px, double py) noexcept
+{
+    return std::atan2(py - y, px - x);
+}
+
+/// @return true if the angle c lies strictly inside the counter-clockwise sweep from a to b
+inline bool angle_between(double a, double b, double c) noexcept
+{
+    const double pi = 3.14159265358979323846;
+    auto ccw        = [pi](double from, double to) {
+        double d = to - from;
+        return d < 0 ? d + 2 * pi : d;
+    };
+    double dc = ccw(a, c);
+    return dc > 0 and dc < ccw(a, b);
+}
+
+/*!
+ * @brief Checks whether two rings touching at a point cross each other there
+ *
+ * @param rs the ring segments
+ * @param i a segment of the first ring
+ * @param j a segment of the second ring, it touches i
+ * @param x set to the x-coordinate of the touching point
+ * @param y set to the y-coordinate of the touching point
+ * @return true if the rings cross, otherwise false
+ */
+inline bool rings_cross_at(const ring_segments& rs, size_t i, size_t j, double& x, double& y) noexcept
+{
+    const auto& s = rs.segments[i];
+    const auto& t = rs.segments[j];
+    // the touching point and the two far endpoints of each ring around it
+    bool s_start = on_segment(s.x1, s.y1, t.x1, t.y1, t.x2, t.y2);
+    bool s_end   = not s_start and on_segment(s.x2, s.y2, t.x1, t.y1, t.x2, t.y2);
+    bool t_start = on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2);
+    if (not s_start and not s_end)
+    {
+        // a vertex of the second ring lies on the first one
+        x = t_start ? t.x1 : t.x2;
+        y = t_start ? t.y1 : t.y2;
+    }
+    else
+    {
+        x = s_start ? s.x1 : s.x2;
+        y = s_start ? s.y1 : s.y2;
+    }
+
+    auto far_points = [&rs, x, y](size_t k, double res[4]) {
+        const auto& a = rs.segments[k];
+        const auto& b = same_point(a.x1, a.y1, x, y) ? rs.segments[rs.prev(k)] : rs.segments[rs.next(k)];
+        bool at_start = same_point(a.x1, a.y1, x, y);
+        res[0]        = at_start ? b.x1 : b.x2;
+        res[1]        = at_start ? b.y1 : b.y2;
+        res[2]        = at_start ? a.x2 : a.x1;
+        res[3]        = at_start ? a.y2 : a.y1;
+    };
+
+    bool s_vertex = same_point(s.x1, s.y1, x, y) or same_point(s.x2, s.y2, x, y);
+    bool t_vertex = same_point(t.x1, t.y1, x, y) or same_point(t.x2, t.y2, x, y);
+    if (s_vertex and t_vertex)
+    {
+        // the second ring crosses if its edges lie on both sides of the wedge of the first one
+        double a[4];
+        double b[4];
+        far_points(i, a);
+        far_points(j, b);
+        double a1 = direction(x, y, a[0], a[1]);
+        double a2 = direction(x, y, a[2], a[3]);
+        double b1 = direction(x, y, b[0], b[1]);
+        double b2 = direction(x, y, b[2], b[3]);
+        if (b1 == a1 or b1 == a2 or b2 == a1 or b2 == a2)
+        {
+            return false;
+        }
+        return angle_between(a1, a2, b1) != angle_between(a1, a2, b2);
+    }
+    // a vertex touches the interior of the other segment, its edges must stay on one side
+    size_t k             = s_vertex ? i : j;
+    const auto& straight = s_vertex ? t : s;
+    double p[4];
+    far_points(k, p);
+    int o1 = orientation(straight.x1, straight.y1, straight.x2, straight.y2, p[0], p[1]);
+    int o2 = orientation(straight.x1, straight.y1, straight.x2, straight.y2, p[2], p[3]);
+    return o1 * o2 < 0;
+}
+
+/*!
+ * @brief Collects the segments of the rings of a polygon and checks their size and closure
+ *
+ * @param polygon the polygon
+ * @param res the ring segments
+ * @return the first ring that is not closed or has too few points
+ */
+template <typename Polygon>
+validity_report polygon_segments(const Polygon& polygon, ring_segments& res)
+{
+    res.rings.assign(1, 0);
+    for (const auto& ring : polygon)
+    {
+        size_t n = ring.size();
+        if (n == 0)
+        {
+            res.rings.push_back(res.segments.size());
+            continue;
+        }
+        if (n < 4)
+        {
+            return {validity_code::TOO_FEW_POINTS, "Polygon ring should be either empty or with 4 or more points"};
+        }
+        if (not same_point(ring[0].x, ring[0].y, ring[n - 1].x, ring[n - 1].y))
+        {
+            return {validity_code::RING_NOT_CLOSED, "Polygon ring should be closed"};
+        }
+        size_t first = res.segments.size();
+        size_t prev  = 0;
+        for (size_t k = 1; k < n; ++k)
+        {
+            if (not same_point(ring[prev].x, ring[prev].y, ring[k].x, ring[k].y))
+            {
+                res.segments.push_back({static_cast<double>(ring[prev].x), static_cast<double>(ring[prev].y),
+                                        static_cast<double>(ring[k].x), static_cast<double>(ring[k].y)});
+                prev = k;
+            }
+        }
+        if (res.segments.size() - first < 3)
+        {
+            return {validity_code::TOO_FEW_POINTS, "Polygon ring with less than 3 distinct points",
+                    static_cast<double>(ring[0].x), static_cast<double>(ring[0].y)};
+        }
+        res.rings.push_back(res.segments.size());
+    }
+    return {};
+}
+
+/*!
+ * @brief Checks that the rings of a polygon do not self-intersect nor cross each other
+ *
+ * Rings may touch each other at isolated points. The intersecting segments are found with
+ * the segment_intersector.
+ *
+ * @param rs the ring segments
+ * @return the first pair of segments intersecting improperly
+ */
+inline validity_report check_intersections(const ring_segments& rs)
+{
+    validity_report res;
+    segment_intersector intersector(rs.segments, rs.rings);
+    intersector.for_each([&rs, &res](size_t i, size_t j) {
+        const auto& s = rs.segments[i];
+        const auto& t = rs.segments[j];
+        size_t ri     = rs.ring_of(i);
+        size_t rj     = rs.ring_of(j);
+        double x      = s.x2;
+        double y      = s.y2;
+        if (ri == rj)
+        {
+            // consecutive segments only share their common vertex, otherwise the ring has a spike
+            if (j == i + 1)
+            {
+                if (not on_segment(t.x2, t.y2, s.x1, s.y1, s.x2, s.y2) and not on_segment(s.x1, s.y1, t.x1, t.y1, t.x2, t.y2))
+                {
+                    return true;
+                }
+            }
+            else if (i == rs.rings[ri] and j + 1 == rs.rings[ri + 1])
+            {
+                x = s.x1;
+                y = s.y1;
+                if (not on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2) and not on_segment(s.x2, s.y2, t.x1, t.y1, t.x2, t.y2))
+                {
+                    return true;
+                }
+            }
+            else
+            {
+                std::vector<double> params;
+                split_params(s, t, params);
+                if (not params.empty())
+                {
+                    x = s.x1 + params[0] * (s.x2 - s.x1);
+                    y = s.y1 + params[0] * (s.y2 - s.y1);
+                }
+            }
+            res = {validity_code::SELF_INTERSECTION, "Polygon ring self-intersection", x, y};
+            return false;
+        }
+
+        int o1 = orientation(s.x1, s.y1, s.x2, s.y2, t.x1, t.y1);
+        int o2 = orientation(s.x1, s.y1, s.x2, s.y2, t.x2, t.y2);
+        int o3 = orientation(t.x1, t.y1, t.x2, t.y2, s.x1, s.y1);
+        int o4 = orientation(t.x1, t.y1, t.x2, t.y2, s.x2, s.y2);
+        if (o1 * o2 < 0 and o3 * o4 < 0)
+        {
+            std::vector<double> params;
+            split_params(s, t, params);
+            x = s.x1 + params[0] * (s.x2 - s.x1);
+            y = s.y1 + params[0] * (s.y2 - s.y1);
+        }
+        else if (o1 == 0 and o2 == 0)
+        {
+            if (not collinear_overlap(s, t))
+            {
+                return true;
+            }
+            x = on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2) ? t.x1 : s.x1;
+            y = on_segment(t.x1, t.y1, s.x1, s.y1, s.x2, s.y2) ? t.y1 : s.y1;
+        }
+        else if (not rings_cross_at(rs, i, j, x, y))
+        {
+            return true;
+        }
+        res = {validity_code::RING_CROSSING, "Polygon rings cross", x, y};
+        return false;
+    });
+    return res;
+}
+
+/*!
+ * @brief Locates a ring with respect to another one, rings that do not cross
+ *
+ * @return the location of the first vertex of a that does not lie on b, BOUNDARY if there is none
+ */
+template <typename Ring>
+location locate_ring(const Ring& a, const Ring& b) noexcept
+{
+    for (const auto& p : a)
+    {
+        auto res = locate_in_ring(static_cast<double>(p.x), static_cast<double>(p.y), b);
+        if (res != location::BOUNDARY)
+        {
+            return res;
+        }
+    }
+    return location::BOUNDARY;
+}
+
+/*!
+ * @brief Checks that the holes lie inside the shell and outside each other
+ *
+ * @param polygon the polygon, its rings do not cross
+ * @return the first hole outside the shell or inside another hole
+ */
+template <typename Polygon>
+validity_report check_holes(const Polygon& polygon)
+{
+    if (polygon.size() < 2)
+    {
+        return {};
+    }
+    const auto& shell = polygon[0];
+    std::vector<bounds_t> bounds;
+    for (const auto& ring : polygon)
+    {
+        bounds_t b;
+        for (const auto& p : ring)
+        {
+            b.extend(static_cast<double>(p.x), static_cast<double>(p.y));
+        }
+        bounds.push_back(b);
+    }
+    for (size_t i = 1; i < polygon.size(); ++i)
+    {
+        const auto& hole = polygon[i];
+        if (hole.empty())
+        {
+            continue;
+        }
+        if (shell.empty() or locate_ring(hole, shell) == location::EXTERIOR)
+        {
+            return {validity_code::HOLE_OUTSIDE_SHELL, "Polygon hole lies outside the shell", static_cast<double>(hole[0].x),
+                    static_cast<double>(hole[0].y)};
+        }
+        for (size_t j = 1; j < polygon.size(); ++j)
+        {
+            const auto& a = bounds[i];
+            const auto& b = bounds[j];
+            if (i == j or polygon[j].empty() or a.minx < b.minx or a.miny < b.miny or a.maxx > b.maxx or a.maxy > b.maxy)
+            {
+                continue;
+            }
+            if (locate_ring(hole, polygon[j]) == location::INTERIOR)
+            {
+                return {validity_code::NESTED_HOLES, "Polygon hole lies inside another hole", static_cast<double>(hole[0].x),
+                        static_cast<double>(hole[0].y)};
+            }
+        }
+    }
+    return {};
+}
+
+/*!
+ * @brief Checks the validity of a polygon
+ *
+ * The rings must be closed and have at least 4 points, they cannot self-intersect and can
+ * only touch each other at isolated points. The holes lie inside the shell and outside
+ * each other.
+ *
+ * @param polygon the polygon
+ * @return the first error found
+ */
+template <typename Polygon>
+validity_report validate_polygon(const Polygon& polygon)
+{
+    ring_segments rs;
+    auto res = polygon_segments(polygon, rs);
+    if (res.valid())
+    {
+        res = check_intersections(rs);
+    }
+    if (res.valid())
+    {
+        res = check_holes(polygon);
+    }
+    return res;
+}
+
+}  // namespace detail
+}  // namespace shapes
+}  // namespace simo
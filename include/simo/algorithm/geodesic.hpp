@@ -0,0 +1,347 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <simo/algorithm/measures.hpp>
+#include <simo/algorithm/detail/simd_math.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace geodesic
+{
+
+/// the mean radius of the Earth in meters (IUGG)
+constexpr static const double EARTH_RADIUS = 6371008.8;
+
+/// the semi-major axis of the WGS 84 ellipsoid in meters
+constexpr static const double WGS84_A = 6378137.0;
+
+/// the flattening of the WGS 84 ellipsoid
+constexpr static const double WGS84_F = 1 / 298.257223563;
+
+/// the number of radians per degree
+constexpr static const double RADIANS = 0.017453292519943295;
+
+/*!
+ * @brief The model of the Earth used by the distance functions
+ *
+ * @since 0.0.1
+ */
+enum class method : uint8_t
+{
+    /// great-circle distance on a sphere of radius EARTH_RADIUS, error up to 0.5%
+    HAVERSINE = 0,
+    /// geodesic distance on the WGS 84 ellipsoid, error below 1 mm
+    VINCENTY = 1
+};
+
+/*!
+ * @brief Computes the great-circle distance between two points with the haversine formula
+ *
+ * @param lng1 the longitude of the first point in degrees
+ * @param lat1 the latitude of the first point in degrees
+ * @param lng2 the longitude of the second point in degrees
+ * @param lat2 the latitude of the second point in degrees
+ * @param radius the radius of the sphere
+ * @return the distance in the unit of the radius, meters by default
+ *
+ * @since 0.0.1
+ */
+inline double haversine(double lng1, double lat1, double lng2, double lat2, double radius = EARTH_RADIUS) noexcept
+{
+    double s1 = std::sin((lat2 - lat1) * RADIANS / 2);
+    double s2 = std::sin((lng2 - lng1) * RADIANS / 2);
+    double a  = s1 * s1 + std::cos(lat1 * RADIANS) * std::cos(lat2 * RADIANS) * s2 * s2;
+    return 2 * radius * std::asin(std::min(1.0, std::sqrt(a)));
+}
+
+/*!
+ * @brief Computes the geodesic distance between two points on the WGS 84 ellipsoid with Vincenty's inverse formula
+ *
+ * @param lng1 the longitude of the first point in degrees
+ * @param lat1 the latitude of the first point in degrees
+ * @param lng2 the longitude of the second point in degrees
+ * @param lat2 the latitude of the second point in degrees
+ * @return the distance in meters
+ * @note the iteration does not converge for some nearly antipodal points, the haversine
+ * distance is returned for them instead
+ *
+ * @since 0.0.1
+ */
+inline double vincenty(double lng1, double lat1, double lng2, double lat2) noexcept
+{
+    const double a = WGS84_A;
+    const double f = WGS84_F;
+    const double b = a * (1 - f);
+
+    double u1     = std::atan((1 - f) * std::tan(lat1 * RADIANS));
+    double u2     = std::atan((1 - f) * std::tan(lat2 * RADIANS));
+    double sin_u1 = std::sin(u1);
+    double cos_u1 = std::cos(u1);
+    double sin_u2 = std::sin(u2);
+    double cos_u2 = std::cos(u2);
+    double l      = (lng2 - lng1) * RADIANS;
+
+    double lambda = l;
+    for (size_t iteration = 0; iteration < 200; ++iteration)
+    {
+        double sin_lambda = std::sin(lambda);
+        double cos_lambda = std::cos(lambda);
+        double p          = cos_u2 * sin_lambda;
+        double q          = cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda;
+        double sin_sigma  = std::sqrt(p * p + q * q);
+        if (sin_sigma == 0)
+        {
+            return 0;
+        }
+        double cos_sigma  = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+        double sigma      = std::atan2(sin_sigma, cos_sigma);
+        double sin_alpha  = cos_u1 * cos_u2 * sin_lambda / sin_sigma;
+        double cos2_alpha = 1 - sin_alpha * sin_alpha;
+        // equatorial lines have cos2_alpha = 0
+        double cos_2sigma_m = cos2_alpha != 0 ? cos_sigma - 2 * sin_u1 * sin_u2 / cos2_alpha : 0;
+        double c            = f / 16 * cos2_alpha * (4 + f * (4 - 3 * cos2_alpha));
+        double previous     = lambda;
+        lambda              = l + (1 - c) * f * sin_alpha *
+                       (sigma + c * sin_sigma * (cos_2sigma_m + c * cos_sigma * (-1 + 2 * cos_2sigma_m * cos_2sigma_m)));
+        if (std::abs(lambda - previous) < 1e-12)
+        {
+            double u_2         = cos2_alpha * (a * a - b * b) / (b * b);
+            double big_a       = 1 + u_2 / 16384 * (4096 + u_2 * (-768 + u_2 * (320 - 175 * u_2)));
+            double big_b       = u_2 / 1024 * (256 + u_2 * (-128 + u_2 * (74 - 47 * u_2)));
+            double delta_sigma = big_b * sin_sigma *
+                                 (cos_2sigma_m + big_b / 4 *
+                                                     (cos_sigma * (-1 + 2 * cos_2sigma_m * cos_2sigma_m) -
+                                                      big_b / 6 * cos_2sigma_m * (-3 + 4 * sin_sigma * sin_sigma) *
+                                                          (-3 + 4 * cos_2sigma_m * cos_2sigma_m)));
+            return b * big_a * (sigma - delta_sigma);
+        }
+    }
+    return haversine(lng1, lat1, lng2, lat2);
+}
+
+namespace detail
+{
+
+/// the central angle between batches of points given in radians, with the haversine formula
+inline simd::batch central_angle(simd::batch lng1, simd::batch lat1, simd::batch cos_lat1, simd::batch lng2,
+                                 simd::batch lat2, simd::batch cos_lat2) noexcept
+{
+    auto half = simd::set1(0.5);
+    auto s1   = simd::sin((lat2 - lat1) * half);
+    auto s2   = simd::sin((lng2 - lng1) * half);
+    auto a    = s1 * s1 + cos_lat1 * cos_lat2 * s2 * s2;
+    return simd::set1(2) * simd::asin(simd::min(simd::set1(1), simd::sqrt(a)));
+}
+
+/// @private
+template <typename Point>
+double point_distance(const Point& a, const Point& b, method m)
+{
+    auto lng1 = static_cast<double>(a.lng);
+    auto lat1 = static_cast<double>(a.lat);
+    auto lng2 = static_cast<double>(b.lng);
+    auto lat2 = static_cast<double>(b.lat);
+    return m == method::VINCENTY ? vincenty(lng1, lat1, lng2, lat2) : haversine(lng1, lat1, lng2, lat2);
+}
+
+/// @private
+template <typename Path>
+double path_length(const Path& path, method m, std::false_type)
+{
+    shapes::detail::compensated_sum res;
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        res.add(point_distance(path[i - 1], path[i], m));
+    }
+    return res.value();
+}
+
+/// @private
+template <typename Path>
+double path_length(const Path& path, method m, std::true_type)
+{
+    if (m != method::HAVERSINE)
+    {
+        return path_length(path, m, std::false_type{});
+    }
+    size_t n = path.size();
+    if (n < 2)
+    {
+        return 0;
+    }
+    const double* p = &path[0].x;
+    auto radians    = simd::set1(RADIANS);
+    shapes::detail::batch_sum sum;
+    size_t i = 0;
+    for (; i + simd::width < n; i += simd::width)
+    {
+        simd::batch lng1, lat1, lng2, lat2;
+        simd::load_xy(p + 2 * i, lng1, lat1);
+        simd::load_xy(p + 2 * i + 2, lng2, lat2);
+        lat1 = lat1 * radians;
+        lat2 = lat2 * radians;
+        sum.add(central_angle(lng1 * radians, lat1, simd::cos(lat1), lng2 * radians, lat2, simd::cos(lat2)));
+    }
+    shapes::detail::compensated_sum res;
+    res.add(sum.value() * EARTH_RADIUS);
+    for (; i + 1 < n; ++i)
+    {
+        res.add(point_distance(path[i], path[i + 1], m));
+    }
+    return res.value();
+}
+
+/// sums the geodesic length of the linestrings of a geometry
+struct length_visitor
+{
+    /// the model of the Earth
+    method m;
+
+    /// the total length
+    shapes::detail::compensated_sum res;
+
+    template <typename Path>
+    void operator()(const Path& path, bool closed)
+    {
+        if (not closed)
+        {
+            res.add(path_length(path, m, typename shapes::detail::is_flat_xy<typename Path::value_type>::type{}));
+        }
+    }
+};
+
+}  // namespace detail
+
+/*!
+ * @brief Computes the distance between two points given as (lng, lat) in degrees
+ *
+ * @param a the first point
+ * @param b the second point
+ * @param m the model of the Earth
+ * @return the distance in meters
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+double distance(const Point& a, const Point& b, method m = method::HAVERSINE)
+{
+    return detail::point_distance(a, b, m);
+}
+
+/*!
+ * @brief Computes the length of a lineal geometry whose points are (lng, lat) in degrees
+ *
+ * @param geom the linestring or multilinestring
+ * @param m the model of the Earth
+ * @return the length in meters, zero for puntal and areal geometries
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+double length(const Geometry& geom, method m = method::HAVERSINE)
+{
+    detail::length_visitor visitor{m, {}};
+    shapes::detail::for_each_path(geom, typename geometry_traits<Geometry>::tag{}, visitor);
+    return visitor.res.value();
+}
+
+/*!
+ * @brief Computes the haversine distances from one point to n points, simd::width points at a time
+ *
+ * The trigonometric functions are polynomial approximations with an absolute error
+ * below 1e-15, the distances differ from haversine() by less than 1e-6 meters.
+ *
+ * @param lng the longitude of the origin in degrees
+ * @param lat the latitude of the origin in degrees
+ * @param lngs the longitudes of the points in degrees
+ * @param lats the latitudes of the points in degrees
+ * @param n the number of points
+ * @param res the output, res[i] is the distance to the i-th point
+ * @param radius the radius of the sphere
+ *
+ * @since 0.0.1
+ */
+inline void distances(double lng, double lat, const double* lngs, const double* lats, size_t n, double* res,
+                      double radius = EARTH_RADIUS) noexcept
+{
+    auto radians  = simd::set1(RADIANS);
+    auto scale    = simd::set1(radius);
+    auto lng1     = simd::set1(lng * RADIANS);
+    auto lat1     = simd::set1(lat * RADIANS);
+    auto cos_lat1 = simd::set1(std::cos(lat * RADIANS));
+
+    double tail_lng[simd::width] = {};
+    double tail_lat[simd::width] = {};
+    double tail_res[simd::width];
+    for (size_t i = 0; i < n; i += simd::width)
+    {
+        size_t count = std::min(simd::width, n - i);
+        simd::batch lng2;
+        simd::batch lat2;
+        if (count == simd::width)
+        {
+            lng2 = simd::load(lngs + i) * radians;
+            lat2 = simd::load(lats + i) * radians;
+        }
+        else
+        {
+            std::copy(lngs + i, lngs + i + count, tail_lng);
+            std::copy(lats + i, lats + i + count, tail_lat);
+            lng2 = simd::load(tail_lng) * radians;
+            lat2 = simd::load(tail_lat) * radians;
+        }
+        auto d = detail::central_angle(lng1, lat1, cos_lat1, lng2, lat2, simd::cos(lat2)) * scale;
+        if (count == simd::width)
+        {
+            simd::store(res + i, d);
+        }
+        else
+        {
+            simd::store(tail_res, d);
+            std::copy(tail_res, tail_res + count, res + i);
+        }
+    }
+}
+
+/*!
+ * @brief Computes the haversine distances from one point to every point of a multipoint
+ *
+ * @param origin the origin as (lng, lat) in degrees
+ * @param points the multipoint as (lng, lat) in degrees
+ * @param radius the radius of the sphere
+ * @return the distances in the unit of the radius, meters by default
+ *
+ * @since 0.0.1
+ */
+template <typename Point, typename MultiPoint>
+std::vector<double> distances(const Point& origin, const MultiPoint& points, double radius = EARTH_RADIUS)
+{
+    std::vector<double> res(points.size());
+
+    // de-interleaves the points in blocks that stay in the cache
+    const size_t block = 256 * simd::width;
+    std::vector<double> lngs(block);
+    std::vector<double> lats(block);
+    for (size_t lo = 0; lo < points.size(); lo += block)
+    {
+        size_t count = std::min(block, points.size() - lo);
+        for (size_t i = 0; i < count; ++i)
+        {
+            lngs[i] = static_cast<double>(points[lo + i].lng);
+            lats[i] = static_cast<double>(points[lo + i].lat);
+        }
+        distances(static_cast<double>(origin.lng), static_cast<double>(origin.lat), lngs.data(), lats.data(), count,
+                  res.data() + lo, radius);
+    }
+    return res;
+}
+
+}  // namespace geodesic
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,582 @@
+#pragma once
+
+#include <ciso646>
+#include <cmath>
+#include <type_traits>
+#include <simo/exceptions.hpp>
+#include <simo/algorithm/detail/kernel.hpp>
+#include <simo/algorithm/detail/simd.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// a running sum with Neumaier compensation, keeps long sums of small terms accurate
+struct compensated_sum
+{
+    /// the running sum
+    double sum = 0;
+
+    /// the accumulated rounding error
+    double error = 0;
+
+    void add(double value) noexcept
+    {
+        double t = sum + value;
+        if (std::abs(sum) >= std::abs(value))
+        {
+            error += (sum - t) + value;
+        }
+        else
+        {
+            error += (value - t) + sum;
+        }
+        sum = t;
+    }
+
+    double value() const noexcept
+    {
+        return sum + error;
+    }
+};
+
+/// simd::width running sums with Kahan compensation
+struct batch_sum
+{
+    /// the running sum of each lane
+    simd::batch sum = simd::set1(0);
+
+    /// the negated rounding error of each lane
+    simd::batch error = simd::set1(0);
+
+    void add(simd::batch value) noexcept
+    {
+        auto y = value - error;
+        auto t = sum + y;
+        error  = (t - sum) - y;
+        sum    = t;
+    }
+
+    double value() const noexcept
+    {
+        double sums[simd::width];
+        double errors[simd::width];
+        simd::store(sums, sum);
+        simd::store(errors, error);
+        compensated_sum res;
+        for (size_t i = 0; i < simd::width; ++i)
+        {
+            res.add(sums[i]);
+            res.add(-errors[i]);
+        }
+        return res.value();
+    }
+};
+
+/// true if the points are stored as contiguous (x, y) doubles and can be loaded in batches
+template <typename Point>
+struct is_flat_xy
+    : std::integral_constant<bool, is_basic_point<Point>::value and std::is_same<typename Point::coord_type, double>::value and
+                                       sizeof(Point) == 2 * sizeof(double)>
+{};
+
+/// true if the points have a z-coordinate taken into account by the length
+template <typename Point>
+struct is_3d : std::integral_constant<bool, is_basic_point_z<Point>::value or is_basic_point_zm<Point>::value>
+{};
+
+/// twice the signed area of a ring and its first moments, relative to the first vertex
+struct ring_moments
+{
+    double area2;
+    double mx;
+    double my;
+    double ox;
+    double oy;
+};
+
+/// @private
+template <bool FirstMoments, typename Ring>
+ring_moments moments(const Ring& ring, std::false_type)
+{
+    size_t n = ring.size();
+    if (n < 3)
+    {
+        return {0, 0, 0, 0, 0};
+    }
+    // relative coordinates avoid the cancellation of large products far from the origin,
+    // they also make the closing edge and the first edge vanish
+    auto ox = static_cast<double>(ring[0].x);
+    auto oy = static_cast<double>(ring[0].y);
+    compensated_sum area2;
+    compensated_sum mx;
+    compensated_sum my;
+    for (size_t i = 1; i + 1 < n; ++i)
+    {
+        double x1 = static_cast<double>(ring[i].x) - ox;
+        double y1 = static_cast<double>(ring[i].y) - oy;
+        double x2 = static_cast<double>(ring[i + 1].x) - ox;
+        double y2 = static_cast<double>(ring[i + 1].y) - oy;
+        double t  = x1 * y2 - x2 * y1;
+        area2.add(t);
+        if (FirstMoments)
+        {
+            mx.add((x1 + x2) * t);
+            my.add((y1 + y2) * t);
+        }
+    }
+    return {area2.value(), mx.value(), my.value(), ox, oy};
+}
+
+/// @private
+template <bool FirstMoments, typename Ring>
+ring_moments moments(const Ring& ring, std::true_type)
+{
+    size_t n = ring.size();
+    if (n < 3)
+    {
+        return {0, 0, 0, 0, 0};
+    }
+    const double* p = &ring[0].x;
+    double ox       = p[0];
+    double oy       = p[1];
+    auto bx         = simd::set1(ox);
+    auto by         = simd::set1(oy);
+
+    batch_sum area2;
+    batch_sum mx;
+    batch_sum my;
+    size_t i = 0;
+    for (; i + simd::width < n; i += simd::width)
+    {
+        simd::batch x1, y1, x2, y2;
+        simd::load_xy(p + 2 * i, x1, y1);
+        simd::load_xy(p + 2 * i + 2, x2, y2);
+        x1     = x1 - bx;
+        y1     = y1 - by;
+        x2     = x2 - bx;
+        y2     = y2 - by;
+        auto t = x1 * y2 - x2 * y1;
+        area2.add(t);
+        if (FirstMoments)
+        {
+            mx.add((x1 + x2) * t);
+            my.add((y1 + y2) * t);
+        }
+    }
+
+    compensated_sum tail_area2;
+    compensated_sum tail_mx;
+    compensated_sum tail_my;
+    tail_area2.add(area2.value());
+    tail_mx.add(mx.value());
+    tail_my.add(my.value());
+    for (; i + 1 < n; ++i)
+    {
+        double x1 = p[2 * i] - ox;
+        double y1 = p[2 * i + 1] - oy;
+        double x2 = p[2 * i + 2] - ox;
+        double y2 = p[2 * i + 3] - oy;
+        double t  = x1 * y2 - x2 * y1;
+        tail_area2.add(t);
+        if (FirstMoments)
+        {
+            tail_mx.add((x1 + x2) * t);
+            tail_my.add((y1 + y2) * t);
+        }
+    }
+    return {tail_area2.value(), tail_mx.value(), tail_my.value(), ox, oy};
+}
+
+/*!
+ * @tparam FirstMoments whether to compute the first moments, only needed by the centroid
+ * @param ring the linear ring, either explicitly or implicitly closed
+ * @return twice the signed area of the ring and its first moments
+ */
+template <bool FirstMoments, typename Ring>
+ring_moments moments(const Ring& ring)
+{
+    return moments<FirstMoments>(ring, typename is_flat_xy<typename Ring::value_type>::type{});
+}
+
+/// @private
+template <typename Point>
+double point_distance(const Point& a, const Point& b, std::false_type)
+{
+    double dx = static_cast<double>(b.x) - static_cast<double>(a.x);
+    double dy = static_cast<double>(b.y) - static_cast<double>(a.y);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+/// @private
+template <typename Point>
+double point_distance(const Point& a, const Point& b, std::true_type)
+{
+    double dx = static_cast<double>(b.x) - static_cast<double>(a.x);
+    double dy = static_cast<double>(b.y) - static_cast<double>(a.y);
+    double dz = static_cast<double>(b.z) - static_cast<double>(a.z);
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/// @private
+template <typename Path>
+double path_length(const Path& path, bool closed, std::false_type)
+{
+    using is_3d_type = typename is_3d<typename Path::value_type>::type;
+    compensated_sum res;
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        res.add(point_distance(path[i - 1], path[i], is_3d_type{}));
+    }
+    if (closed and path.size() > 2)
+    {
+        res.add(point_distance(path.back(), path.front(), is_3d_type{}));
+    }
+    return res.value();
+}
+
+/// @private
+template <typename Path>
+double path_length(const Path& path, bool closed, std::true_type)
+{
+    size_t n = path.size();
+    if (n < 2)
+    {
+        return 0;
+    }
+    const double* p = &path[0].x;
+    batch_sum sum;
+    size_t i = 0;
+    for (; i + simd::width < n; i += simd::width)
+    {
+        simd::batch x1, y1, x2, y2;
+        simd::load_xy(p + 2 * i, x1, y1);
+        simd::load_xy(p + 2 * i + 2, x2, y2);
+        auto dx = x2 - x1;
+        auto dy = y2 - y1;
+        sum.add(simd::sqrt(dx * dx + dy * dy));
+    }
+    compensated_sum res;
+    res.add(sum.value());
+    for (; i + 1 < n; ++i)
+    {
+        res.add(point_distance(path[i], path[i + 1], std::false_type{}));
+    }
+    if (closed and n > 2)
+    {
+        res.add(point_distance(path.back(), path.front(), std::false_type{}));
+    }
+    return res.value();
+}
+
+/*!
+ * @param path the linestring or linear ring
+ * @param closed whether the segment from the last to the first vertex is part of the path
+ * @return the length of the path, in 3D for points with a z-coordinate
+ */
+template <typename Path>
+double path_length(const Path& path, bool closed)
+{
+    return path_length(path, closed, typename is_flat_xy<typename Path::value_type>::type{});
+}
+
+/// @private
+template <typename Geometry, typename Tag, typename F>
+void for_each_path(const Geometry&, Tag, F&)
+{}
+
+/// @private
+template <typename LineString, typename F>
+void for_each_path(const LineString& linestring, linestring_tag, F& f)
+{
+    f(linestring, false);
+}
+
+/// @private
+template <typename MultiLineString, typename F>
+void for_each_path(const MultiLineString& multilinestring, multilinestring_tag, F& f)
+{
+    for (const auto& linestring : multilinestring)
+    {
+        f(linestring, false);
+    }
+}
+
+/// @private
+template <typename Polygon, typename F>
+void for_each_path(const Polygon& polygon, polygon_tag, F& f)
+{
+    for (const auto& ring : polygon)
+    {
+        f(ring, true);
+    }
+}
+
+/// @private
+template <typename MultiPolygon, typename F>
+void for_each_path(const MultiPolygon& multipolygon, multipolygon_tag, F& f)
+{
+    for (const auto& polygon : multipolygon)
+    {
+        for_each_path(polygon, polygon_tag{}, f);
+    }
+}
+
+/// @private
+template <typename Geometry, typename Tag, typename F>
+void for_each_ring(const Geometry&, Tag, F&)
+{}
+
+/// @private
+template <typename Polygon, typename F>
+void for_each_ring(const Polygon& polygon, polygon_tag, F& f)
+{
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        f(polygon[i], i > 0);
+    }
+}
+
+/// @private
+template <typename MultiPolygon, typename F>
+void for_each_ring(const MultiPolygon& multipolygon, multipolygon_tag, F& f)
+{
+    for (const auto& polygon : multipolygon)
+    {
+        for_each_ring(polygon, polygon_tag{}, f);
+    }
+}
+
+/// sums the lengths of either the open paths or the closed rings of a geometry
+struct length_visitor
+{
+    /// whether to measure the rings instead of the linestrings
+    bool closed;
+
+    /// the total length
+    compensated_sum res;
+
+    template <typename Path>
+    void operator()(const Path& path, bool path_closed)
+    {
+        if (path_closed == closed)
+        {
+            res.add(path_length(path, path_closed));
+        }
+    }
+};
+
+/// a running weighted sum of points
+struct centroid_sum
+{
+    /// the total weight
+    compensated_sum w;
+
+    /// the weighted x-coordinates
+    compensated_sum x;
+
+    /// the weighted y-coordinates
+    compensated_sum y;
+
+    void add(double weight, double cx, double cy) noexcept
+    {
+        w.add(weight);
+        x.add(weight * cx);
+        y.add(weight * cy);
+    }
+};
+
+/// sums the area of the shells minus the area of the holes
+struct area_visitor
+{
+    /// the total area
+    compensated_sum res;
+
+    template <typename Ring>
+    void operator()(const Ring& ring, bool hole)
+    {
+        double area = std::abs(moments<false>(ring).area2) / 2;
+        res.add(hole ? -area : area);
+    }
+};
+
+/// sums the centroids of the rings weighted by their area, negative for the holes
+struct area_centroid_visitor
+{
+    /// the centroid accumulator
+    centroid_sum res;
+
+    template <typename Ring>
+    void operator()(const Ring& ring, bool hole)
+    {
+        auto m = moments<true>(ring);
+        if (m.area2 == 0)
+        {
+            return;
+        }
+        double area = std::abs(m.area2) / 2;
+        res.add(hole ? -area : area, m.ox + m.mx / (3 * m.area2), m.oy + m.my / (3 * m.area2));
+    }
+};
+
+/// sums the midpoints of the segments weighted by their length
+struct line_centroid_visitor
+{
+    /// the centroid accumulator
+    centroid_sum res;
+
+    template <typename Path>
+    void operator()(const Path& path, bool closed)
+    {
+        size_t n = path.size();
+        for (size_t i = 1; i <= n; ++i)
+        {
+            if (i == n and not(closed and n > 2))
+            {
+                break;
+            }
+            const auto& a = path[i - 1];
+            const auto& b = path[i % n];
+            res.add(point_distance(a, b, std::false_type{}), (static_cast<double>(a.x) + static_cast<double>(b.x)) / 2,
+                    (static_cast<double>(a.y) + static_cast<double>(b.y)) / 2);
+        }
+    }
+};
+
+/// sums the vertices of the paths with unit weight
+struct vertex_centroid_visitor
+{
+    /// the centroid accumulator
+    centroid_sum res;
+
+    template <typename Path>
+    void operator()(const Path& path, bool)
+    {
+        for (const auto& p : path)
+        {
+            res.add(1, static_cast<double>(p.x), static_cast<double>(p.y));
+        }
+    }
+};
+
+/// @private
+template <typename Point>
+void vertex_centroid(const Point& point, point_tag, centroid_sum& res)
+{
+    res.add(1, static_cast<double>(point.x), static_cast<double>(point.y));
+}
+
+/// @private
+template <typename MultiPoint>
+void vertex_centroid(const MultiPoint& multipoint, multipoint_tag, centroid_sum& res)
+{
+    for (const auto& p : multipoint)
+    {
+        res.add(1, static_cast<double>(p.x), static_cast<double>(p.y));
+    }
+}
+
+/// @private
+template <typename Geometry, typename Tag>
+void vertex_centroid(const Geometry& geom, Tag tag, centroid_sum& res)
+{
+    vertex_centroid_visitor visitor;
+    for_each_path(geom, tag, visitor);
+    res = visitor.res;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Computes the planar area, the area of the holes is subtracted from the area of the shells
+ *
+ * @param geom the geometry
+ * @return the area of the geometry, zero for puntal and lineal geometries
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+double area(const Geometry& geom)
+{
+    detail::area_visitor visitor;
+    detail::for_each_ring(geom, typename geometry_traits<Geometry>::tag{}, visitor);
+    return visitor.res.value();
+}
+
+/*!
+ * @brief Computes the length of a lineal geometry, 3D for points with a z-coordinate
+ *
+ * @param geom the geometry
+ * @return the length of the geometry, zero for puntal and areal geometries
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+double length(const Geometry& geom)
+{
+    detail::length_visitor visitor{false, {}};
+    detail::for_each_path(geom, typename geometry_traits<Geometry>::tag{}, visitor);
+    return visitor.res.value();
+}
+
+/*!
+ * @brief Computes the length of the boundary of an areal geometry, 3D for points with a z-coordinate
+ *
+ * @param geom the geometry
+ * @return the perimeter of the geometry, zero for puntal and lineal geometries
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+double perimeter(const Geometry& geom)
+{
+    detail::length_visitor visitor{true, {}};
+    detail::for_each_path(geom, typename geometry_traits<Geometry>::tag{}, visitor);
+    return visitor.res.value();
+}
+
+/*!
+ * @brief Computes the planar centroid of a geometry
+ *
+ * Areal geometries are weighted by area, lineal geometries by length and puntal geometries
+ * by vertex. Degenerate geometries fall back to the next lower dimension, e.g. a polygon
+ * with zero area returns the centroid of its boundary.
+ *
+ * @param geom the geometry
+ * @return the centroid of the geometry
+ * @throw geometry_error if the geometry is empty
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+basic_point<double> centroid(const Geometry& geom)
+{
+    using tag = typename geometry_traits<Geometry>::tag;
+
+    detail::area_centroid_visitor areas;
+    detail::for_each_ring(geom, tag{}, areas);
+    auto res = areas.res;
+    if (res.w.value() == 0)
+    {
+        detail::line_centroid_visitor lines;
+        detail::for_each_path(geom, tag{}, lines);
+        res = lines.res;
+    }
+    if (res.w.value() == 0)
+    {
+        res = detail::centroid_sum{};
+        detail::vertex_centroid(geom, tag{}, res);
+    }
+    double w = res.w.value();
+    if (w == 0)
+    {
+        throw exceptions::geometry_error("the centroid of an empty geometry is undefined");
+    }
+    return basic_point<double>(res.x.value() / w, res.y.value() / w);
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <simo/algorithm/detail/kernel.hpp>
+#include <simo/algorithm/detail/simd.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// a polygon edge with the values broadcast by the batch kernel
+struct batch_edge
+{
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    double slope;
+    double minx;
+    double maxx;
+    double miny;
+    double maxy;
+};
+
+/// @private
+template <typename Polygon>
+std::vector<batch_edge> batch_edges(const Polygon& polygon)
+{
+    std::vector<batch_edge> res;
+    for (const auto& s : segments(polygon))
+    {
+        if (s.x1 == s.x2 and s.y1 == s.y2)
+        {
+            continue;
+        }
+        double slope = s.y1 != s.y2 ? (s.x1 - s.x2) / (s.y1 - s.y2) : 0;
+        res.push_back({s.x1, s.y1, s.x2, s.y2, slope, std::min(s.x1, s.x2), std::max(s.x1, s.x2),
+                       std::min(s.y1, s.y2), std::max(s.y1, s.y2)});
+    }
+    return res;
+}
+
+/*!
+ * @brief Locates simd::width points at once with the crossing number rule
+ *
+ * @return the mask of the points lying in the interior or in the boundary of the polygon
+ */
+inline simd::batch_mask batch_point_in_polygon(simd::batch x, simd::batch y, const std::vector<batch_edge>& edges) noexcept
+{
+    auto inside   = simd::false_mask();
+    auto boundary = simd::false_mask();
+    auto zero     = simd::set1(0);
+    for (const auto& e : edges)
+    {
+        auto x1 = simd::set1(e.x1);
+        auto y1 = simd::set1(e.y1);
+        auto x2 = simd::set1(e.x2);
+        auto y2 = simd::set1(e.y2);
+
+        // crossing of the horizontal ray going right from the point
+        auto straddles = (y1 > y) ^ (y2 > y);
+        auto xint      = simd::set1(e.slope) * (y - y2) + x2;
+        inside         = inside ^ (straddles & (x < xint));
+
+        // the point lies on the edge
+        auto cross = (x2 - x1) * (y - y1) - (y2 - y1) * (x - x1);
+        auto on    = (cross == zero) & (x >= simd::set1(e.minx)) & (x <= simd::set1(e.maxx)) &
+                  (y >= simd::set1(e.miny)) & (y <= simd::set1(e.maxy));
+        boundary = boundary | on;
+    }
+    return inside | boundary;
+}
+
+/// @private
+inline void batch_point_in_polygon(const double* xs, const double* ys, size_t n, const std::vector<batch_edge>& edges,
+                                   const bounds_t& b, uint8_t* res) noexcept
+{
+    auto minx = simd::set1(b.minx);
+    auto maxx = simd::set1(b.maxx);
+    auto miny = simd::set1(b.miny);
+    auto maxy = simd::set1(b.maxy);
+
+    double tail_x[simd::width];
+    double tail_y[simd::width];
+    for (size_t i = 0; i < n; i += simd::width)
+    {
+        size_t count = std::min(simd::width, n - i);
+        simd::batch x;
+        simd::batch y;
+        if (count == simd::width)
+        {
+            x = simd::load(xs + i);
+            y = simd::load(ys + i);
+        }
+        else
+        {
+            // NaN lanes compare false everywhere and never match
+            std::fill(tail_x, tail_x + simd::width, std::numeric_limits<double>::quiet_NaN());
+            std::fill(tail_y, tail_y + simd::width, std::numeric_limits<double>::quiet_NaN());
+            std::copy(xs + i, xs + i + count, tail_x);
+            std::copy(ys + i, ys + i + count, tail_y);
+            x = simd::load(tail_x);
+            y = simd::load(tail_y);
+        }
+
+        uint32_t mask = 0;
+        auto in_bounds = (x >= minx) & (x <= maxx) & (y >= miny) & (y <= maxy);
+        if (simd::bits(in_bounds) != 0)
+        {
+            mask = simd::bits(batch_point_in_polygon(x, y, edges) & in_bounds);
+        }
+        for (size_t k = 0; k < count; ++k)
+        {
+            res[i + k] = static_cast<uint8_t>((mask >> k) & 1u);
+        }
+    }
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Tests a batch of points stored as separate x and y arrays against a polygon
+ *
+ * The crossing number loop runs over simd::width points at a time (8 with AVX-512,
+ * 4 with AVX, 2 with SSE2).
+ *
+ * @param xs the x-coordinates of the points
+ * @param ys the y-coordinates of the points
+ * @param n the number of points
+ * @param polygon the polygon or multipolygon
+ * @param res the output, res[i] is 1 if the i-th point lies in the interior or in the boundary of the polygon, otherwise 0
+ *
+ * @since 0.0.1
+ */
+template <typename Polygon>
+void points_in_polygon(const double* xs, const double* ys, size_t n, const Polygon& polygon, uint8_t* res)
+{
+    auto edges = detail::batch_edges(polygon);
+    detail::batch_point_in_polygon(xs, ys, n, edges, polygon.bounds(), res);
+}
+
+/*!
+ * @brief Tests every point of a multipoint against a polygon
+ *
+ * @param points the multipoint
+ * @param polygon the polygon or multipolygon
+ * @return a vector with 1 for the points lying in the interior or in the boundary of the polygon, otherwise 0
+ *
+ * @since 0.0.1
+ */
+template <typename MultiPoint, typename Polygon>
+std::vector<uint8_t> points_in_polygon(const MultiPoint& points, const Polygon& polygon)
+{
+    std::vector<uint8_t> res(points.size());
+    auto edges = detail::batch_edges(polygon);
+    auto b     = polygon.bounds();
+
+    // de-interleaves the points in blocks that stay in the cache
+    const size_t block = 256 * simd::width;
+    std::vector<double> xs(block);
+    std::vector<double> ys(block);
+    for (size_t lo = 0; lo < points.size(); lo += block)
+    {
+        size_t count = std::min(block, points.size() - lo);
+        for (size_t i = 0; i < count; ++i)
+        {
+            xs[i] = points[lo + i].x;
+            ys[i] = points[lo + i].y;
+        }
+        detail::batch_point_in_polygon(xs.data(), ys.data(), count, edges, b, res.data() + lo);
+    }
+    return res;
+}
+
+}  // namespace shapes
+}  // namespace simo
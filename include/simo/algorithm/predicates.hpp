@@ -0,0 +1,331 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <simo/algorithm/detail/kernel.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// @private
+inline double bounds_distance(const bounds_t& a, const bounds_t& b) noexcept
+{
+    double dx = std::max(0.0, std::max(a.minx - b.maxx, b.minx - a.maxx));
+    double dy = std::max(0.0, std::max(a.miny - b.maxy, b.miny - a.maxy));
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+/*!
+ * @brief Visits the pieces of the segments of b once they are split at every point touching a
+ *
+ * Each piece is reported with its midpoint, segment endpoints are reported as degenerate pieces.
+ * The visitor returns false to stop the traversal.
+ *
+ * @return false if the traversal was stopped, otherwise true
+ */
+template <typename F>
+bool for_each_piece(const std::vector<segment>& b, const std::vector<segment>& a, F f)
+{
+    std::vector<double> params;
+    for (const auto& s : b)
+    {
+        if (not f(s.x1, s.y1) or not f(s.x2, s.y2))
+        {
+            return false;
+        }
+        if (s.x1 == s.x2 and s.y1 == s.y2)
+        {
+            continue;
+        }
+        params.clear();
+        params.push_back(0);
+        params.push_back(1);
+        for (const auto& t : a)
+        {
+            split_params(s, t, params);
+        }
+        std::sort(params.begin(), params.end());
+        for (size_t i = 1; i < params.size(); ++i)
+        {
+            if (params[i] <= params[i - 1])
+            {
+                continue;
+            }
+            double t = (params[i - 1] + params[i]) / 2;
+            if (not f(s.x1 + t * (s.x2 - s.x1), s.y1 + t * (s.y2 - s.y1)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Locates a point with respect to a geometry
+ *
+ * @param x the x-coordinate of the point
+ * @param y the y-coordinate of the point
+ * @param geom the geometry
+ * @return whether the point lies in the interior, boundary or exterior of the geometry
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+location locate(double x, double y, const Geometry& geom)
+{
+    return detail::locate(x, y, geom, typename geometry_traits<Geometry>::tag{});
+}
+
+/*!
+ * @param x the x-coordinate of the point
+ * @param y the y-coordinate of the point
+ * @param polygon the polygon or multipolygon
+ * @return true if the point lies in the interior or in the boundary of the polygon, otherwise false
+ * @note each call costs O(n), use prepared_polygon for repeated queries against the same polygon
+ *
+ * @since 0.0.1
+ */
+template <typename Polygon>
+bool point_in_polygon(double x, double y, const Polygon& polygon)
+{
+    return locate(x, y, polygon) != location::EXTERIOR;
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return true if the geometries share at least one point, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool intersects(const GeometryA& a, const GeometryB& b)
+{
+    using tag_a = typename geometry_traits<GeometryA>::tag;
+    using tag_b = typename geometry_traits<GeometryB>::tag;
+
+    if (not a.bounds().intersects(b.bounds()))
+    {
+        return false;
+    }
+
+    // puntal geometries only need a point location
+    if (detail::topological_dimension(tag_a{}) == 0)
+    {
+        auto sa = detail::segments(a);
+        return std::any_of(sa.begin(), sa.end(), [&b](const detail::segment& s) {
+            return locate(s.x1, s.y1, b) != location::EXTERIOR;
+        });
+    }
+    if (detail::topological_dimension(tag_b{}) == 0)
+    {
+        return intersects(b, a);
+    }
+
+    auto sa = detail::segments(a);
+    auto sb = detail::segments(b);
+
+    for (const auto& s : sa)
+    {
+        for (const auto& t : sb)
+        {
+            if (detail::segments_intersect(s, t))
+            {
+                return true;
+            }
+        }
+    }
+
+    // without boundary crossings one geometry can still lie inside the other one
+    if (detail::topological_dimension(tag_b{}) == 2 and not sa.empty() and locate(sa[0].x1, sa[0].y1, b) != location::EXTERIOR)
+    {
+        return true;
+    }
+    if (detail::topological_dimension(tag_a{}) == 2 and not sb.empty() and locate(sb[0].x1, sb[0].y1, a) != location::EXTERIOR)
+    {
+        return true;
+    }
+    return false;
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return true if the geometries do not share any point, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool disjoint(const GeometryA& a, const GeometryB& b)
+{
+    return not intersects(a, b);
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return true if no point of b lies in the exterior of a, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool covers(const GeometryA& a, const GeometryB& b)
+{
+    using tag_a = typename geometry_traits<GeometryA>::tag;
+    using tag_b = typename geometry_traits<GeometryB>::tag;
+
+    auto sb = detail::segments(b);
+    if (sb.empty() or not a.bounds().contains(b.bounds()))
+    {
+        return false;
+    }
+    if (detail::topological_dimension(tag_a{}) < detail::topological_dimension(tag_b{}))
+    {
+        return false;
+    }
+
+    if (detail::topological_dimension(tag_b{}) == 0)
+    {
+        return std::all_of(sb.begin(), sb.end(), [&a](const detail::segment& s) {
+            return locate(s.x1, s.y1, a) != location::EXTERIOR;
+        });
+    }
+
+    auto sa  = detail::segments(a);
+    bool res = detail::for_each_piece(sb, sa, [&a](double x, double y) {
+        return locate(x, y, a) != location::EXTERIOR;
+    });
+    if (not res or detail::topological_dimension(tag_b{}) < 2)
+    {
+        return res;
+    }
+
+    // the boundary of a must stay out of the interior of b, e.g. a hole of a inside b
+    return detail::for_each_piece(sa, sb, [&b](double x, double y) {
+        return locate(x, y, b) != location::INTERIOR;
+    });
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return true if b lies in a and the interiors of both geometries intersect, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool contains(const GeometryA& a, const GeometryB& b)
+{
+    using tag_b = typename geometry_traits<GeometryB>::tag;
+
+    // puntal geometries need every point in a and at least one of them in the interior of a
+    if (detail::topological_dimension(tag_b{}) == 0)
+    {
+        auto sb = detail::segments(b);
+        if (sb.empty() or not a.bounds().contains(b.bounds()))
+        {
+            return false;
+        }
+        bool interior = false;
+        for (const auto& s : sb)
+        {
+            auto loc = locate(s.x1, s.y1, a);
+            if (loc == location::EXTERIOR)
+            {
+                return false;
+            }
+            interior = interior or loc == location::INTERIOR;
+        }
+        return interior;
+    }
+
+    if (not covers(a, b))
+    {
+        return false;
+    }
+    // a non-empty polygon covered by a has its interior inside the interior of a
+    if (detail::topological_dimension(tag_b{}) == 2)
+    {
+        return true;
+    }
+    auto sa = detail::segments(a);
+    auto sb = detail::segments(b);
+    return not detail::for_each_piece(sb, sa, [&a](double x, double y) {
+        return locate(x, y, a) != location::INTERIOR;
+    });
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return true if a lies in b and the interiors of both geometries intersect, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool within(const GeometryA& a, const GeometryB& b)
+{
+    return contains(b, a);
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @return the minimum planar distance between the geometries, zero if they intersect
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+double distance(const GeometryA& a, const GeometryB& b)
+{
+    auto sa = detail::segments(a);
+    auto sb = detail::segments(b);
+    if (sa.empty() or sb.empty())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (intersects(a, b))
+    {
+        return 0;
+    }
+    double res = std::numeric_limits<double>::max();
+    for (const auto& s : sa)
+    {
+        for (const auto& t : sb)
+        {
+            res = std::min(res, detail::segment_distance2(s, t));
+        }
+    }
+    return std::sqrt(res);
+}
+
+/*!
+ * @param a the first geometry
+ * @param b the second geometry
+ * @param max_distance the distance threshold
+ * @return true if the geometries are within the given planar distance, otherwise false
+ *
+ * @since 0.0.1
+ */
+template <typename GeometryA, typename GeometryB>
+bool dwithin(const GeometryA& a, const GeometryB& b, double max_distance)
+{
+    if (detail::bounds_distance(a.bounds(), b.bounds()) > max_distance)
+    {
+        return false;
+    }
+    return distance(a, b) <= max_distance;
+}
+
+}  // namespace shapes
+}  // namespace simo
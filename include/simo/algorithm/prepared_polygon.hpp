@@ -0,0 +1,271 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <simo/algorithm/detail/kernel.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief A polygon or multipolygon preprocessed for fast repeated point location
+ *
+ * The edges of every ring are bucketed in horizontal bands, a query only walks the
+ * edges of the band containing the point, which are the only ones a horizontal ray
+ * from the point can cross. The object is immutable once built, so it can be shared
+ * between threads without synchronization.
+ *
+ * @ingroup algorithm
+ *
+ * @since 0.0.1
+ */
+class prepared_polygon
+{
+  public:
+    /*!
+     * @brief Creates an empty prepared polygon
+     *
+     * @since 0.0.1
+     */
+    prepared_polygon() = default;
+
+    /*!
+     * @brief Prepares the given polygon or multipolygon, the geometry is copied and can be discarded
+     *
+     * @param geom the polygon or multipolygon
+     *
+     * @since 0.0.1
+     */
+    template <typename Polygon>
+    explicit prepared_polygon(const Polygon& geom)
+    {
+        std::vector<detail::segment> edges;
+        collect(geom, edges, typename geometry_traits<Polygon>::tag{});
+        build(edges);
+    }
+
+    /*!
+     * @param x the x-coordinate of the point
+     * @param y the y-coordinate of the point
+     * @return whether the point lies in the interior, boundary or exterior of the polygon
+     *
+     * @since 0.0.1
+     */
+    location locate(double x, double y) const noexcept
+    {
+        if (m_offsets.empty() or not m_bounds.contains(x, y))
+        {
+            return location::EXTERIOR;
+        }
+        size_t band = band_of(y);
+        bool inside = false;
+        for (size_t i = m_offsets[band]; i < m_offsets[band + 1]; ++i)
+        {
+            const auto& e = m_edges[i];
+            if (detail::on_segment(x, y, e.x1, e.y1, e.x2, e.y2))
+            {
+                return location::BOUNDARY;
+            }
+            if ((e.y2 > y) != (e.y1 > y) and x < (e.x1 - e.x2) * (y - e.y2) / (e.y1 - e.y2) + e.x2)
+            {
+                inside = not inside;
+            }
+        }
+        return inside ? location::INTERIOR : location::EXTERIOR;
+    }
+
+    /*!
+     * @param x the x-coordinate of the point
+     * @param y the y-coordinate of the point
+     * @return true if the point lies in the interior of the polygon, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool contains(double x, double y) const noexcept
+    {
+        return locate(x, y) == location::INTERIOR;
+    }
+
+    /*!
+     * @param x the x-coordinate of the point
+     * @param y the y-coordinate of the point
+     * @return true if the point lies in the interior or in the boundary of the polygon, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool intersects(double x, double y) const noexcept
+    {
+        return locate(x, y) != location::EXTERIOR;
+    }
+
+    /*!
+     * @return the bounds of the polygon
+     *
+     * @since 0.0.1
+     */
+    bounds_t bounds() const noexcept
+    {
+        return m_bounds;
+    }
+
+    /*!
+     * @return the number of edges of the polygon
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_num_edges;
+    }
+
+    /*!
+     * @return true if the polygon has no edges, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool empty() const noexcept
+    {
+        return m_num_edges == 0;
+    }
+
+  private:
+    /// @private
+    template <typename Ring>
+    static void collect_ring(const Ring& ring, std::vector<detail::segment>& edges)
+    {
+        size_t n = ring.size();
+        for (size_t i = 0, j = n - 1; i < n; j = i++)
+        {
+            const auto& a = ring[j];
+            const auto& b = ring[i];
+            if (a.x != b.x or a.y != b.y)
+            {
+                edges.push_back({a.x, a.y, b.x, b.y});
+            }
+        }
+    }
+
+    /// @private
+    template <typename Polygon>
+    static void collect(const Polygon& polygon, std::vector<detail::segment>& edges, polygon_tag)
+    {
+        for (const auto& ring : polygon)
+        {
+            collect_ring(ring, edges);
+        }
+    }
+
+    /// @private
+    template <typename MultiPolygon>
+    static void collect(const MultiPolygon& multipolygon, std::vector<detail::segment>& edges, multipolygon_tag)
+    {
+        // the even-odd rule over all the rings matches the polygon semantics for valid multipolygons
+        for (const auto& polygon : multipolygon)
+        {
+            collect(polygon, edges, polygon_tag{});
+        }
+    }
+
+    /// @private
+    size_t band_of(double y) const noexcept
+    {
+        double band = (y - m_bounds.miny) * m_scale;
+        // the negation also sends a NaN to the first band
+        if (not (band > 0))
+        {
+            return 0;
+        }
+        if (band >= static_cast<double>(m_num_bands - 1))
+        {
+            return m_num_bands - 1;
+        }
+        return static_cast<size_t>(band);
+    }
+
+    /// @private
+    void build(const std::vector<detail::segment>& edges)
+    {
+        m_num_edges = edges.size();
+        if (edges.empty())
+        {
+            return;
+        }
+        for (const auto& e : edges)
+        {
+            m_bounds.extend(e.x1, e.y1);
+            m_bounds.extend(e.x2, e.y2);
+        }
+
+        // one band per edge, halved while tall edges replicate too much
+        double height = m_bounds.maxy - m_bounds.miny;
+        m_num_bands   = height > 0 ? edges.size() : 1;
+        while (true)
+        {
+            m_scale      = height > 0 ? static_cast<double>(m_num_bands) / height : 0;
+            size_t total = 0;
+            for (const auto& e : edges)
+            {
+                total += band_of(std::max(e.y1, e.y2)) - band_of(std::min(e.y1, e.y2)) + 1;
+            }
+            if (m_num_bands == 1 or total <= MAX_REPLICATION * edges.size())
+            {
+                break;
+            }
+            m_num_bands /= 2;
+        }
+
+        // an edge adds one to the bands from lo to hi, the prefix sums are the band sizes
+        std::vector<std::ptrdiff_t> diffs(m_num_bands + 1, 0);
+        for (const auto& e : edges)
+        {
+            ++diffs[band_of(std::min(e.y1, e.y2))];
+            --diffs[band_of(std::max(e.y1, e.y2)) + 1];
+        }
+        m_offsets.resize(m_num_bands + 1, 0);
+        std::ptrdiff_t count = 0;
+        for (size_t band = 0; band < m_num_bands; ++band)
+        {
+            count += diffs[band];
+            m_offsets[band + 1] = m_offsets[band] + static_cast<size_t>(count);
+        }
+        m_edges.resize(m_offsets.back());
+        std::vector<size_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+        for (const auto& e : edges)
+        {
+            size_t lo = band_of(std::min(e.y1, e.y2));
+            size_t hi = band_of(std::max(e.y1, e.y2));
+            for (size_t band = lo; band <= hi; ++band)
+            {
+                m_edges[cursor[band]++] = e;
+            }
+        }
+    }
+
+    /// the maximum average number of bands per edge
+    static const size_t MAX_REPLICATION = 8;
+
+    /// the bounds of the polygon
+    bounds_t m_bounds{};
+
+    /// the number of distinct edges
+    size_t m_num_edges = 0;
+
+    /// the number of horizontal bands
+    size_t m_num_bands = 0;
+
+    /// the number of bands per unit of height
+    double m_scale = 0;
+
+    /// the position in m_edges of the first edge of each band
+    std::vector<size_t> m_offsets;
+
+    /// the edges grouped by band, edges spanning several bands are repeated
+    std::vector<detail::segment> m_edges;
+};
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,389 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <simo/exceptions.hpp>
+#include <simo/algorithm/measures.hpp>
+#include <simo/algorithm/geodesic.hpp>
+#include <simo/algorithm/detail/simd_math.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace projection
+{
+
+/// the radius of the Web Mercator sphere in meters, the WGS 84 semi-major axis
+constexpr static const double WEB_MERCATOR_RADIUS = 6378137.0;
+
+/// the latitude of the top edge of the Web Mercator square
+constexpr static const double WEB_MERCATOR_MAX_LATITUDE = 85.051128779806592;
+
+/// the scale factor on the central meridian of a UTM zone
+constexpr static const double UTM_SCALE = 0.9996;
+
+/// the easting of the central meridian of a UTM zone
+constexpr static const double UTM_FALSE_EASTING = 500000;
+
+/// the northing of the equator in the southern hemisphere
+constexpr static const double UTM_FALSE_NORTHING = 10000000;
+
+/*!
+ * @param lng the longitude in degrees
+ * @return the UTM zone, from 1 to 60, without the Norway and Svalbard exceptions
+ *
+ * @since 0.0.1
+ */
+inline uint32_t utm_zone(double lng) noexcept
+{
+    auto zone = static_cast<int32_t>(std::floor((lng + 180) / 6)) + 1;
+    return static_cast<uint32_t>(std::min(60, std::max(1, zone)));
+}
+
+}  // namespace projection
+
+namespace detail
+{
+
+/// @private the constants of the 4th order Krüger series of the transverse Mercator projection on WGS 84
+struct utm_parameters
+{
+    /// the longitude of the central meridian in degrees
+    double lng0;
+
+    /// the northing of the equator
+    double false_northing;
+
+    /// the first eccentricity
+    double e;
+
+    /// the scale factor times the rectifying radius
+    double scale;
+
+    /// the coefficients of the forward series
+    double alpha[4];
+
+    /// the coefficients of the inverse series
+    double beta[4];
+
+    /// the coefficients from the conformal to the geodetic latitude
+    double delta[4];
+
+    utm_parameters(uint32_t zone, bool north)
+    {
+        if (zone < 1 or zone > 60)
+        {
+            throw exceptions::geometry_error("invalid UTM zone: " + std::to_string(zone));
+        }
+        constexpr double f = geodesic::WGS84_F;
+        double n           = f / (2 - f);
+        double n2          = n * n;
+        double n3          = n2 * n;
+        double n4          = n3 * n;
+
+        lng0           = 6.0 * zone - 183;
+        false_northing = north ? 0 : projection::UTM_FALSE_NORTHING;
+        e              = std::sqrt(f * (2 - f));
+        scale          = projection::UTM_SCALE * geodesic::WGS84_A / (1 + n) * (1 + n2 / 4 + n4 / 64);
+
+        alpha[0] = n / 2 - 2 * n2 / 3 + 5 * n3 / 16 + 41 * n4 / 180;
+        alpha[1] = 13 * n2 / 48 - 3 * n3 / 5 + 557 * n4 / 1440;
+        alpha[2] = 61 * n3 / 240 - 103 * n4 / 140;
+        alpha[3] = 49561 * n4 / 161280;
+
+        beta[0] = n / 2 - 2 * n2 / 3 + 37 * n3 / 96 - n4 / 360;
+        beta[1] = n2 / 48 + n3 / 15 - 437 * n4 / 1440;
+        beta[2] = 17 * n3 / 480 - 37 * n4 / 840;
+        beta[3] = 4397 * n4 / 161280;
+
+        delta[0] = 2 * n - 2 * n2 / 3 - 2 * n3 + 116 * n4 / 45;
+        delta[1] = 7 * n2 / 3 - 8 * n3 / 5 - 227 * n4 / 45;
+        delta[2] = 56 * n3 / 15 - 136 * n4 / 35;
+        delta[3] = 4279 * n4 / 630;
+    }
+};
+
+/// @private sums c[j] sin(2(j+1)a) cosh(2(j+1)b) and c[j] cos(2(j+1)a) sinh(2(j+1)b) for the 4 coefficients
+inline void kruger_series(const double* c, simd::batch a, simd::batch b, simd::batch& sum_a,
+                          simd::batch& sum_b) noexcept
+{
+    auto half = simd::set1(0.5);
+    auto s2   = simd::sin(a + a);
+    auto c2   = simd::cos(a + a);
+    auto e2   = simd::exp(b + b);
+    auto i2   = simd::set1(1) / e2;
+    auto sj   = s2;
+    auto cj   = c2;
+    auto ej   = e2;
+    auto ij   = i2;
+    for (size_t j = 0; j < 4; ++j)
+    {
+        auto coeff = simd::set1(c[j]);
+        sum_a      = sum_a + coeff * sj * (ej + ij) * half;
+        sum_b      = sum_b + coeff * cj * (ej - ij) * half;
+        // the multiple angles, by angle addition
+        auto next = sj * c2 + cj * s2;
+        cj        = cj * c2 - sj * s2;
+        sj        = next;
+        ej        = ej * e2;
+        ij        = ij * i2;
+    }
+}
+
+/// @private
+struct web_mercator_forward
+{
+    void operator()(simd::batch& x, simd::batch& y) const noexcept
+    {
+        constexpr double max_lat = projection::WEB_MERCATOR_MAX_LATITUDE * geodesic::RADIANS;
+        auto radius              = simd::set1(projection::WEB_MERCATOR_RADIUS);
+        auto phi = simd::min(simd::set1(max_lat), simd::max(simd::set1(-max_lat), y * simd::set1(geodesic::RADIANS)));
+        // log(tan(pi/4 + phi/2)) = atanh(sin(phi)) = 2 atanh(tan(phi/2))
+        auto t = simd::sin(phi) / (simd::set1(1) + simd::cos(phi));
+        x      = x * simd::set1(geodesic::RADIANS) * radius;
+        y      = simd::set1(2) * simd::atanh(t) * radius;
+    }
+};
+
+/// @private
+struct web_mercator_inverse
+{
+    void operator()(simd::batch& x, simd::batch& y) const noexcept
+    {
+        constexpr double pi = 3.14159265358979323846;
+        auto one            = simd::set1(1);
+        auto psi            = simd::min(simd::set1(pi), simd::max(simd::set1(-pi), y / simd::set1(projection::WEB_MERCATOR_RADIUS)));
+        // phi = asin(tanh(psi))
+        auto e = simd::exp(psi + psi);
+        x      = x / simd::set1(projection::WEB_MERCATOR_RADIUS * geodesic::RADIANS);
+        y      = simd::asin((e - one) / (e + one)) / simd::set1(geodesic::RADIANS);
+    }
+};
+
+/// @private
+struct utm_forward
+{
+    /// the zone constants
+    utm_parameters params;
+
+    void operator()(simd::batch& x, simd::batch& y) const noexcept
+    {
+        constexpr double max_lat = 89.9 * geodesic::RADIANS;
+        auto one                 = simd::set1(1);
+        auto half                = simd::set1(0.5);
+        auto e                   = simd::set1(params.e);
+        auto lambda              = (x - simd::set1(params.lng0)) * simd::set1(geodesic::RADIANS);
+        auto phi = simd::min(simd::set1(max_lat), simd::max(simd::set1(-max_lat), y * simd::set1(geodesic::RADIANS)));
+
+        // the tangent of the conformal latitude, sinh(atanh(sin(phi)) - e atanh(e sin(phi)))
+        auto s   = simd::sin(phi);
+        auto q   = simd::set1(2) * simd::atanh(s / (one + simd::cos(phi))) - e * simd::atanh(e * s);
+        auto eq  = simd::exp(q);
+        auto tau = (eq - one / eq) * half;
+
+        auto xi  = simd::atan(tau / simd::cos(lambda));
+        auto eta = simd::atanh(simd::sin(lambda) / simd::sqrt(one + tau * tau));
+        auto sum_xi  = xi;
+        auto sum_eta = eta;
+        kruger_series(params.alpha, xi, eta, sum_xi, sum_eta);
+
+        auto scale = simd::set1(params.scale);
+        x          = sum_eta * scale + simd::set1(projection::UTM_FALSE_EASTING);
+        y          = sum_xi * scale + simd::set1(params.false_northing);
+    }
+};
+
+/// @private
+struct utm_inverse
+{
+    /// the zone constants
+    utm_parameters params;
+
+    void operator()(simd::batch& x, simd::batch& y) const noexcept
+    {
+        auto one   = simd::set1(1);
+        auto half  = simd::set1(0.5);
+        auto scale = simd::set1(params.scale);
+        auto xi    = (y - simd::set1(params.false_northing)) / scale;
+        auto eta   = (x - simd::set1(projection::UTM_FALSE_EASTING)) / scale;
+
+        auto xi1  = simd::set1(0);
+        auto eta1 = simd::set1(0);
+        kruger_series(params.beta, xi, eta, xi1, eta1);
+        xi1  = xi - xi1;
+        eta1 = eta - eta1;
+
+        auto ee      = simd::exp(eta1);
+        auto sinh    = (ee - one / ee) * half;
+        auto cosh    = (ee + one / ee) * half;
+        auto cos_xi1 = simd::cos(xi1);
+        auto chi     = simd::asin(simd::sin(xi1) / cosh);
+        auto lambda  = simd::atan(sinh / cos_xi1);
+
+        // the geodetic latitude from the conformal latitude
+        auto s2  = simd::sin(chi + chi);
+        auto c2  = simd::cos(chi + chi);
+        auto sj  = s2;
+        auto cj  = c2;
+        auto phi = chi;
+        for (size_t j = 0; j < 4; ++j)
+        {
+            phi       = phi + simd::set1(params.delta[j]) * sj;
+            auto next = sj * c2 + cj * s2;
+            cj        = cj * c2 - sj * s2;
+            sj        = next;
+        }
+        x = lambda / simd::set1(geodesic::RADIANS) + simd::set1(params.lng0);
+        y = phi / simd::set1(geodesic::RADIANS);
+    }
+};
+
+/// @private applies a kernel to the runs of points, simd::width points at a time
+template <typename Kernel>
+struct batch_transform
+{
+    /// the kernel transforming a batch of (x, y) coordinates in place
+    Kernel kernel;
+
+    template <typename Point>
+    void operator()(Point* points, size_t n) const
+    {
+        apply(points, n, typename is_flat_xy<Point>::type{});
+    }
+
+    /// the points are contiguous (x, y) doubles, loaded and stored without copies
+    template <typename Point>
+    void apply(Point* points, size_t n, std::true_type) const
+    {
+        double* p = &points[0].x;
+        size_t i  = 0;
+        for (; i + simd::width <= n; i += simd::width)
+        {
+            simd::batch x, y;
+            simd::load_xy(p + 2 * i, x, y);
+            kernel(x, y);
+            simd::store_xy(p + 2 * i, x, y);
+        }
+        apply(points + i, n - i, std::false_type{});
+    }
+
+    /// the coordinates are copied to a batch, the missing lanes are zeros
+    template <typename Point>
+    void apply(Point* points, size_t n, std::false_type) const
+    {
+        using coord_type = typename Point::coord_type;
+        double xs[simd::width];
+        double ys[simd::width];
+        for (size_t i = 0; i < n; i += simd::width)
+        {
+            size_t count = std::min(simd::width, n - i);
+            for (size_t j = 0; j < simd::width; ++j)
+            {
+                xs[j] = j < count ? static_cast<double>(points[i + j].x) : 0;
+                ys[j] = j < count ? static_cast<double>(points[i + j].y) : 0;
+            }
+            auto x = simd::load(xs);
+            auto y = simd::load(ys);
+            kernel(x, y);
+            simd::store(xs, x);
+            simd::store(ys, y);
+            for (size_t j = 0; j < count; ++j)
+            {
+                points[i + j].x = static_cast<coord_type>(xs[j]);
+                points[i + j].y = static_cast<coord_type>(ys[j]);
+            }
+        }
+    }
+};
+
+/// @private
+template <typename Geometry, typename Kernel>
+void transform_points(Geometry& geom, const Kernel& kernel)
+{
+    batch_transform<Kernel> f{kernel};
+    for_each_point_run(geom, typename geometry_traits<Geometry>::tag{}, f);
+}
+
+}  // namespace detail
+
+namespace projection
+{
+
+/*!
+ * @brief Projects a geometry from longitude and latitude to Web Mercator (EPSG:3857), in place
+ *
+ * The coordinates of every run of points are transformed simd::width points at a time, the
+ * logarithm of the tangent is evaluated as 2 atanh(tan(phi / 2)) with polynomial kernels,
+ * within 1e-6 meters of the libm result. The latitudes are clamped to the Web Mercator square,
+ * the z and m coordinates are left unchanged.
+ *
+ * @param geom the geometry, x is the longitude and y the latitude in degrees
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void to_web_mercator(Geometry& geom)
+{
+    detail::transform_points(geom, detail::web_mercator_forward{});
+}
+
+/*!
+ * @brief Projects a geometry from Web Mercator (EPSG:3857) to longitude and latitude, in place
+ *
+ * The latitude is evaluated as asin(tanh(y / R)) with polynomial kernels, within 1e-12 degrees
+ * of the libm result.
+ *
+ * @param geom the geometry, in meters
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void from_web_mercator(Geometry& geom)
+{
+    detail::transform_points(geom, detail::web_mercator_inverse{});
+}
+
+/*!
+ * @brief Projects a geometry from longitude and latitude to a UTM zone on WGS 84, in place
+ *
+ * The transverse Mercator projection is evaluated with the 4th order Krüger series, the series
+ * error is below 1 mm within 3000 km of the central meridian. The transcendental functions are
+ * polynomial kernels evaluated simd::width points at a time.
+ *
+ * @param geom the geometry, x is the longitude and y the latitude in degrees
+ * @param zone the UTM zone, from 1 to 60
+ * @param north whether the zone is in the northern hemisphere, otherwise the false northing applies
+ * @throw geometry_error if the zone is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void to_utm(Geometry& geom, uint32_t zone, bool north = true)
+{
+    detail::transform_points(geom, detail::utm_forward{detail::utm_parameters(zone, north)});
+}
+
+/*!
+ * @brief Projects a geometry from a UTM zone on WGS 84 to longitude and latitude, in place
+ *
+ * @param geom the geometry, eastings and northings in meters
+ * @param zone the UTM zone, from 1 to 60
+ * @param north whether the zone is in the northern hemisphere, otherwise the false northing applies
+ * @throw geometry_error if the zone is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void from_utm(Geometry& geom, uint32_t zone, bool north = true)
+{
+    detail::transform_points(geom, detail::utm_inverse{detail::utm_parameters(zone, north)});
+}
+
+}  // namespace projection
+}  // namespace shapes
+}  // namespace simo
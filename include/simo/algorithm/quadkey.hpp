@@ -0,0 +1,379 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <simo/exceptions.hpp>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/prepared_polygon.hpp>
+#include <simo/algorithm/detail/bits.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace quadkey
+{
+
+/// the deepest level, the key of a cell fits in 64 bits
+constexpr static const uint32_t MAX_LEVEL = 30;
+
+/// the latitude of the top edge of the Web Mercator square
+constexpr static const double MAX_LATITUDE = 85.051128779806592;
+
+/*!
+ * @brief A Web Mercator tile cell, the rows are numbered from the top
+ *
+ * @since 0.0.1
+ */
+struct cell
+{
+    /// the level, the world is split in 4^level cells
+    uint32_t level;
+
+    /// the column
+    uint32_t x;
+
+    /// the row
+    uint32_t y;
+
+    bool operator==(const cell& other) const noexcept
+    {
+        return level == other.level and x == other.x and y == other.y;
+    }
+
+    bool operator!=(const cell& other) const noexcept
+    {
+        return not(*this == other);
+    }
+};
+
+}  // namespace quadkey
+
+namespace detail
+{
+
+/// @private the latitude of the top edge of a row
+inline double quadkey_latitude(uint32_t y, uint32_t level) noexcept
+{
+    constexpr double pi = 3.14159265358979323846;
+    double n            = pi * (1 - 2 * std::ldexp(static_cast<double>(y), -static_cast<int>(level)));
+    return std::atan(std::sinh(n)) * 180 / pi;
+}
+
+/// @private the column and the row of a coordinate pair, as fractions of the world
+inline void quadkey_fraction(double lng, double lat, double& fx, double& fy) noexcept
+{
+    constexpr double pi = 3.14159265358979323846;
+    lat                 = std::min(quadkey::MAX_LATITUDE, std::max(-quadkey::MAX_LATITUDE, lat));
+    double sin_lat      = std::sin(lat * pi / 180);
+    fx                  = (lng + 180) / 360;
+    fy                  = 0.5 - std::log((1 + sin_lat) / (1 - sin_lat)) / (4 * pi);
+}
+
+/// @private
+inline uint32_t quadkey_index(double fraction, uint32_t level) noexcept
+{
+    double n = std::ldexp(1.0, static_cast<int>(level));
+    return static_cast<uint32_t>(std::min(n - 1, std::max(0.0, std::floor(fraction * n))));
+}
+
+/// @private
+inline void check_quadkey_level(uint32_t level)
+{
+    if (level > quadkey::MAX_LEVEL)
+    {
+        throw exceptions::geometry_error("invalid quadkey level: " + std::to_string(level));
+    }
+}
+
+/// @private whether a segment crosses or touches a bounds
+inline bool segment_intersects_bounds(const segment& s, const bounds_t& b) noexcept
+{
+    if (std::max(s.x1, s.x2) < b.minx or std::min(s.x1, s.x2) > b.maxx or std::max(s.y1, s.y2) < b.miny or
+        std::min(s.y1, s.y2) > b.maxy)
+    {
+        return false;
+    }
+    if (b.contains(s.x1, s.y1) or b.contains(s.x2, s.y2))
+    {
+        return true;
+    }
+    // the segment crosses the bounds if the corners are not all on one side of its line
+    int sides = orientation(s.x1, s.y1, s.x2, s.y2, b.minx, b.miny) + orientation(s.x1, s.y1, s.x2, s.y2, b.maxx, b.miny) +
+                orientation(s.x1, s.y1, s.x2, s.y2, b.maxx, b.maxy) + orientation(s.x1, s.y1, s.x2, s.y2, b.minx, b.maxy);
+    return sides > -4 and sides < 4;
+}
+
+}  // namespace detail
+
+namespace quadkey
+{
+
+/*!
+ * @brief Computes the cell of a coordinate pair
+ * @param lng the longitude, clamped to [-180, 180]
+ * @param lat the latitude, clamped to the Web Mercator latitudes
+ * @param level the level, from 0 to 30
+ * @return the cell
+ * @throw geometry_error if the level is out of range
+ *
+ * @since 0.0.1
+ */
+inline cell from_point(double lng, double lat, uint32_t level)
+{
+    detail::check_quadkey_level(level);
+    double fx = 0;
+    double fy = 0;
+    detail::quadkey_fraction(lng, lat, fx, fy);
+    return {level, detail::quadkey_index(fx, level), detail::quadkey_index(fy, level)};
+}
+
+/*!
+ * @brief Computes the cell of a point, x is the longitude and y the latitude
+ * @param point the point
+ * @param level the level, from 0 to 30
+ * @return the cell
+ * @throw geometry_error if the level is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename Point, typename = typename std::enable_if<std::is_class<Point>::value>::type>
+cell from_point(const Point& point, uint32_t level)
+{
+    return from_point(static_cast<double>(point.x), static_cast<double>(point.y), level);
+}
+
+/*!
+ * @param c the cell
+ * @return the bounds of the cell, in longitude and latitude
+ *
+ * @since 0.0.1
+ */
+inline bounds_t bounds(const cell& c) noexcept
+{
+    double width = std::ldexp(360.0, -static_cast<int>(c.level));
+    double minx  = -180 + width * c.x;
+    return {minx, detail::quadkey_latitude(c.y + 1, c.level), minx + width, detail::quadkey_latitude(c.y, c.level)};
+}
+
+/*!
+ * @param c the cell
+ * @return the cell one level up containing the given cell, the level 0 cell is its own parent
+ *
+ * @since 0.0.1
+ */
+inline cell parent(const cell& c) noexcept
+{
+    return c.level == 0 ? c : cell{c.level - 1, c.x / 2, c.y / 2};
+}
+
+/*!
+ * @param c the cell
+ * @return the four cells one level down, in quadkey digit order
+ *
+ * @since 0.0.1
+ */
+inline std::array<cell, 4> children(const cell& c) noexcept
+{
+    uint32_t level = c.level + 1;
+    return {{{level, 2 * c.x, 2 * c.y}, {level, 2 * c.x + 1, 2 * c.y}, {level, 2 * c.x, 2 * c.y + 1},
+             {level, 2 * c.x + 1, 2 * c.y + 1}}};
+}
+
+/*!
+ * @brief Computes the 64 bit key of a cell
+ *
+ * The key is the quadkey digits of the cell, 2 bits per level, after a leading 1 bit marking the
+ * level, so the keys of the cells of every level are distinct and the key of the parent is the
+ * key shifted right by 2 bits.
+ *
+ * @param c the cell
+ * @return the key
+ *
+ * @since 0.0.1
+ */
+inline uint64_t id(const cell& c) noexcept
+{
+    return uint64_t{1} << (2 * c.level) | detail::interleave_bits(c.y, c.x);
+}
+
+/*!
+ * @param key the key of a cell
+ * @return the cell
+ *
+ * @since 0.0.1
+ */
+inline cell from_id(uint64_t key) noexcept
+{
+    uint32_t level = 0;
+    while (key >> (2 * level + 2) != 0)
+    {
+        ++level;
+    }
+    uint64_t digits = key ^ (uint64_t{1} << (2 * level));
+    return {level, detail::compact_bits(digits), detail::compact_bits(digits >> 1)};
+}
+
+/*!
+ * @param c the cell
+ * @return the quadkey, one digit from 0 to 3 per level, empty for the level 0 cell
+ * @sa https://docs.microsoft.com/en-us/bingmaps/articles/bing-maps-tile-system
+ *
+ * @since 0.0.1
+ */
+inline std::string to_string(const cell& c)
+{
+    std::string res(c.level, '0');
+    for (uint32_t i = 0; i < c.level; ++i)
+    {
+        uint32_t bit = c.level - 1 - i;
+        res[i]       = static_cast<char>('0' + (((c.x >> bit) & 1) | ((c.y >> bit) & 1) << 1));
+    }
+    return res;
+}
+
+/*!
+ * @param text the quadkey
+ * @return the cell
+ * @throw parse_error if the quadkey is too long or has a digit out of range
+ *
+ * @since 0.0.1
+ */
+inline cell from_string(const std::string& text)
+{
+    if (text.size() > MAX_LEVEL)
+    {
+        throw exceptions::parse_error("invalid quadkey length: " + std::to_string(text.size()));
+    }
+    cell res = {static_cast<uint32_t>(text.size()), 0, 0};
+    for (auto ch : text)
+    {
+        if (ch < '0' or ch > '3')
+        {
+            throw exceptions::parse_error("invalid quadkey digit: " + std::string(1, ch));
+        }
+        auto digit = static_cast<uint32_t>(ch - '0');
+        res.x      = res.x << 1 | (digit & 1);
+        res.y      = res.y << 1 | digit >> 1;
+    }
+    return res;
+}
+
+}  // namespace quadkey
+
+namespace detail
+{
+
+/// @private adds the descendants of a cell at the given level, or the cell if it is deeper
+inline void push_descendants(const quadkey::cell& c, uint32_t level, std::vector<quadkey::cell>& res)
+{
+    if (c.level >= level)
+    {
+        res.push_back(c);
+        return;
+    }
+    for (const auto& child : quadkey::children(c))
+    {
+        push_descendants(child, level, res);
+    }
+}
+
+/// @private refines a cell, edges[level] holds the edges crossing its parent
+inline void cover_cell(const quadkey::cell& c, const prepared_polygon& polygon, uint32_t min_level,
+                       uint32_t max_level, std::vector<std::vector<segment>>& edges, std::vector<quadkey::cell>& interior,
+                       std::vector<quadkey::cell>& boundary)
+{
+    auto b           = quadkey::bounds(c);
+    const auto& from = edges[c.level];
+    auto& crossing   = edges[c.level + 1];
+    crossing.clear();
+    for (const auto& e : from)
+    {
+        if (segment_intersects_bounds(e, b))
+        {
+            crossing.push_back(e);
+        }
+    }
+    if (crossing.empty())
+    {
+        // the cell is either inside or outside, like its center
+        if (polygon.contains((b.minx + b.maxx) / 2, (b.miny + b.maxy) / 2))
+        {
+            push_descendants(c, min_level, interior);
+        }
+        return;
+    }
+    if (c.level == max_level)
+    {
+        boundary.push_back(c);
+        return;
+    }
+    for (const auto& child : quadkey::children(c))
+    {
+        cover_cell(child, polygon, min_level, max_level, edges, interior, boundary);
+    }
+}
+
+}  // namespace detail
+
+namespace quadkey
+{
+
+/*!
+ * @brief Computes the cells covering a polygon, with large cells inside and small cells along the boundary
+ *
+ * The cells are refined from the level 0 cell, a cell crossed by no edge of the polygon is an
+ * interior cell if its center is inside the polygon, otherwise it is dropped. A cell crossed by
+ * some edges is split until the maximum level, where it becomes a boundary cell. The interior
+ * cells are never larger than the minimum level. The edges are straight lines in longitude and
+ * latitude, each cell only tests the edges crossing its parent.
+ *
+ * @param polygon the polygon, x is the longitude and y the latitude
+ * @param min_level the coarsest level of the interior cells
+ * @param max_level the level of the boundary cells, from min_level to 30
+ * @param interior the cells inside the polygon, its content is replaced
+ * @param boundary the cells crossed by the boundary of the polygon, its content is replaced
+ * @throw geometry_error if the levels are out of range
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void cover(const basic_polygon<T>& polygon, uint32_t min_level, uint32_t max_level, std::vector<cell>& interior,
+           std::vector<cell>& boundary)
+{
+    detail::check_quadkey_level(max_level);
+    if (min_level > max_level)
+    {
+        throw exceptions::geometry_error("invalid quadkey levels: " + std::to_string(min_level) + " to " +
+                                         std::to_string(max_level));
+    }
+    interior.clear();
+    boundary.clear();
+
+    // the edges crossing the cell of every level along the current path
+    std::vector<std::vector<detail::segment>> edges(max_level + 2);
+    for (const auto& ring : polygon)
+    {
+        for (size_t i = 1; i < ring.size(); ++i)
+        {
+            edges[0].push_back({static_cast<double>(ring[i - 1].x), static_cast<double>(ring[i - 1].y),
+                                static_cast<double>(ring[i].x), static_cast<double>(ring[i].y)});
+        }
+    }
+    if (edges[0].empty())
+    {
+        return;
+    }
+    prepared_polygon prepared(polygon);
+    detail::cover_cell(cell{0, 0, 0}, prepared, min_level, max_level, edges, interior, boundary);
+}
+
+}  // namespace quadkey
+}  // namespace shapes
+}  // namespace simo
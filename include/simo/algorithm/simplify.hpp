@@ -0,0 +1,448 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <simo/thread_pool.hpp>
+#include <simo/algorithm/detail/kernel.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief Line simplification algorithms
+ *
+ * @since 0.0.1
+ */
+enum class simplify_method : uint8_t
+{
+    /// removes the vertices closer than the tolerance to the simplified line
+    DOUGLAS_PEUCKER = 1,
+    /// removes the vertices whose triangle with their neighbors has an area below the tolerance
+    VISVALINGAM = 2
+};
+
+namespace detail
+{
+
+/// scratch memory reused across the paths simplified by one thread
+struct simplify_buffers
+{
+    /// whether each vertex is kept
+    std::vector<uint8_t> keep;
+
+    /// the pending ranges of the Douglas-Peucker algorithm
+    std::vector<std::pair<size_t, size_t>> stack;
+
+    /// the previous remaining vertex of each vertex
+    std::vector<size_t> prev;
+
+    /// the next remaining vertex of each vertex
+    std::vector<size_t> next;
+
+    /// the current effective area of each vertex
+    std::vector<double> areas;
+
+    /// the min-heap of (area, vertex)
+    std::vector<std::pair<double, size_t>> heap;
+};
+
+/// @private
+template <typename Point>
+segment make_segment(const Point& a, const Point& b)
+{
+    return {static_cast<double>(a.x), static_cast<double>(a.y), static_cast<double>(b.x), static_cast<double>(b.y)};
+}
+
+/// @private
+template <typename Path>
+void douglas_peucker_range(const Path& path, size_t first, size_t last, double tolerance2, simplify_buffers& buffers)
+{
+    auto& stack = buffers.stack;
+    stack.clear();
+    stack.emplace_back(first, last);
+    while (not stack.empty())
+    {
+        auto range = stack.back();
+        stack.pop_back();
+        if (range.second - range.first < 2)
+        {
+            continue;
+        }
+        auto s          = make_segment(path[range.first], path[range.second]);
+        double farthest = -1;
+        size_t index    = range.first;
+        for (size_t i = range.first + 1; i < range.second; ++i)
+        {
+            double d = point_segment_distance2(static_cast<double>(path[i].x), static_cast<double>(path[i].y), s);
+            if (d > farthest)
+            {
+                farthest = d;
+                index    = i;
+            }
+        }
+        if (farthest > tolerance2)
+        {
+            buffers.keep[index] = 1;
+            stack.emplace_back(range.first, index);
+            stack.emplace_back(index, range.second);
+        }
+    }
+}
+
+/*!
+ * @brief Marks the vertices kept by the Douglas-Peucker algorithm, without recursion
+ *
+ * @return the number of kept vertices
+ */
+template <typename Path>
+size_t douglas_peucker(const Path& path, bool ring, double tolerance, simplify_buffers& buffers)
+{
+    size_t n = path.size();
+    buffers.keep.assign(n, 1);
+    if (n <= 2)
+    {
+        return n;
+    }
+    std::fill(buffers.keep.begin() + 1, buffers.keep.end() - 1, 0);
+    double tolerance2 = tolerance * tolerance;
+    if (not ring)
+    {
+        douglas_peucker_range(path, 0, n - 1, tolerance2, buffers);
+    }
+    else
+    {
+        // the endpoints of a closed ring coincide, the farthest vertex from them is the second anchor
+        double farthest = -1;
+        size_t index    = 0;
+        for (size_t i = 1; i + 1 < n; ++i)
+        {
+            double dx = static_cast<double>(path[i].x) - static_cast<double>(path[0].x);
+            double dy = static_cast<double>(path[i].y) - static_cast<double>(path[0].y);
+            if (dx * dx + dy * dy > farthest)
+            {
+                farthest = dx * dx + dy * dy;
+                index    = i;
+            }
+        }
+        if (farthest > tolerance2)
+        {
+            buffers.keep[index] = 1;
+            douglas_peucker_range(path, 0, index, tolerance2, buffers);
+            douglas_peucker_range(path, index, n - 1, tolerance2, buffers);
+        }
+    }
+    return static_cast<size_t>(std::count(buffers.keep.begin(), buffers.keep.end(), 1));
+}
+
+/// @private
+template <typename Path>
+double triangle_area(const Path& path, size_t a, size_t b, size_t c)
+{
+    return std::abs(cross(static_cast<double>(path[a].x), static_cast<double>(path[a].y), static_cast<double>(path[b].x),
+                          static_cast<double>(path[b].y), static_cast<double>(path[c].x), static_cast<double>(path[c].y))) /
+           2;
+}
+
+/*!
+ * @brief Marks the vertices kept by the Visvalingam-Whyatt algorithm, using a min-heap of effective areas
+ *
+ * @return the number of kept vertices
+ */
+template <typename Path>
+size_t visvalingam(const Path& path, double min_area, simplify_buffers& buffers)
+{
+    size_t n = path.size();
+    buffers.keep.assign(n, 1);
+    if (n <= 2)
+    {
+        return n;
+    }
+    auto& prev  = buffers.prev;
+    auto& next  = buffers.next;
+    auto& areas = buffers.areas;
+    auto& heap  = buffers.heap;
+    prev.resize(n);
+    next.resize(n);
+    areas.assign(n, 0);
+    heap.clear();
+    for (size_t i = 1; i + 1 < n; ++i)
+    {
+        prev[i]  = i - 1;
+        next[i]  = i + 1;
+        areas[i] = triangle_area(path, i - 1, i, i + 1);
+        heap.emplace_back(areas[i], i);
+    }
+    std::greater<std::pair<double, size_t>> cmp;
+    std::make_heap(heap.begin(), heap.end(), cmp);
+
+    size_t count = n;
+    while (not heap.empty())
+    {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        auto top = heap.back();
+        heap.pop_back();
+        size_t i = top.second;
+        // entries left behind by an update of the area are skipped
+        if (not buffers.keep[i] or top.first != areas[i])
+        {
+            continue;
+        }
+        if (top.first >= min_area)
+        {
+            break;
+        }
+        buffers.keep[i] = 0;
+        --count;
+        size_t p = prev[i];
+        size_t q = next[i];
+        next[p]  = q;
+        prev[q]  = p;
+        // the area of a neighbor never drops below the area of a removed vertex
+        if (p > 0)
+        {
+            areas[p] = std::max(top.first, triangle_area(path, prev[p], p, q));
+            heap.emplace_back(areas[p], p);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+        if (q + 1 < n)
+        {
+            areas[q] = std::max(top.first, triangle_area(path, p, q, next[q]));
+            heap.emplace_back(areas[q], q);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+    }
+    return count;
+}
+
+/// @private
+template <typename Path>
+void compact(Path& path, const std::vector<uint8_t>& keep)
+{
+    size_t j = 0;
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        if (keep[i])
+        {
+            if (i != j)
+            {
+                path[j] = path[i];
+            }
+            ++j;
+        }
+    }
+    path.erase(path.begin() + static_cast<std::ptrdiff_t>(j), path.end());
+}
+
+/*!
+ * @brief Simplifies a path in place
+ *
+ * @return false if a ring collapsed below 3 distinct vertices, otherwise true
+ */
+template <typename Path>
+bool simplify_path(Path& path, bool ring, double tolerance, simplify_method method, simplify_buffers& buffers)
+{
+    size_t n     = path.size();
+    bool closed  = ring and n > 1 and path.front() == path.back();
+    size_t count = method == simplify_method::VISVALINGAM ? visvalingam(path, tolerance, buffers)
+                                                          : douglas_peucker(path, closed, tolerance, buffers);
+    if (count < n)
+    {
+        compact(path, buffers.keep);
+    }
+    return not ring or count >= (closed ? 4u : 3u);
+}
+
+/// @private
+template <typename LineString>
+void simplify(LineString& linestring, double tolerance, simplify_method method, simplify_buffers& buffers, linestring_tag)
+{
+    simplify_path(linestring, false, tolerance, method, buffers);
+}
+
+/// @private
+template <typename MultiLineString>
+void simplify(MultiLineString& multilinestring, double tolerance, simplify_method method, simplify_buffers& buffers,
+              multilinestring_tag)
+{
+    for (auto& linestring : multilinestring)
+    {
+        simplify_path(linestring, false, tolerance, method, buffers);
+    }
+}
+
+/// @private
+template <typename Polygon>
+void simplify(Polygon& polygon, double tolerance, simplify_method method, simplify_buffers& buffers, polygon_tag)
+{
+    if (polygon.empty())
+    {
+        return;
+    }
+    // a collapsed shell empties the polygon, collapsed holes are removed
+    if (not simplify_path(polygon[0], true, tolerance, method, buffers))
+    {
+        polygon.clear();
+        return;
+    }
+    size_t j = 1;
+    for (size_t i = 1; i < polygon.size(); ++i)
+    {
+        if (simplify_path(polygon[i], true, tolerance, method, buffers))
+        {
+            if (i != j)
+            {
+                polygon[j] = std::move(polygon[i]);
+            }
+            ++j;
+        }
+    }
+    polygon.erase(polygon.begin() + static_cast<std::ptrdiff_t>(j), polygon.end());
+}
+
+/// @private
+template <typename MultiPolygon>
+void simplify(MultiPolygon& multipolygon, double tolerance, simplify_method method, simplify_buffers& buffers,
+              multipolygon_tag)
+{
+    for (auto& polygon : multipolygon)
+    {
+        simplify(polygon, tolerance, method, buffers, polygon_tag{});
+    }
+}
+
+/// @private
+template <typename Geometry, typename Tag>
+void simplify(Geometry&, double, simplify_method, simplify_buffers&, Tag)
+{}
+
+/// @private
+template <typename MultiPolygon>
+void remove_empty(MultiPolygon& multipolygon, multipolygon_tag)
+{
+    multipolygon.erase(std::remove_if(multipolygon.begin(), multipolygon.end(),
+                                      [](const typename MultiPolygon::value_type& polygon) { return polygon.empty(); }),
+                       multipolygon.end());
+}
+
+/// @private
+template <typename Geometry, typename Tag>
+void remove_empty(Geometry&, Tag)
+{}
+
+/// @private
+template <typename MultiGeometry, typename Tag>
+void simplify_parts(MultiGeometry& multi, size_t first, size_t last, double tolerance, simplify_method method, Tag)
+{
+    using part_tag = typename geometry_traits<typename MultiGeometry::value_type>::tag;
+    simplify_buffers buffers;
+    for (size_t i = first; i < last; ++i)
+    {
+        simplify(multi[i], tolerance, method, buffers, part_tag{});
+    }
+}
+
+/// @private
+template <typename Geometry>
+void simplify_parts(Geometry&, size_t, size_t, double, simplify_method, point_tag)
+{}
+
+/// @private
+template <typename Geometry>
+void simplify_parts(Geometry&, size_t, size_t, double, simplify_method, multipoint_tag)
+{}
+
+/// @private
+template <typename Geometry>
+void simplify_parts(Geometry& geom, size_t, size_t, double tolerance, simplify_method method, linestring_tag)
+{
+    simplify_buffers buffers;
+    simplify(geom, tolerance, method, buffers, linestring_tag{});
+}
+
+/// @private
+template <typename Geometry>
+void simplify_parts(Geometry& geom, size_t, size_t, double tolerance, simplify_method method, polygon_tag)
+{
+    simplify_buffers buffers;
+    simplify(geom, tolerance, method, buffers, polygon_tag{});
+}
+
+/// @private
+template <typename Geometry>
+size_t num_parts(const Geometry& geom, multilinestring_tag)
+{
+    return geom.size();
+}
+
+/// @private
+template <typename Geometry>
+size_t num_parts(const Geometry& geom, multipolygon_tag)
+{
+    return geom.size();
+}
+
+/// @private
+template <typename Geometry, typename Tag>
+size_t num_parts(const Geometry&, Tag)
+{
+    return 1;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Simplifies a geometry in place
+ *
+ * The first and last vertices of every linestring are kept. Rings keep their closure, a ring
+ * that collapses below three distinct vertices is removed, together with its polygon if it is
+ * the shell. Points and multipoints are left unchanged.
+ *
+ * @param geom the linestring, multilinestring, polygon or multipolygon
+ * @param tolerance the maximum distance for simplify_method::DOUGLAS_PEUCKER, the minimum
+ * triangle area for simplify_method::VISVALINGAM
+ * @param method the simplification algorithm
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void simplify(Geometry& geom, double tolerance, simplify_method method = simplify_method::DOUGLAS_PEUCKER)
+{
+    using tag = typename geometry_traits<Geometry>::tag;
+    detail::simplify_buffers buffers;
+    detail::simplify(geom, tolerance, method, buffers, tag{});
+    detail::remove_empty(geom, tag{});
+}
+
+/*!
+ * @brief Simplifies a geometry in place, the parts of a multigeometry are simplified concurrently
+ *
+ * @param geom the linestring, multilinestring, polygon or multipolygon
+ * @param tolerance the maximum distance for simplify_method::DOUGLAS_PEUCKER, the minimum
+ * triangle area for simplify_method::VISVALINGAM
+ * @param method the simplification algorithm
+ * @param pool the thread pool running the tasks
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+void simplify(Geometry& geom, double tolerance, simplify_method method, thread_pool& pool)
+{
+    using tag    = typename geometry_traits<Geometry>::tag;
+    size_t parts = detail::num_parts(geom, tag{});
+    // a few tasks per thread balance parts of uneven size
+    size_t grain = std::max<size_t>(1, parts / (4 * pool.size()));
+    parallel_for(pool, 0, parts, grain, [&geom, tolerance, method](size_t lo, size_t hi) {
+        detail::simplify_parts(geom, lo, hi, tolerance, method, tag{});
+    });
+    detail::remove_empty(geom, tag{});
+}
+
+}  // namespace shapes
+}  // namespace simo
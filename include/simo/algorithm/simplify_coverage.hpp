@@ -0,0 +1,456 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <simo/algorithm/simplify.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace detail
+{
+
+/// the planar position of a vertex, used as a hash key
+struct xy_key
+{
+    double x;
+    double y;
+
+    bool operator==(const xy_key& other) const noexcept
+    {
+        return x == other.x and y == other.y;
+    }
+
+    bool operator!=(const xy_key& other) const noexcept
+    {
+        return not(*this == other);
+    }
+
+    bool operator<(const xy_key& other) const noexcept
+    {
+        return x < other.x or (x == other.x and y < other.y);
+    }
+};
+
+/// @private
+inline uint64_t mix(uint64_t value) noexcept
+{
+    // the finalizer of splitmix64
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/// @private
+struct xy_key_hash
+{
+    uint64_t operator()(const xy_key& key) const noexcept
+    {
+        uint64_t x;
+        uint64_t y;
+        std::memcpy(&x, &key.x, sizeof(x));
+        std::memcpy(&y, &key.y, sizeof(y));
+        return mix(x ^ mix(y));
+    }
+};
+
+/// @private
+template <typename Point>
+xy_key make_key(const Point& p) noexcept
+{
+    // adding zero folds -0.0 into 0.0
+    return {static_cast<double>(p.x) + 0.0, static_cast<double>(p.y) + 0.0};
+}
+
+/// a ring as a sequence of arcs
+struct arc_ref
+{
+    /// the index of the arc
+    size_t arc;
+
+    /// whether the ring walks the arc backwards
+    bool reversed;
+};
+
+/*!
+ * @brief Splits the rings of a polygon coverage in arcs, the borders shared by two rings become a single arc
+ *
+ * Junctions are the vertices whose neighbors differ between the rings visiting them, the
+ * rings are cut at their junctions and each run of vertices is hashed in a canonical
+ * direction to find its twin in the neighbor ring. The vertices are indexed in a flat open
+ * addressing table, a node based map costs more than the simplification itself.
+ */
+template <typename Polygon>
+class coverage
+{
+  public:
+    using ring_type  = typename Polygon::value_type;
+    using point_type = typename ring_type::value_type;
+
+    explicit coverage(std::vector<Polygon*> polygons) : m_polygons(std::move(polygons))
+    {
+        for (auto* polygon : m_polygons)
+        {
+            for (auto& ring : *polygon)
+            {
+                m_rings.push_back(&ring);
+            }
+        }
+        find_junctions();
+        m_ring_arcs.resize(m_rings.size());
+        for (size_t i = 0; i < m_rings.size(); ++i)
+        {
+            split(i);
+        }
+    }
+
+    /// @return the number of distinct arcs
+    size_t num_arcs() const noexcept
+    {
+        return m_arcs.size();
+    }
+
+    /// simplifies every arc once and rebuilds the rings
+    void simplify(double tolerance, simplify_method method)
+    {
+        simplify_buffers buffers;
+        for (size_t i = 0; i < m_arcs.size(); ++i)
+        {
+            // closed arcs are whole rings without junctions
+            if (not simplify_path(m_arcs[i], m_closed[i], tolerance, method, buffers))
+            {
+                m_arcs[i].clear();
+            }
+        }
+        for (size_t i = 0; i < m_rings.size(); ++i)
+        {
+            if (not m_ring_arcs[i].empty())
+            {
+                assemble(i);
+            }
+        }
+        remove_collapsed();
+    }
+
+  private:
+    /// @return the number of distinct vertices of the ring, the closing vertex is not counted
+    static size_t distinct_size(const ring_type& ring) noexcept
+    {
+        size_t n = ring.size();
+        return n > 1 and ring.front() == ring.back() ? n - 1 : n;
+    }
+
+    /// @private
+    void find_junctions()
+    {
+        // each ring is stored between copies of its last and first vertices, so that every
+        // vertex has both neighbors next to it
+        m_offsets.push_back(0);
+        for (auto* ring : m_rings)
+        {
+            size_t m = distinct_size(*ring);
+            m_offsets.push_back(m_offsets.back() + (m < 3 ? 0 : m + 2));
+        }
+        m_keys.reserve(m_offsets.back());
+        for (auto* ring : m_rings)
+        {
+            size_t m = distinct_size(*ring);
+            if (m < 3)
+            {
+                continue;
+            }
+            m_keys.push_back(make_key((*ring)[m - 1]));
+            for (size_t i = 0; i < m; ++i)
+            {
+                m_keys.push_back(make_key((*ring)[i]));
+            }
+            m_keys.push_back(make_key((*ring)[0]));
+        }
+
+        size_t capacity = 16;
+        while (capacity < 2 * m_keys.size())
+        {
+            capacity *= 2;
+        }
+        const uint32_t empty = UINT32_MAX;
+        std::vector<uint32_t> slots(capacity, empty);
+        m_first.assign(m_keys.size(), empty);
+        m_junction.assign(m_keys.size(), 0);
+        xy_key_hash hash;
+        for (size_t r = 0; r < m_rings.size(); ++r)
+        {
+            size_t lo = m_offsets[r] + 1;
+            size_t hi = m_offsets[r + 1] - 1;
+            for (size_t v = lo; v < hi; ++v)
+            {
+                const auto& key = m_keys[v];
+                auto slot       = static_cast<size_t>(hash(key)) & (capacity - 1);
+                while (slots[slot] != empty and m_keys[slots[slot]] != key)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                if (slots[slot] == empty)
+                {
+                    slots[slot] = static_cast<uint32_t>(v);
+                    m_first[v]  = static_cast<uint32_t>(v);
+                    continue;
+                }
+                // a shared border is walked in the same or in the opposite direction
+                uint32_t first = slots[slot];
+                const auto& p  = m_keys[first - 1];
+                const auto& q  = m_keys[first + 1];
+                bool same      = (p == m_keys[v - 1] and q == m_keys[v + 1]) or (p == m_keys[v + 1] and q == m_keys[v - 1]);
+                m_first[v]     = first;
+                m_junction[first] |= static_cast<uint8_t>(not same);
+            }
+        }
+    }
+
+    /// @return the arc equal to the given run in any direction, adding it if missing
+    arc_ref intern(ring_type& run, bool closed)
+    {
+        // the canonical direction starts at the smaller endpoint, or the smaller second vertex for closed runs
+        size_t n      = run.size();
+        auto first    = make_key(run[closed ? 1 : 0]);
+        auto last     = make_key(run[closed ? n - 2 : n - 1]);
+        bool reversed = last < first;
+        if (not closed and first == last and n > 2)
+        {
+            reversed = make_key(run[n - 2]) < make_key(run[1]);
+        }
+        if (reversed)
+        {
+            std::reverse(run.begin(), run.end());
+        }
+
+        uint64_t seed = closed ? 1 : 0;
+        xy_key_hash hash;
+        for (const auto& p : run)
+        {
+            seed = mix(seed + hash(make_key(p)));
+        }
+        auto& candidates = m_arc_index[seed];
+        for (auto id : candidates)
+        {
+            if (m_closed[id] == closed and m_arcs[id].size() == run.size() and
+                std::equal(run.begin(), run.end(), m_arcs[id].begin(),
+                           [](const point_type& a, const point_type& b) { return make_key(a) == make_key(b); }))
+            {
+                return {id, reversed};
+            }
+        }
+        candidates.push_back(m_arcs.size());
+        m_arcs.push_back(run);
+        m_closed.push_back(closed);
+        return {m_arcs.size() - 1, reversed};
+    }
+
+    /// @private
+    void split(size_t index)
+    {
+        const auto& r = *m_rings[index];
+        size_t lo     = m_offsets[index] + 1;
+        size_t m      = m_offsets[index + 1] - m_offsets[index];
+        if (m == 0)
+        {
+            return;
+        }
+        m -= 2;
+
+        std::vector<size_t> junctions;
+        for (size_t i = 0; i < m; ++i)
+        {
+            if (m_junction[m_first[lo + i]])
+            {
+                junctions.push_back(i);
+            }
+        }
+
+        auto& refs = m_ring_arcs[index];
+        ring_type run;
+        if (junctions.empty())
+        {
+            // the whole ring is one arc, starting at its smallest vertex so that twin rings match
+            size_t start = 0;
+            for (size_t i = 1; i < m; ++i)
+            {
+                if (make_key(r[i]) < make_key(r[start]))
+                {
+                    start = i;
+                }
+            }
+            for (size_t k = 0; k <= m; ++k)
+            {
+                run.push_back(r[(start + k) % m]);
+            }
+            refs.push_back(intern(run, true));
+            return;
+        }
+
+        for (size_t k = 0; k < junctions.size(); ++k)
+        {
+            size_t from = junctions[k];
+            size_t to   = k + 1 < junctions.size() ? junctions[k + 1] : junctions[0] + m;
+            run.clear();
+            for (size_t i = from; i <= to; ++i)
+            {
+                run.push_back(r[i % m]);
+            }
+            refs.push_back(intern(run, false));
+        }
+    }
+
+    /// @private
+    void assemble(size_t index)
+    {
+        auto& ring = *m_rings[index];
+        ring.clear();
+        for (const auto& ref : m_ring_arcs[index])
+        {
+            const auto& arc = m_arcs[ref.arc];
+            if (arc.empty())
+            {
+                ring.clear();
+                return;
+            }
+            // consecutive arcs share their junction
+            size_t skip = ring.empty() ? 0 : 1;
+            if (ref.reversed)
+            {
+                ring.insert(ring.end(), arc.rbegin() + static_cast<std::ptrdiff_t>(skip), arc.rend());
+            }
+            else
+            {
+                ring.insert(ring.end(), arc.begin() + static_cast<std::ptrdiff_t>(skip), arc.end());
+            }
+        }
+    }
+
+    /// @private
+    void remove_collapsed()
+    {
+        // a shell with less than three distinct vertices empties the polygon, such holes are removed
+        for (auto* polygon : m_polygons)
+        {
+            auto& p = *polygon;
+            if (p.empty())
+            {
+                continue;
+            }
+            if (distinct_size(p[0]) < 3)
+            {
+                p.clear();
+                continue;
+            }
+            p.erase(std::remove_if(p.begin() + 1, p.end(), [](const ring_type& ring) { return distinct_size(ring) < 3; }),
+                    p.end());
+        }
+    }
+
+    /// the polygons of the coverage
+    std::vector<Polygon*> m_polygons;
+
+    /// the rings of every polygon
+    std::vector<ring_type*> m_rings;
+
+    /// the distinct vertices of every ring padded with their neighbors, rings with less than three are left empty
+    std::vector<xy_key> m_keys;
+
+    /// the position in m_keys of the padded vertices of each ring
+    std::vector<size_t> m_offsets;
+
+    /// the first occurrence of the position of each vertex
+    std::vector<uint32_t> m_first;
+
+    /// whether the first occurrence of a position is a junction
+    std::vector<uint8_t> m_junction;
+
+    /// the distinct arcs, in canonical direction
+    std::vector<ring_type> m_arcs;
+
+    /// whether each arc is a whole ring
+    std::vector<uint8_t> m_closed;
+
+    /// the arcs with a given hash
+    std::unordered_map<uint64_t, std::vector<size_t>> m_arc_index;
+
+    /// the arcs of every ring
+    std::vector<std::vector<arc_ref>> m_ring_arcs;
+};
+
+/// @private
+template <typename Polygon>
+void collect_polygons(Polygon& polygon, std::vector<Polygon*>& res, polygon_tag)
+{
+    res.push_back(&polygon);
+}
+
+/// @private
+template <typename MultiPolygon>
+void collect_polygons(MultiPolygon& multipolygon, std::vector<typename MultiPolygon::value_type*>& res, multipolygon_tag)
+{
+    for (auto& polygon : multipolygon)
+    {
+        res.push_back(&polygon);
+    }
+}
+
+/// @private
+template <typename Geometry>
+struct polygon_type_of
+{
+    using type = typename std::conditional<std::is_same<typename geometry_traits<Geometry>::tag, multipolygon_tag>::value,
+                                           typename Geometry::value_type, Geometry>::type;
+};
+
+}  // namespace detail
+
+/*!
+ * @brief Simplifies a collection of polygons or multipolygons in place, without opening gaps or
+ * overlaps between neighbors
+ *
+ * The borders shared by two polygons are detected by hashing the runs of vertices between
+ * junctions, each shared border is simplified once and both polygons get the same result.
+ * Collapsed rings are removed as in simplify(), a polygon whose shell collapses is left
+ * empty so the collection keeps its size.
+ *
+ * @param geoms the polygons or multipolygons, e.g. a std::vector<MultiPolygon>
+ * @param tolerance the maximum distance for simplify_method::DOUGLAS_PEUCKER, the minimum
+ * triangle area for simplify_method::VISVALINGAM
+ * @param method the simplification algorithm
+ * @return the number of distinct arcs simplified
+ * @note the neighbors must share their borders vertex by vertex, as in a topologically clean coverage
+ *
+ * @since 0.0.1
+ */
+template <typename Range>
+size_t simplify_coverage(Range& geoms, double tolerance, simplify_method method = simplify_method::DOUGLAS_PEUCKER)
+{
+    using geometry_type = typename Range::value_type;
+    using polygon_type  = typename detail::polygon_type_of<geometry_type>::type;
+    using tag           = typename geometry_traits<geometry_type>::tag;
+
+    std::vector<polygon_type*> polygons;
+    for (auto& geom : geoms)
+    {
+        detail::collect_polygons(geom, polygons, tag{});
+    }
+    detail::coverage<polygon_type> arcs(std::move(polygons));
+    arcs.simplify(tolerance, method);
+    for (auto& geom : geoms)
+    {
+        detail::remove_empty(geom, tag{});
+    }
+    return arcs.num_arcs();
+}
+
+}  // namespace shapes
+}  // namespace simo
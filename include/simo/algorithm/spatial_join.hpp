@@ -0,0 +1,183 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <simo/algorithm/predicates.hpp>
+#include <simo/index/strtree.hpp>
+#include <simo/thread_pool.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief The predicate evaluated between the pairs of a spatial join
+ *
+ * @since 0.0.1
+ */
+enum class spatial_predicate : uint8_t
+{
+    INTERSECTS = 1,
+    CONTAINS   = 2,
+    WITHIN     = 3,
+    DWITHIN    = 4
+};
+
+/*!
+ * @brief Spatial join settings
+ *
+ * @since 0.0.1
+ */
+struct spatial_join_options
+{
+    /// the distance threshold used by spatial_predicate::DWITHIN
+    double distance = 0;
+
+    /// the number of threads, zero means one per hardware thread
+    size_t num_threads = 0;
+
+    /// the number of left geometries processed by each task
+    size_t chunk_size = 4096;
+
+    /// the maximum number of children per node of the right side index
+    size_t node_capacity = 16;
+};
+
+namespace detail
+{
+
+/// @private
+template <typename GeometryA, typename GeometryB>
+bool evaluate(spatial_predicate predicate, const GeometryA& a, const GeometryB& b, double max_distance)
+{
+    switch (predicate)
+    {
+        case spatial_predicate::CONTAINS:
+            return contains(a, b);
+        case spatial_predicate::WITHIN:
+            return within(a, b);
+        case spatial_predicate::DWITHIN:
+            return dwithin(a, b, max_distance);
+        default:
+            return intersects(a, b);
+    }
+}
+
+/// @private
+template <typename Range>
+strtree build_index(const Range& geoms, size_t node_capacity)
+{
+    std::vector<bounds_t> boxes;
+    boxes.reserve(geoms.size());
+    for (const auto& geom : geoms)
+    {
+        boxes.push_back(geom.bounds());
+    }
+    return strtree(boxes.begin(), boxes.end(), node_capacity);
+}
+
+/// @private
+template <typename LeftRange, typename RightRange>
+std::vector<std::pair<size_t, size_t>> join_chunk(const LeftRange& left, const RightRange& right, const strtree& tree,
+                                                  spatial_predicate predicate, double max_distance, size_t lo, size_t hi)
+{
+    std::vector<std::pair<size_t, size_t>> res;
+    std::vector<size_t> candidates;
+    for (size_t i = lo; i < hi; ++i)
+    {
+        const auto& geom = left[i];
+        auto b           = geom.bounds();
+        if (predicate == spatial_predicate::DWITHIN)
+        {
+            b.expand(max_distance);
+        }
+        candidates.clear();
+        tree.query(b, [&candidates](size_t j) { candidates.push_back(j); });
+        std::sort(candidates.begin(), candidates.end());
+        for (auto j : candidates)
+        {
+            if (evaluate(predicate, geom, right[j], max_distance))
+            {
+                res.emplace_back(i, j);
+            }
+        }
+    }
+    return res;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Finds the pairs (i, j) such that predicate(left[i], right[j]) holds
+ *
+ * The right side is indexed with a packed R-tree, the left side is split in chunks
+ * that are filtered against the index and refined concurrently in the given pool, or on the
+ * calling thread if it is a thread of the pool, as for parallel_for.
+ *
+ * @param left the left geometries, any random access range
+ * @param right the right geometries, any random access range, ideally the smaller or static side
+ * @param predicate the spatial predicate
+ * @param pool the thread pool running the chunks
+ * @param options the join settings, options.num_threads is ignored
+ * @return the matching (left index, right index) pairs sorted by left index and then by right index
+ *
+ * @since 0.0.1
+ */
+template <typename LeftRange, typename RightRange>
+std::vector<std::pair<size_t, size_t>> spatial_join(const LeftRange& left, const RightRange& right, spatial_predicate predicate,
+                                                    thread_pool& pool, const spatial_join_options& options = spatial_join_options{})
+{
+    auto tree = detail::build_index(right, options.node_capacity);
+
+    size_t n     = left.size();
+    size_t grain = std::max<size_t>(1, options.chunk_size);
+    std::vector<std::vector<std::pair<size_t, size_t>>> parts((n + grain - 1) / grain);
+    parallel_for(pool, 0, n, grain, [&left, &right, &tree, predicate, &options, grain, &parts](size_t lo, size_t hi) {
+        parts[lo / grain] = detail::join_chunk(left, right, tree, predicate, options.distance, lo, hi);
+    });
+
+    size_t total = 0;
+    for (const auto& part : parts)
+    {
+        total += part.size();
+    }
+    std::vector<std::pair<size_t, size_t>> res;
+    res.reserve(total);
+    for (const auto& part : parts)
+    {
+        res.insert(res.end(), part.begin(), part.end());
+    }
+    return res;
+}
+
+/*!
+ * @brief Finds the pairs (i, j) such that predicate(left[i], right[j]) holds
+ *
+ * @param left the left geometries, any random access range
+ * @param right the right geometries, any random access range, ideally the smaller or static side
+ * @param predicate the spatial predicate
+ * @param options the join settings
+ * @return the matching (left index, right index) pairs sorted by left index and then by right index
+ *
+ * @since 0.0.1
+ */
+template <typename LeftRange, typename RightRange>
+std::vector<std::pair<size_t, size_t>> spatial_join(const LeftRange& left, const RightRange& right, spatial_predicate predicate,
+                                                    const spatial_join_options& options = spatial_join_options{})
+{
+    size_t num_threads = options.num_threads == 0 ? thread_pool::default_concurrency() : options.num_threads;
+    if (num_threads == 1 or left.size() <= options.chunk_size)
+    {
+        auto tree = detail::build_index(right, options.node_capacity);
+        return detail::join_chunk(left, right, tree, predicate, options.distance, 0, left.size());
+    }
+    thread_pool pool(num_threads);
+    return spatial_join(left, right, predicate, pool, options);
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <simo/thread_pool.hpp>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/detail/bits.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief The space filling curves ordering the geometries
+ *
+ * @since 0.0.1
+ */
+enum class space_filling_curve
+{
+    /// the Z-order curve, the interleaved bits of the coordinates
+    MORTON,
+    /// the Hilbert curve, consecutive keys are always adjacent cells
+    HILBERT
+};
+
+namespace detail
+{
+
+/// @private the Hilbert index of a cell of the 2^32 by 2^32 grid
+inline uint64_t hilbert_index(uint32_t x, uint32_t y) noexcept
+{
+    // a branchless prefix scan of the curve orientations over the bits of x and y
+    constexpr uint64_t mask = 0xffffffffULL;
+    uint64_t a              = static_cast<uint64_t>(x) ^ y;
+    uint64_t b              = mask ^ a;
+    uint64_t c              = mask ^ (static_cast<uint64_t>(x) | y);
+    uint64_t d              = x & (y ^ mask);
+
+    uint64_t sa = a | (b >> 1);
+    uint64_t sb = (a >> 1) ^ a;
+    uint64_t sc = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint64_t sd = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+    for (uint32_t shift = 2; shift < 16; shift *= 2)
+    {
+        a  = sa;
+        b  = sb;
+        c  = sc;
+        d  = sd;
+        sa = (a & (a >> shift)) ^ (b & (b >> shift));
+        sb = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+        sc ^= (a & (c >> shift)) ^ (b & (d >> shift));
+        sd ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+    }
+    a = sa;
+    b = sb;
+    c = sc;
+    d = sd;
+    sc ^= (a & (c >> 16)) ^ (b & (d >> 16));
+    sd ^= (b & (c >> 16)) ^ ((a ^ b) & (d >> 16));
+
+    a            = sc ^ (sc >> 1);
+    b            = sd ^ (sd >> 1);
+    uint64_t low = static_cast<uint64_t>(x) ^ y;
+    uint64_t top = b | (mask ^ (low | a));
+    return interleave_bits(static_cast<uint32_t>(top), static_cast<uint32_t>(low));
+}
+
+/// @private
+inline uint64_t curve_key(double x, double y, const bounds_t& extent, space_filling_curve curve) noexcept
+{
+    uint32_t qx = quantize_bits(x, extent.minx, extent.maxx - extent.minx);
+    uint32_t qy = quantize_bits(y, extent.miny, extent.maxy - extent.miny);
+    return curve == space_filling_curve::MORTON ? interleave_bits(qx, qy) : hilbert_index(qx, qy);
+}
+
+/// @private
+template <typename Curve>
+void curve_keys(const bounds_t* boxes, size_t n, const bounds_t& extent, uint64_t* res, Curve key) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        res[i] = key((boxes[i].minx + boxes[i].maxx) / 2, (boxes[i].miny + boxes[i].maxy) / 2, extent);
+    }
+}
+
+/// @private
+template <typename Pair>
+void merge_sorted_runs(std::vector<Pair>& items, size_t run, thread_pool* pool)
+{
+    // merges the pairs of consecutive runs, doubling the run length every round
+    for (; run < items.size(); run *= 2)
+    {
+        size_t num_merges = (items.size() + 2 * run - 1) / (2 * run);
+        auto merge        = [&items, run](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++i)
+            {
+                auto first  = items.begin() + static_cast<std::ptrdiff_t>(2 * run * i);
+                auto middle = items.begin() + static_cast<std::ptrdiff_t>(std::min(items.size(), (2 * i + 1) * run));
+                auto last   = items.begin() + static_cast<std::ptrdiff_t>(std::min(items.size(), 2 * run * (i + 1)));
+                std::inplace_merge(first, middle, last);
+            }
+        };
+        if (pool != nullptr and num_merges > 1)
+        {
+            parallel_for(*pool, 0, num_merges, 1, merge);
+        }
+        else
+        {
+            merge(0, num_merges);
+        }
+    }
+}
+
+/// @private sorts a range by the keys of the centers of its bounds
+template <typename Iterator>
+void spatial_sort(Iterator first, Iterator last, space_filling_curve curve, thread_pool* pool)
+{
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+    auto n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2)
+    {
+        return;
+    }
+    size_t num_chunks = pool == nullptr ? 1 : std::min(n, pool->size());
+    size_t chunk      = (n + num_chunks - 1) / num_chunks;
+
+    // the extent of the range, then the keys and a chunk sort in a second pass
+    std::vector<bounds_t> boxes(n);
+    std::vector<bounds_t> extents(num_chunks);
+    auto measure = [&](size_t lo, size_t hi) {
+        bounds_t extent;
+        for (size_t i = lo; i < hi; ++i)
+        {
+            boxes[i] = first[static_cast<std::ptrdiff_t>(i)].bounds();
+            extent.extend(boxes[i]);
+        }
+        extents[lo / chunk] = extent;
+    };
+    std::vector<std::pair<uint64_t, size_t>> order(n);
+    bounds_t extent;
+    auto sort = [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i)
+        {
+            const auto& b = boxes[i];
+            // the bounds of an empty geometry are inverted
+            uint64_t key = b.minx > b.maxx ? 0 : curve_key((b.minx + b.maxx) / 2, (b.miny + b.maxy) / 2, extent, curve);
+            order[i]     = {key, i};
+        }
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(lo), order.begin() + static_cast<std::ptrdiff_t>(hi));
+    };
+    if (pool != nullptr and num_chunks > 1)
+    {
+        parallel_for(*pool, 0, n, chunk, measure);
+        for (const auto& e : extents)
+        {
+            extent.extend(e);
+        }
+        parallel_for(*pool, 0, n, chunk, sort);
+    }
+    else
+    {
+        measure(0, n);
+        extent = extents[0];
+        sort(0, n);
+    }
+    merge_sorted_runs(order, chunk, pool);
+
+    std::vector<value_type> sorted;
+    sorted.reserve(n);
+    for (const auto& item : order)
+    {
+        sorted.push_back(std::move(first[static_cast<std::ptrdiff_t>(item.second)]));
+    }
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Computes the Morton key of a point
+ *
+ * The coordinates are quantized to 32 bits in the extent, the coordinates out of the extent are
+ * clamped, then their bits are interleaved, x taking the highest bit.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param extent the bounds mapped to the curve
+ * @return the Morton key
+ *
+ * @since 0.0.1
+ */
+inline uint64_t morton_key(double x, double y, const bounds_t& extent) noexcept
+{
+    return detail::curve_key(x, y, extent, space_filling_curve::MORTON);
+}
+
+/*!
+ * @brief Computes the Hilbert key of a point
+ *
+ * The coordinates are quantized to 32 bits in the extent, the coordinates out of the extent are
+ * clamped. The curve index is computed without branches, with a parallel prefix scan over the
+ * bits of the coordinates.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param extent the bounds mapped to the curve
+ * @return the Hilbert key
+ *
+ * @since 0.0.1
+ */
+inline uint64_t hilbert_key(double x, double y, const bounds_t& extent) noexcept
+{
+    return detail::curve_key(x, y, extent, space_filling_curve::HILBERT);
+}
+
+/*!
+ * @brief Computes the Morton key of a point
+ * @param point the point
+ * @param extent the bounds mapped to the curve
+ * @return the Morton key
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+uint64_t morton_key(const basic_point<T>& point, const bounds_t& extent) noexcept
+{
+    return morton_key(static_cast<double>(point.x), static_cast<double>(point.y), extent);
+}
+
+/*!
+ * @brief Computes the Hilbert key of a point
+ * @param point the point
+ * @param extent the bounds mapped to the curve
+ * @return the Hilbert key
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+uint64_t hilbert_key(const basic_point<T>& point, const bounds_t& extent) noexcept
+{
+    return hilbert_key(static_cast<double>(point.x), static_cast<double>(point.y), extent);
+}
+
+/*!
+ * @brief Computes the Morton keys of many points
+ * @param points the points
+ * @param extent the bounds mapped to the curve
+ * @param res the keys, in the order of the points, its content is replaced
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void morton_keys(const basic_multipoint<T>& points, const bounds_t& extent, std::vector<uint64_t>& res)
+{
+    res.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        res[i] = morton_key(static_cast<double>(points[i].x), static_cast<double>(points[i].y), extent);
+    }
+}
+
+/*!
+ * @brief Computes the Hilbert keys of many points
+ * @param points the points
+ * @param extent the bounds mapped to the curve
+ * @param res the keys, in the order of the points, its content is replaced
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void hilbert_keys(const basic_multipoint<T>& points, const bounds_t& extent, std::vector<uint64_t>& res)
+{
+    res.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        res[i] = hilbert_key(static_cast<double>(points[i].x), static_cast<double>(points[i].y), extent);
+    }
+}
+
+/*!
+ * @brief Computes the Morton keys of the centers of many bounds
+ * @param boxes the bounds
+ * @param extent the bounds mapped to the curve
+ * @param res the keys, in the order of the bounds, its content is replaced
+ *
+ * @since 0.0.1
+ */
+inline void morton_keys(const std::vector<bounds_t>& boxes, const bounds_t& extent, std::vector<uint64_t>& res)
+{
+    res.resize(boxes.size());
+    detail::curve_keys(boxes.data(), boxes.size(), extent, res.data(),
+                       [](double x, double y, const bounds_t& e) { return morton_key(x, y, e); });
+}
+
+/*!
+ * @brief Computes the Hilbert keys of the centers of many bounds
+ * @param boxes the bounds
+ * @param extent the bounds mapped to the curve
+ * @param res the keys, in the order of the bounds, its content is replaced
+ *
+ * @since 0.0.1
+ */
+inline void hilbert_keys(const std::vector<bounds_t>& boxes, const bounds_t& extent, std::vector<uint64_t>& res)
+{
+    res.resize(boxes.size());
+    detail::curve_keys(boxes.data(), boxes.size(), extent, res.data(),
+                       [](double x, double y, const bounds_t& e) { return hilbert_key(x, y, e); });
+}
+
+/*!
+ * @brief Reorders a range of geometries along a space filling curve
+ *
+ * The geometries are sorted by the key of the center of their bounds, in the extent of the
+ * range, so the geometries close in space end up close in memory. The ties keep their order,
+ * the empty geometries get the key 0.
+ *
+ * @param first the first geometry
+ * @param last the past-the-end geometry
+ * @param curve the space filling curve
+ *
+ * @since 0.0.1
+ */
+template <typename Iterator>
+void spatial_sort(Iterator first, Iterator last, space_filling_curve curve = space_filling_curve::HILBERT)
+{
+    detail::spatial_sort(first, last, curve, nullptr);
+}
+
+/*!
+ * @brief Reorders a range of geometries along a space filling curve, in parallel
+ *
+ * The keys are computed and sorted in one chunk per worker of the pool, then the sorted chunks
+ * are merged pairwise, the merges of a round run in parallel. The result is the same as the
+ * serial sort.
+ *
+ * @param first the first geometry
+ * @param last the past-the-end geometry
+ * @param pool the thread pool
+ * @param curve the space filling curve
+ *
+ * @since 0.0.1
+ */
+template <typename Iterator>
+void spatial_sort(Iterator first, Iterator last, thread_pool& pool,
+                  space_filling_curve curve = space_filling_curve::HILBERT)
+{
+    detail::spatial_sort(first, last, curve, &pool);
+}
+
+}  // namespace shapes
+}  // namespace simo
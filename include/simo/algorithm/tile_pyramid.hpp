@@ -0,0 +1,467 @@
+#pragma once
+
+#include <ciso646>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <simo/thread_pool.hpp>
+#include <simo/algorithm/clip.hpp>
+#include <simo/algorithm/simplify.hpp>
+#include <simo/io/mvt.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief Identifies a tile of a pyramid, the rows are numbered from the top
+ *
+ * @since 0.0.1
+ */
+struct tile_id
+{
+    /// the zoom level
+    uint32_t z;
+
+    /// the column
+    uint32_t x;
+
+    /// the row
+    uint32_t y;
+};
+
+/*!
+ * @brief The settings of a tile pyramid
+ *
+ * @since 0.0.1
+ */
+struct pyramid_options
+{
+    /// the bounds of the zoom 0 tile, in the coordinates of the geometries
+    bounds_t bounds;
+
+    /// the deepest zoom level
+    uint32_t max_zoom = 14;
+
+    /// the layer name
+    std::string layer = "features";
+
+    /// the number of tile units along a side
+    uint32_t extent = mvt::DEFAULT_EXTENT;
+
+    /// the margin kept around every tile, in tile units
+    uint32_t buffer = 64;
+
+    /// the simplification tolerance, in tile units
+    double tolerance = 1;
+};
+
+namespace detail
+{
+
+/// a tile and the geometries whose bounds overlap it
+struct pyramid_task
+{
+    /// the tile
+    tile_id tile;
+
+    /// the indices of the geometries
+    std::vector<uint32_t> indices;
+};
+
+/// the tasks of every worker, a worker takes its newest task or the oldest task of another worker
+template <typename Task>
+class work_stealing_deques
+{
+  public:
+    explicit work_stealing_deques(size_t num_workers)
+        : m_deques(num_workers)
+    {}
+
+    void push(size_t worker, Task&& task)
+    {
+        ++m_pending;
+        {
+            std::lock_guard<std::mutex> lock(m_deques[worker].mutex);
+            m_deques[worker].tasks.push_back(std::move(task));
+        }
+        ++m_queued;
+        notify(false);
+    }
+
+    /// takes a task, returns false if every deque is empty
+    bool pop(size_t worker, Task& task)
+    {
+        {
+            auto& own = m_deques[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (not own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                --m_queued;
+                return true;
+            }
+        }
+        for (size_t i = 1; i < m_deques.size(); ++i)
+        {
+            auto& other = m_deques[(worker + i) % m_deques.size()];
+            std::lock_guard<std::mutex> lock(other.mutex);
+            if (not other.tasks.empty())
+            {
+                task = std::move(other.tasks.front());
+                other.tasks.pop_front();
+                --m_queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// takes a task, waits while the running tasks may push more, returns false when every task is done or on cancel
+    bool wait_pop(size_t worker, Task& task)
+    {
+        while (not m_cancelled)
+        {
+            if (pop(worker, task))
+            {
+                return true;
+            }
+            std::unique_lock<std::mutex> lock(m_idle_mutex);
+            m_idle_cond.wait(lock, [this] { return m_queued > 0 or m_pending == 0 or m_cancelled; });
+            if (m_pending == 0)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /// marks a task done, after its follow-up tasks were pushed
+    void done()
+    {
+        if (--m_pending == 0)
+        {
+            notify(true);
+        }
+    }
+
+    /// wakes up the idle workers, wait_pop returns false from now on
+    void cancel()
+    {
+        m_cancelled = true;
+        notify(true);
+    }
+
+  private:
+    /// wakes up one or every idle worker, the lock orders the change with their wait
+    void notify(bool all)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_idle_mutex);
+        }
+        if (all)
+        {
+            m_idle_cond.notify_all();
+        }
+        else
+        {
+            m_idle_cond.notify_one();
+        }
+    }
+
+    /// the tasks of one worker
+    struct deque
+    {
+        /// guards the tasks
+        std::mutex mutex;
+
+        /// the tasks, the newest at the back
+        std::deque<Task> tasks;
+    };
+
+    /// the deque of every worker
+    std::vector<deque> m_deques;
+
+    /// the number of tasks pushed and not done
+    std::atomic<size_t> m_pending{0};
+
+    /// the number of tasks in the deques
+    std::atomic<size_t> m_queued{0};
+
+    /// whether the workers stop
+    std::atomic<bool> m_cancelled{false};
+
+    /// guards the waits of the idle workers
+    std::mutex m_idle_mutex;
+
+    /// wakes up the idle workers
+    std::condition_variable m_idle_cond;
+};
+
+/// the clipped geometries of one worker, reused across tiles
+template <typename Point>
+struct tile_scratch
+{
+    /// the clipped points
+    basic_multipoint<Point> points;
+
+    /// the clipped lines
+    basic_multilinestring<basic_linestring<Point>> lines;
+
+    /// the clipped polygon
+    basic_polygon<basic_linestring<Point>> polygon;
+
+    /// the clipped polygons
+    basic_multipolygon<basic_polygon<basic_linestring<Point>>> polygons;
+
+    /// the polygon clipping buffers
+    clip_buffers<Point> buffers;
+};
+
+/// @private
+template <typename Point, typename Scratch>
+void add_to_tile(const Point& point, const bounds_t& clip_bounds, double, uint64_t id, Scratch&,
+                 mvt::layer_encoder& layer, point_tag)
+{
+    if (clip_bounds.contains(static_cast<double>(point.x), static_cast<double>(point.y)))
+    {
+        layer.add_feature(point, {}, id);
+    }
+}
+
+/// @private
+template <typename MultiPoint, typename Scratch>
+void add_to_tile(const MultiPoint& multipoint, const bounds_t& clip_bounds, double, uint64_t id, Scratch& scratch,
+                 mvt::layer_encoder& layer, multipoint_tag)
+{
+    clip(multipoint, clip_bounds, scratch.points);
+    layer.add_feature(scratch.points, {}, id);
+}
+
+/// @private
+template <typename Lines, typename Scratch>
+void add_lines(const Lines& lines, const bounds_t& clip_bounds, double tolerance, uint64_t id, Scratch& scratch,
+               mvt::layer_encoder& layer)
+{
+    clip(lines, clip_bounds, scratch.lines);
+    simplify(scratch.lines, tolerance);
+    layer.add_feature(scratch.lines, {}, id);
+}
+
+/// @private
+template <typename LineString, typename Scratch>
+void add_to_tile(const LineString& linestring, const bounds_t& clip_bounds, double tolerance, uint64_t id,
+                 Scratch& scratch, mvt::layer_encoder& layer, linestring_tag)
+{
+    add_lines(linestring, clip_bounds, tolerance, id, scratch, layer);
+}
+
+/// @private
+template <typename MultiLineString, typename Scratch>
+void add_to_tile(const MultiLineString& multilinestring, const bounds_t& clip_bounds, double tolerance, uint64_t id,
+                 Scratch& scratch, mvt::layer_encoder& layer, multilinestring_tag)
+{
+    add_lines(multilinestring, clip_bounds, tolerance, id, scratch, layer);
+}
+
+/// @private
+template <typename Polygon, typename Scratch>
+void add_to_tile(const Polygon& polygon, const bounds_t& clip_bounds, double tolerance, uint64_t id, Scratch& scratch,
+                 mvt::layer_encoder& layer, polygon_tag)
+{
+    clip(polygon, clip_bounds, scratch.polygon, scratch.buffers);
+    simplify(scratch.polygon, tolerance);
+    layer.add_feature(scratch.polygon, {}, id);
+}
+
+/// @private
+template <typename MultiPolygon, typename Scratch>
+void add_to_tile(const MultiPolygon& multipolygon, const bounds_t& clip_bounds, double tolerance, uint64_t id,
+                 Scratch& scratch, mvt::layer_encoder& layer, multipolygon_tag)
+{
+    clip(multipolygon, clip_bounds, scratch.polygons, scratch.buffers);
+    simplify(scratch.polygons, tolerance);
+    layer.add_feature(scratch.polygons, {}, id);
+}
+
+/// @private the bounds of a tile
+inline bounds_t tile_bounds(const tile_id& tile, const bounds_t& root) noexcept
+{
+    double scale  = std::ldexp(1.0, -static_cast<int>(tile.z));
+    double width  = (root.maxx - root.minx) * scale;
+    double height = (root.maxy - root.miny) * scale;
+    double minx   = root.minx + width * tile.x;
+    double maxy   = root.maxy - height * tile.y;
+    return {minx, maxy - height, minx + width, maxy};
+}
+
+/// @private the bounds of a tile with its buffer
+inline bounds_t buffered_bounds(const bounds_t& bounds, const pyramid_options& options) noexcept
+{
+    double dx = (bounds.maxx - bounds.minx) * options.buffer / options.extent;
+    double dy = (bounds.maxy - bounds.miny) * options.buffer / options.extent;
+    return {bounds.minx - dx, bounds.miny - dy, bounds.maxx + dx, bounds.maxy + dy};
+}
+
+/// @private queues the children of a tile overlapping some of its geometries
+inline void push_children(const pyramid_task& task, const pyramid_options& options,
+                          const std::vector<bounds_t>& extents, work_stealing_deques<pyramid_task>& deques,
+                          size_t worker)
+{
+    // the children in reverse order, the first child is processed next
+    for (uint32_t i = 4; i > 0; --i)
+    {
+        uint32_t dx = (i - 1) % 2;
+        uint32_t dy = (i - 1) / 2;
+
+        pyramid_task child = {{task.tile.z + 1, 2 * task.tile.x + dx, 2 * task.tile.y + dy}, {}};
+        auto bounds        = buffered_bounds(tile_bounds(child.tile, options.bounds), options);
+        for (auto index : task.indices)
+        {
+            if (bounds.intersects(extents[index]))
+            {
+                child.indices.push_back(index);
+            }
+        }
+        if (not child.indices.empty())
+        {
+            deques.push(worker, std::move(child));
+        }
+    }
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Generates the vector tiles of a pyramid from zoom 0 to the maximum zoom
+ *
+ * The pyramid is built top-down, a tile receives the geometries of its parent whose bounds
+ * overlap its buffered bounds. Every geometry of a tile is clipped to the buffered bounds,
+ * simplified with a tolerance of the given number of tile units, then quantized and encoded
+ * in a single layer. The feature identifiers are the geometry indices. The tiles without
+ * geometries and their descendants are skipped.
+ *
+ * Each worker of the pool keeps a deque of tiles, it processes its newest tile first and
+ * pushes the children of the tile back, so its deque holds the siblings along one path of
+ * the pyramid. An idle worker takes the oldest tile, at the top of the pyramid, of another
+ * worker. The memory of a worker is its clipping scratch, the tile being encoded and the
+ * geometry indices along its path, the tiles are handed to the callback as they are done.
+ * A worker without tiles to take sleeps until another worker pushes some.
+ *
+ * Called from a task running in the pool, the pyramid is built on the calling thread alone,
+ * since waiting for the other workers there could block every worker of the pool.
+ *
+ * @param geoms the geometries
+ * @param options the pyramid settings
+ * @param pool the thread pool, its workers are busy until the pyramid is done
+ * @param f the callback f(const tile_id&, std::string&& tile) receiving the encoded tiles, it is
+ * called from the pool threads concurrently
+ * @throw the first exception raised by f or the encoding
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry, typename F>
+void generate_pyramid(const std::vector<Geometry>& geoms, const pyramid_options& options, thread_pool& pool, F f)
+{
+    using point_type = typename Geometry::point_type;
+    using tag        = typename geometry_traits<Geometry>::tag;
+
+    std::vector<bounds_t> extents;
+    extents.reserve(geoms.size());
+    detail::pyramid_task root = {{0, 0, 0}, {}};
+    auto root_bounds          = detail::buffered_bounds(options.bounds, options);
+    for (size_t i = 0; i < geoms.size(); ++i)
+    {
+        extents.push_back(geoms[i].bounds());
+        // the bounds of an empty geometry intersect nothing
+        if (root_bounds.intersects(extents.back()))
+        {
+            root.indices.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    if (root.indices.empty())
+    {
+        return;
+    }
+
+    size_t num_workers = pool.in_worker() ? 1 : pool.size();
+    detail::work_stealing_deques<detail::pyramid_task> deques(num_workers);
+    deques.push(0, std::move(root));
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&](size_t worker) {
+        detail::tile_scratch<point_type> scratch;
+        detail::pyramid_task task;
+        while (deques.wait_pop(worker, task))
+        {
+            try
+            {
+                auto bounds      = detail::tile_bounds(task.tile, options.bounds);
+                auto clip_bounds = detail::buffered_bounds(bounds, options);
+                double tolerance = options.tolerance * (bounds.maxx - bounds.minx) / options.extent;
+
+                mvt::layer_encoder layer(options.layer, bounds, options.extent);
+                for (auto index : task.indices)
+                {
+                    detail::add_to_tile(geoms[index], clip_bounds, tolerance, index, scratch, layer, tag());
+                }
+                if (layer.size() > 0)
+                {
+                    f(task.tile, layer.serialize());
+                }
+
+                if (task.tile.z < options.max_zoom)
+                {
+                    detail::push_children(task, options, extents, deques, worker);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (not error)
+                {
+                    error = std::current_exception();
+                }
+                deques.cancel();
+            }
+            deques.done();
+        }
+    };
+
+    if (pool.in_worker())
+    {
+        work(0);
+    }
+    else
+    {
+        std::vector<std::future<void>> futures;
+        futures.reserve(num_workers);
+        for (size_t worker = 0; worker < num_workers; ++worker)
+        {
+            futures.push_back(pool.submit([&work, worker] { work(worker); }));
+        }
+        for (auto& future : futures)
+        {
+            future.wait();
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -2,6 +2,7 @@
 
 #include <ciso646>
 #include <algorithm>
+#include <limits>
 #include <tuple>
 
 namespace simo
@@ -11,6 +12,10 @@ namespace shapes
 
 /*!
  * @brief Represents an axis-aligned bounding box
+ *
+ * The bounds of every geometry are in double precision whatever its coordinate type, which is
+ * exact for the float and the 32 bit integer coordinates.
+ *
  * @ingroup geometry
  *
  * @since 0.0.1
@@ -37,8 +42,8 @@ struct bounds_t
     bounds_t()
         : minx(std::numeric_limits<double>::max()),
           miny(std::numeric_limits<double>::max()),
-          maxx(std::numeric_limits<double>::min()),
-          maxy(std::numeric_limits<double>::min())
+          maxx(std::numeric_limits<double>::lowest()),
+          maxy(std::numeric_limits<double>::lowest())
     {
     }
 
@@ -161,7 +166,7 @@ struct bounds_t
      *
      * @since 0.0.1
      */
-    bool contains(const bounds_t& other)
+    bool contains(const bounds_t& other) const
     {
         return contains(other.minx, other.miny) && contains(other.maxx, other.maxy);
     }
@@ -172,7 +177,7 @@ struct bounds_t
      *
      * @since 0.0.1
      */
-    bool intersects(const bounds_t& other)
+    bool intersects(const bounds_t& other) const
     {
         return (other.maxx >= minx) && (other.minx <= maxx) && (other.maxy >= miny) && (other.miny <= maxy);
     }
@@ -183,10 +188,37 @@ struct bounds_t
      *
      * @since 0.0.1
      */
-    bool overlaps(const bounds_t& other)
+    bool overlaps(const bounds_t& other) const
     {
         return (other.maxx > minx) && (other.minx < maxx) && (other.maxy > miny) && (other.miny < maxy);
     }
+
+    /*!
+     * @return true if the bounds does not contain any point, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool empty() const
+    {
+        return minx > maxx or miny > maxy;
+    }
+
+    /*!
+     * @brief Grows the bounds by the given distance in every direction
+     *
+     * @param distance the distance to grow the bounds by
+     * @return the bounds object
+     *
+     * @since 0.0.1
+     */
+    bounds_t& expand(double distance)
+    {
+        minx -= distance;
+        miny -= distance;
+        maxx += distance;
+        maxy += distance;
+        return *this;
+    }
 };
 
 }  // namespace shapes
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <ciso646>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <memory>
 #include <simo/shapes_fwd.hpp>
@@ -14,6 +19,60 @@ namespace simo
 namespace shapes
 {
 
+/*!
+ * @brief The outcome of a validity check, the first error found if the geometry is invalid
+ *
+ * @since 0.0.1
+ */
+struct validity_report
+{
+    /// the kind of error
+    validity_code code = validity_code::VALID;
+
+    /// the description of the error, empty if valid
+    const char* reason = "";
+
+    /// the x-coordinate of the error location, NaN if unknown
+    double x = std::numeric_limits<double>::quiet_NaN();
+
+    /// the y-coordinate of the error location, NaN if unknown
+    double y = std::numeric_limits<double>::quiet_NaN();
+
+    validity_report() = default;
+
+    validity_report(validity_code code, const char* reason, double x = std::numeric_limits<double>::quiet_NaN(),
+                    double y = std::numeric_limits<double>::quiet_NaN()) noexcept
+        : code(code), reason(reason), x(x), y(y)
+    {
+    }
+
+    /*!
+     * @return true if no error was found, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool valid() const noexcept
+    {
+        return code == validity_code::VALID;
+    }
+
+    /*!
+     * @return the reason followed by the location when known, e.g. "Polygon rings cross at POINT (4 1)"
+     *
+     * @since 0.0.1
+     */
+    std::string message() const
+    {
+        if (std::isnan(x) or std::isnan(y))
+        {
+            return reason;
+        }
+        std::stringstream ss;
+        ss << std::setprecision(17) << reason << " at POINT (" << x << " " << y << ")";
+        return ss.str();
+    }
+};
+
 /*!
  * @brief Base class for all geometries
  *
@@ -161,7 +220,22 @@ class basic_geometry
      */
     void throw_for_invalid() const
     {
-        return static_cast<const T*>(this)->throw_for_invalid_();
+        auto res = validate();
+        if (not res.valid())
+        {
+            throw exceptions::geometry_error(res.message());
+        }
+    }
+
+    /*!
+     * @brief Checks the validity of the geometry without throwing
+     * @return the first error found, see validity_report::valid()
+     *
+     * @since 0.0.1
+     */
+    validity_report validate() const
+    {
+        return static_cast<const T*>(this)->validate_();
     }
 
     /*!
@@ -183,15 +257,7 @@ class basic_geometry
      */
     bool is_valid() const noexcept
     {
-        try
-        {
-            throw_for_invalid();
-        }
-        catch (const exceptions::geometry_error& e)
-        {
-            return false;
-        }
-        return true;
+        return validate().valid();
     }
 
     /*!
@@ -284,6 +350,16 @@ class basic_geometry
     {
         return static_cast<const T*>(this)->wkt_(precision);
     }
+
+  private:
+    template <typename>
+    friend struct dimension_traits;
+
+    /// @private the geometry type of the classes holding a single geometry type, known at compile time
+    static constexpr geometry_type static_geom_type_() noexcept
+    {
+        return T::geom_type_();
+    }
 };
 
 }  // namespace shapes
@@ -36,26 +36,24 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
     basic_linestring(std::initializer_list<T> init)
         : base_type(init.begin(), init.end()) {}
 
-    explicit basic_linestring(coord_const_iterator first, coord_const_iterator last)
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_linestring(CoordIterator first, CoordIterator last)
     {
-        /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
-        for (auto it = first; it != last; it += n)
-        {
-            this->emplace_back(it, it + n);
-        }
+        utils::assign_coords(*this, first, last);
     }
 
-    explicit basic_linestring(coord_iterator first, coord_iterator last)
+    /*!
+     * @brief Creates a linestring from a contiguous array of interleaved coordinates
+     *
+     * @param coords the coordinates
+     * @param size the number of coordinates, a multiple of the number of dimensions
+     * @throw geometry_error if the size is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    basic_linestring(const coord_type* coords, size_t size)
     {
-        /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
-        for (auto it = first; it != last; it += n)
-        {
-            this->emplace_back(it, it + n);
-        }
+        utils::assign_coords(*this, coords, coords + size);
     }
 
     basic_linestring(point_iterator first, point_iterator last)
@@ -68,6 +66,40 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
     {
     }
 
+    using base_type::assign;
+
+    /*!
+     * @brief Replaces the points of the linestring with the points of a coordinate sequence
+     *
+     * The coordinates of a std::vector or an array of the coordinate type are copied with a
+     * single memcpy.
+     *
+     * @param first the first coordinate
+     * @param last the past-the-end coordinate
+     * @throw geometry_error if the number of coordinates is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    template <typename CoordIterator>
+    typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type assign(CoordIterator first, CoordIterator last)
+    {
+        utils::assign_coords(*this, first, last);
+    }
+
+    /*!
+     * @brief Replaces the points of the linestring with the points of a contiguous array of interleaved coordinates
+     *
+     * @param coords the coordinates
+     * @param size the number of coordinates, a multiple of the number of dimensions
+     * @throw geometry_error if the size is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    void assign(const coord_type* coords, size_t size)
+    {
+        utils::assign_coords(*this, coords, coords + size);
+    }
+
     // operators
 
     /*!
@@ -106,12 +138,13 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
     }
 
     /*!
-     * @brief DOCUMENT ME!
-     * @return
+     * @return the (x, y) coordinates of the points
+     *
+     * @since 0.0.1
      */
-    std::vector<std::tuple<double, double>> xy() const
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
     {
-        std::vector<std::tuple<double, double>> res;
+        std::vector<std::tuple<coord_type, coord_type>> res;
         res.reserve(this->size());
         for (const auto& p : *this)
         {
@@ -135,7 +168,7 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
         static_assert(is_basic_point<T>::value, "must contain XY points");
 
         auto coords = polyline::decode(polyline, precision);
-        return {coords.begin(), coords.end()};
+        return basic_linestring<T>(coords.begin(), coords.end());
     }
 
     /*!
@@ -167,21 +200,12 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
     friend class basic_geometry<basic_linestring<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
-        if (is_basic_point_z<T>::value)
-        {
-            return geometry_type::LINESTRINGZ;
-        }
-        if (is_basic_point_m<T>::value)
-        {
-            return geometry_type::LINESTRINGM;
-        }
-        if (is_basic_point_zm<T>::value)
-        {
-            return geometry_type::LINESTRINGZM;
-        }
-        return geometry_type::LINESTRING;
+        return is_basic_point_z<T>::value ? geometry_type::LINESTRINGZ :
+               is_basic_point_m<T>::value ? geometry_type::LINESTRINGM :
+               is_basic_point_zm<T>::value ? geometry_type::LINESTRINGZM :
+               geometry_type::LINESTRING;
     }
 
     /// @private
@@ -195,25 +219,28 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
         if (this->empty())
         {
-            return;
+            return {};
         }
 
         if (this->size() < 2)
         {
-            throw exceptions::geometry_error("LineString should be either empty or with 2 or more points");
+            return {validity_code::TOO_FEW_POINTS, "LineString should be either empty or with 2 or more points"};
         }
 
         if (this->size() == 2)
         {
-            if (*this[0] == *this[1])
+            const auto& p = (*this)[0];
+            if (p == (*this)[1])
             {
-                throw exceptions::geometry_error("LineString with exactly two equal points");
+                return {validity_code::TOO_FEW_POINTS, "LineString with exactly two equal points", static_cast<double>(p.x),
+                        static_cast<double>(p.y)};
             }
         }
+        return {};
     }
 
     /// @private
@@ -241,12 +268,12 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
                 throw exceptions::parse_error("invalid geometry type: " + std::string(geom_type));
             }
             const auto& coords = j.at("coordinates").get<std::vector<std::vector<double>>>();
-            std::vector<point_type> res;
+            basic_linestring<T> res;
             res.reserve(coords.size());
             std::for_each(std::begin(coords), std::end(coords), [&](const std::vector<double>& coord) {
                 res.emplace_back(coord.begin(), coord.end());
             });
-            return basic_linestring<T>(res.begin(), res.end());
+            return res;
         }
         catch (const nlohmann::json::exception& e)
         {
@@ -281,7 +308,7 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
                 {
                     ss << ",";
                 }
-                ss << p.coords[j];
+                ss << utils::coord_out(p.coords[j]);
             }
             ss << "]";
             ++i;
@@ -314,11 +341,11 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
             ss << std::setprecision(precision);
         }
         ss << "LINESTRING";
-        if (this->has_z())
+        if (dimension_traits<basic_linestring<T>>::has_z::value)
         {
             ss << "Z";
         }
-        if (this->has_m())
+        if (dimension_traits<basic_linestring<T>>::has_m::value)
         {
             ss << "M";
         }
@@ -336,7 +363,7 @@ class basic_linestring : public std::vector<T, AllocatorType>, public basic_geom
                 {
                     ss << " ";
                 }
-                ss << p.coords[j];
+                ss << utils::coord_out(p.coords[j]);
             }
             ++i;
         }
@@ -49,8 +49,7 @@ class basic_multilinestring
     {
         if (std::distance(coord_first, coord_last) > 0)
         {
-            auto n = this->ndim();
-            this->reserve((coord_last - coord_first) / n);
+            this->reserve(static_cast<size_t>(std::distance(offset_first, offset_last)));
             size_t lo = 0;
             for (auto it = offset_first; it != offset_last; ++it)
             {
@@ -84,13 +83,18 @@ class basic_multilinestring
         return not operator==(lhs, rhs);
     }
 
-    std::vector<std::tuple<double, double>> xy() const
+    /*!
+     * @return the (x, y) coordinates of all the points, part after part
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
     {
-        std::vector<std::tuple<double, double>> res;
-        res.reserve(this->size());
-        for (const auto& p : *this)
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        for (const auto& part : *this)
         {
-            res.emplace_back(p.x, p.y);
+            auto part_xy = part.xy();
+            res.insert(res.end(), part_xy.begin(), part_xy.end());
         }
         return res;
     }
@@ -100,21 +104,12 @@ class basic_multilinestring
     friend class basic_geometry<basic_multilinestring<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
-        if (is_basic_linestring_z<T>::value)
-        {
-            return geometry_type::MULTILINESTRINGZ;
-        }
-        if (is_basic_linestring_m<T>::value)
-        {
-            return geometry_type::MULTILINESTRINGM;
-        }
-        if (is_basic_linestring_zm<T>::value)
-        {
-            return geometry_type::MULTILINESTRINGZM;
-        }
-        return geometry_type::MULTILINESTRING;
+        return is_basic_linestring_z<T>::value ? geometry_type::MULTILINESTRINGZ :
+               is_basic_linestring_m<T>::value ? geometry_type::MULTILINESTRINGM :
+               is_basic_linestring_zm<T>::value ? geometry_type::MULTILINESTRINGZM :
+               geometry_type::MULTILINESTRING;
     }
 
     /// @private
@@ -128,21 +123,26 @@ class basic_multilinestring
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const
     {
         for (const auto& ls : *this)
         {
-            ls.throw_for_invalid();
+            auto res = ls.validate();
+            if (not res.valid())
+            {
+                return res;
+            }
         }
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
         bounds_t res{};
-        for (const auto& p : *this)
+        for (const auto& geom : *this)
         {
-            res.extend(p.x, p.y);
+            res.extend(geom.bounds());
         }
         return res;
     }
@@ -161,24 +161,23 @@ class basic_multilinestring
                 throw exceptions::parse_error("invalid geometry type: " + std::string(geom_type));
             }
             const auto& linestrings = j.at("coordinates");
-            std::vector<T> res;
+            basic_multilinestring<T> res;
             res.reserve(linestrings.size());
-            std::vector<point_type> points;
             for (const auto& linestring : linestrings)
             {
                 if (not linestring.empty())
                 {
                     const auto& coords = linestring.get<std::vector<std::vector<double>>>();
+                    T points;
                     points.reserve(coords.size());
                     std::for_each(std::begin(coords), std::end(coords),
                                   [&points](const std::vector<double>& coord) {
                                       points.emplace_back(coord.begin(), coord.end());
                                   });
-                    res.emplace_back(points.begin(), points.end());
+                    res.push_back(std::move(points));
                 }
-                points.clear();
             }
-            return basic_multilinestring<T>(res.begin(), res.end());
+            return res;
         }
         catch (const nlohmann::json::exception& e)
         {
@@ -221,7 +220,7 @@ class basic_multilinestring
                     {
                         ss << ",";
                     }
-                    ss << p.coords[k];
+                    ss << utils::coord_out(p.coords[k]);
                 }
                 ss << "]";
                 ++i;
@@ -258,11 +257,11 @@ class basic_multilinestring
             ss << std::setprecision(precision);
         }
         ss << "MULTILINESTRING";
-        if (this->has_z())
+        if (dimension_traits<basic_multilinestring<T>>::has_z::value)
         {
             ss << "Z";
         }
-        if (this->has_m())
+        if (dimension_traits<basic_multilinestring<T>>::has_m::value)
         {
             ss << "M";
         }
@@ -288,7 +287,7 @@ class basic_multilinestring
                     {
                         ss << " ";
                     }
-                    ss << p.coords[k];
+                    ss << utils::coord_out(p.coords[k]);
                 }
             }
             ss << ")";
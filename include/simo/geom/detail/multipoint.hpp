@@ -33,26 +33,24 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
     basic_multipoint(std::initializer_list<T> init)
         : base_type(init.begin(), init.end()) {}
 
-    explicit basic_multipoint(coord_const_iterator first, coord_const_iterator last)
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_multipoint(CoordIterator first, CoordIterator last)
     {
-        /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
-        for (auto it = first; it != last; it += n)
-        {
-            this->emplace_back(it, it + n);
-        }
+        utils::assign_coords(*this, first, last);
     }
 
-    explicit basic_multipoint(coord_iterator first, coord_iterator last)
+    /*!
+     * @brief Creates a multipoint from a contiguous array of interleaved coordinates
+     *
+     * @param coords the coordinates
+     * @param size the number of coordinates, a multiple of the number of dimensions
+     * @throw geometry_error if the size is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    basic_multipoint(const coord_type* coords, size_t size)
     {
-        /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
-        for (auto it = first; it != last; it += n)
-        {
-            this->emplace_back(it, it + n);
-        }
+        utils::assign_coords(*this, coords, coords + size);
     }
 
     basic_multipoint(point_iterator first, point_iterator last)
@@ -65,6 +63,40 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
     {
     }
 
+    using base_type::assign;
+
+    /*!
+     * @brief Replaces the points of the multipoint with the points of a coordinate sequence
+     *
+     * The coordinates of a std::vector or an array of the coordinate type are copied with a
+     * single memcpy.
+     *
+     * @param first the first coordinate
+     * @param last the past-the-end coordinate
+     * @throw geometry_error if the number of coordinates is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    template <typename CoordIterator>
+    typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type assign(CoordIterator first, CoordIterator last)
+    {
+        utils::assign_coords(*this, first, last);
+    }
+
+    /*!
+     * @brief Replaces the points of the multipoint with the points of a contiguous array of interleaved coordinates
+     *
+     * @param coords the coordinates
+     * @param size the number of coordinates, a multiple of the number of dimensions
+     * @throw geometry_error if the size is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    void assign(const coord_type* coords, size_t size)
+    {
+        utils::assign_coords(*this, coords, coords + size);
+    }
+
     // operators
 
     /*!
@@ -102,9 +134,14 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
         return not operator==(lhs, rhs);
     }
 
-    std::vector<std::tuple<double, double>> xy() const
+    /*!
+     * @return the (x, y) coordinates of the points
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
     {
-        std::vector<std::tuple<double, double>> res;
+        std::vector<std::tuple<coord_type, coord_type>> res;
         res.reserve(this->size());
         for (const auto& p : *this)
         {
@@ -120,7 +157,7 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
         static_assert(is_basic_point<T>::value, "must contain XY points");
 
         auto coords = polyline::decode(polyline, precision);
-        return {coords.begin(), coords.end()};
+        return basic_multipoint<T>(coords.begin(), coords.end());
     }
 
     std::string polyline(std::int32_t precision = 5) const
@@ -146,21 +183,12 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
     friend class basic_geometry<basic_multipoint<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
-        if (is_basic_point_z<T>::value)
-        {
-            return geometry_type::MULTIPOINTZ;
-        }
-        if (is_basic_point_m<T>::value)
-        {
-            return geometry_type::MULTIPOINTM;
-        }
-        if (is_basic_point_zm<T>::value)
-        {
-            return geometry_type::MULTIPOINTZM;
-        }
-        return geometry_type::MULTIPOINT;
+        return is_basic_point_z<T>::value ? geometry_type::MULTIPOINTZ :
+               is_basic_point_m<T>::value ? geometry_type::MULTIPOINTM :
+               is_basic_point_zm<T>::value ? geometry_type::MULTIPOINTZM :
+               geometry_type::MULTIPOINT;
     }
 
     /// @private
@@ -174,9 +202,9 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
@@ -204,12 +232,12 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
                 throw exceptions::parse_error("invalid geometry type: " + std::string(geom_type));
             }
             const auto& coords = j.at("coordinates").get<std::vector<std::vector<double>>>();
-            std::vector<point_type> res;
+            basic_multipoint<T> res;
             res.reserve(coords.size());
             std::for_each(std::begin(coords), std::end(coords), [&](const std::vector<double>& coord) {
                 res.emplace_back(coord.begin(), coord.end());
             });
-            return basic_multipoint<T>(res.begin(), res.end());
+            return res;
         }
         catch (const nlohmann::json::exception& e)
         {
@@ -244,7 +272,7 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
                 {
                     ss << ",";
                 }
-                ss << p.coords[j];
+                ss << utils::coord_out(p.coords[j]);
             }
             ss << "]";
             ++i;
@@ -277,11 +305,11 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
             ss << std::setprecision(precision);
         }
         ss << "MULTIPOINT";
-        if (this->has_z())
+        if (dimension_traits<basic_multipoint<T>>::has_z::value)
         {
             ss << "Z";
         }
-        if (this->has_m())
+        if (dimension_traits<basic_multipoint<T>>::has_m::value)
         {
             ss << "M";
         }
@@ -300,7 +328,7 @@ class basic_multipoint : public std::vector<T, AllocatorType>, public basic_geom
                 {
                     ss << " ";
                 }
-                ss << p.coords[j];
+                ss << utils::coord_out(p.coords[j]);
             }
             ss << ")";
             ++i;
@@ -55,8 +55,7 @@ class basic_multipolygon
     {
         if (std::distance(coord_first, coord_last) > 0)
         {
-            auto n = this->ndim();
-            this->reserve((coord_last - coord_first) / n);
+            this->reserve(static_cast<size_t>(std::distance(offset_first, offset_last)));
             size_t lo = 0;
             for (auto it = offset_first; it != offset_last; ++it)
             {
@@ -90,13 +89,18 @@ class basic_multipolygon
         return not operator==(lhs, rhs);
     }
 
-    std::vector<std::tuple<double, double>> xy() const
+    /*!
+     * @return the (x, y) coordinates of all the points, part after part
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
     {
-        std::vector<std::tuple<double, double>> res;
-        res.reserve(this->size());
-        for (const auto& p : *this)
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        for (const auto& part : *this)
         {
-            res.emplace_back(p.x, p.y);
+            auto part_xy = part.xy();
+            res.insert(res.end(), part_xy.begin(), part_xy.end());
         }
         return res;
     }
@@ -106,21 +110,12 @@ class basic_multipolygon
     friend class basic_geometry<basic_multipolygon<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
-        if (is_basic_polygon_z<T>::value)
-        {
-            return geometry_type::MULTIPOLYGONZ;
-        }
-        if (is_basic_polygon_m<T>::value)
-        {
-            return geometry_type::MULTIPOLYGONM;
-        }
-        if (is_basic_polygon_zm<T>::value)
-        {
-            return geometry_type::MULTIPOLYGONZM;
-        }
-        return geometry_type::MULTIPOLYGON;
+        return is_basic_polygon_z<T>::value ? geometry_type::MULTIPOLYGONZ :
+               is_basic_polygon_m<T>::value ? geometry_type::MULTIPOLYGONM :
+               is_basic_polygon_zm<T>::value ? geometry_type::MULTIPOLYGONZM :
+               geometry_type::MULTIPOLYGON;
     }
 
     /// @private
@@ -134,21 +129,26 @@ class basic_multipolygon
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const
     {
-        for (const auto& ls : *this)
+        for (const auto& polygon : *this)
         {
-            ls.throw_for_invalid();
+            auto res = polygon.validate();
+            if (not res.valid())
+            {
+                return res;
+            }
         }
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
         bounds_t res{};
-        for (const auto& p : *this)
+        for (const auto& geom : *this)
         {
-            res.extend(p.x, p.y);
+            res.extend(geom.bounds());
         }
         return res;
     }
@@ -162,29 +162,31 @@ class basic_multipolygon
         {
             auto j         = nlohmann::json::parse(json);
             auto geom_type = j.at("type").get<std::string>();
-            if (geom_type != "Multipolygon")
+            if (geom_type != "MultiPolygon")
             {
                 throw exceptions::parse_error("invalid geometry type: " + std::string(geom_type));
             }
             const auto& polygons = j.at("coordinates");
-            std::vector<T> res;
+            basic_multipolygon<T> res;
             res.reserve(polygons.size());
-            std::vector<point_type> points;
             for (const auto& polygon : polygons)
             {
-                if (not polygon.empty())
+                T rings;
+                rings.reserve(polygon.size());
+                for (const auto& ring : polygon)
                 {
-                    const auto& coords = polygon.get<std::vector<std::vector<double>>>();
+                    const auto& coords = ring.get<std::vector<std::vector<double>>>();
+                    typename T::value_type points;
                     points.reserve(coords.size());
                     std::for_each(std::begin(coords), std::end(coords),
                                   [&points](const std::vector<double>& coord) {
                                       points.emplace_back(coord.begin(), coord.end());
                                   });
-                    res.emplace_back(points.begin(), points.end());
+                    rings.push_back(std::move(points));
                 }
-                points.clear();
+                res.push_back(std::move(rings));
             }
-            return basic_multipolygon<T>(res.begin(), res.end());
+            return res;
         }
         catch (const nlohmann::json::exception& e)
         {
@@ -204,7 +206,7 @@ class basic_multipolygon
         {
             ss << std::setprecision(precision);
         }
-        ss << "{\"type\":\"Multipolygon\",\"coordinates\":[";
+        ss << "{\"type\":\"MultiPolygon\",\"coordinates\":[";
         for (size_t polygon_index = 0; polygon_index < this->size(); ++polygon_index)
         {
             const auto& pg = (*this)[polygon_index];
@@ -235,7 +237,7 @@ class basic_multipolygon
                         {
                             ss << ",";
                         }
-                        ss << p.coords[coord_index];
+                        ss << utils::coord_out(p.coords[coord_index]);
                     }
                     ss << "]";
                 }
@@ -271,11 +273,11 @@ class basic_multipolygon
             ss << std::setprecision(precision);
         }
         ss << "MULTIPOLYGON";
-        if (this->has_z())
+        if (dimension_traits<basic_multipolygon<T>>::has_z::value)
         {
             ss << "Z";
         }
-        if (this->has_m())
+        if (dimension_traits<basic_multipolygon<T>>::has_m::value)
         {
             ss << "M";
         }
@@ -309,7 +311,7 @@ class basic_multipolygon
                         {
                             ss << " ";
                         }
-                        ss << p.coords[k];
+                        ss << utils::coord_out(p.coords[k]);
                     }
                     ++point_index;
                 }
@@ -90,31 +90,25 @@ class basic_point : public basic_geometry<basic_point<T>>
     basic_point(T x, T y)
         : x(x), y(y) {}
 
-    explicit basic_point(coord_iterator begin, coord_iterator end)
-    {
-        /// @todo (pavel) deal with repetition
-        assert(std::distance(begin, end) == N);
-        size_t i = 0;
-        for (auto it = begin; it != end; ++it)
-        {
-            coords[i++] = *it;
-        }
-    }
-
-    explicit basic_point(coord_const_iterator begin, coord_const_iterator end)
+    /*!
+     * @brief Creates a point from a sequence of coordinates of any arithmetic type
+     * @param begin the first coordinate
+     * @param end the past-the-end coordinate
+     */
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_point(CoordIterator begin, CoordIterator end)
     {
-        /// @todo (pavel) deal with repetition
-        assert(std::distance(begin, end) == N);
+        assert(static_cast<size_t>(std::distance(begin, end)) == N);
         size_t i = 0;
         for (auto it = begin; it != end; ++it)
         {
-            coords[i++] = *it;
+            coords[i++] = utils::coord_cast<T>(*it);
         }
     }
 
     size_type size() const noexcept
     {
-        return this->ndim();
+        return N;
     }
 
     // operators
@@ -144,7 +138,7 @@ class basic_point : public basic_geometry<basic_point<T>>
         {
             throw exceptions::parse_error("too many points");
         }
-        return {coords[0], coords[1]};
+        return {utils::coord_cast<T>(coords[0]), utils::coord_cast<T>(coords[1])};
     }
 
     std::string polyline(std::int32_t precision = 5) const
@@ -208,7 +202,7 @@ class basic_point : public basic_geometry<basic_point<T>>
     friend class basic_geometry<basic_point<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
         return geometry_type::POINT;
     }
@@ -220,15 +214,15 @@ class basic_point : public basic_geometry<basic_point<T>>
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
-        return {x, y, x, y};
+        return {static_cast<double>(x), static_cast<double>(y), static_cast<double>(x), static_cast<double>(y)};
     }
 
     // json
@@ -246,7 +240,7 @@ class basic_point : public basic_geometry<basic_point<T>>
                 throw exceptions::parse_error("invalid geometry type");
             }
             auto coords = j.at("coordinates").get<std::vector<double>>();
-            return {coords.at(0), coords.at(1)};
+            return {utils::coord_cast<T>(coords.at(0)), utils::coord_cast<T>(coords.at(1))};
         }
         catch (const std::out_of_range& e)
         {
@@ -271,7 +265,7 @@ class basic_point : public basic_geometry<basic_point<T>>
             ss << std::setprecision(precision);
         }
         ss << "{\"type\":\"Point\",\"coordinates\":"
-           << "[" << x << "," << y << "]}";
+           << "[" << utils::coord_out(x) << "," << utils::coord_out(y) << "]}";
         return ss.str();
     }
 
@@ -281,13 +275,13 @@ class basic_point : public basic_geometry<basic_point<T>>
     static basic_point<T> from_wkt_(const std::string& wkt)
     {
         wkt_reader reader{};
-        auto result = reader.read(wkt);
-        auto data   = result.data;
+        auto result      = reader.read(wkt);
+        const auto& data = result.data;
         if (data.geom_type != geometry_type::POINT)
         {
             throw exceptions::parse_error("invalid wkt string");
         }
-        return {data.coords[0], data.coords[1]};
+        return {utils::coord_cast<T>(data.coords[0]), utils::coord_cast<T>(data.coords[1])};
     }
 
     /// @private
@@ -299,7 +293,7 @@ class basic_point : public basic_geometry<basic_point<T>>
             ss << std::setprecision(precision);
         }
         ss << "POINT "
-           << "(" << x << " " << y << ")";
+           << "(" << utils::coord_out(x) << " " << utils::coord_out(y) << ")";
         return ss.str();
     }
 };
@@ -352,29 +346,25 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
     basic_point_z(T x, T y, T z)
         : x(x), y(y), z(z) {}
 
-    explicit basic_point_z(coord_iterator begin, coord_iterator end)
-    {
-        assert(std::distance(begin, end) == N);
-        size_t i = 0;
-        for (auto it = begin; it != end; ++it)
-        {
-            coords[i++] = *it;
-        }
-    }
-
-    explicit basic_point_z(coord_const_iterator begin, coord_const_iterator end)
+    /*!
+     * @brief Creates a point from a sequence of coordinates of any arithmetic type
+     * @param begin the first coordinate
+     * @param end the past-the-end coordinate
+     */
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_point_z(CoordIterator begin, CoordIterator end)
     {
-        assert(std::distance(begin, end) == N);
+        assert(static_cast<size_t>(std::distance(begin, end)) == N);
         size_t i = 0;
         for (auto it = begin; it != end; ++it)
         {
-            coords[i++] = *it;
+            coords[i++] = utils::coord_cast<T>(*it);
         }
     }
 
     std::size_t size() const noexcept
     {
-        return this->ndim();
+        return N;
     }
 
     // operators
@@ -451,7 +441,7 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
     friend class basic_geometry<basic_point_z<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
         return geometry_type::POINTZ;
     }
@@ -463,15 +453,15 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
-        return {x, y, x, y};
+        return {static_cast<double>(x), static_cast<double>(y), static_cast<double>(x), static_cast<double>(y)};
     }
 
     // json
@@ -489,7 +479,7 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
                 throw exceptions::parse_error("invalid geometry type");
             }
             auto coords = j.at("coordinates").get<std::vector<double>>();
-            return {coords.at(0), coords.at(1), coords.at(2)};
+            return {utils::coord_cast<T>(coords.at(0)), utils::coord_cast<T>(coords.at(1)), utils::coord_cast<T>(coords.at(2))};
         }
         catch (const std::out_of_range& e)
         {
@@ -514,7 +504,7 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
             ss << std::setprecision(precision);
         }
         ss << "{\"type\":\"Point\",\"coordinates\":"
-           << "[" << x << "," << y << "," << z << "]}";
+           << "[" << utils::coord_out(x) << "," << utils::coord_out(y) << "," << utils::coord_out(z) << "]}";
         return ss.str();
     }
 
@@ -524,13 +514,13 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
     static basic_point_z<T> from_wkt_(const std::string& wkt)
     {
         wkt_reader reader{};
-        auto result = reader.read(wkt);
-        auto data   = result.data;
+        auto result      = reader.read(wkt);
+        const auto& data = result.data;
         if (data.geom_type != geometry_type::POINTZ)
         {
             throw exceptions::parse_error("invalid wkt string");
         }
-        return {data.coords[0], data.coords[1], data.coords[2]};
+        return {utils::coord_cast<T>(data.coords[0]), utils::coord_cast<T>(data.coords[1]), utils::coord_cast<T>(data.coords[2])};
     }
 
     /// @private
@@ -542,7 +532,7 @@ class basic_point_z : public basic_geometry<basic_point_z<T>>
             ss << std::setprecision(precision);
         }
         ss << "POINT Z "
-           << "(" << x << " " << y << " " << z << ")";
+           << "(" << utils::coord_out(x) << " " << utils::coord_out(y) << " " << utils::coord_out(z) << ")";
         return ss.str();
     }
 };
@@ -595,29 +585,25 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
     basic_point_m(T x, T y, T m)
         : x(x), y(y), m(m) {}
 
-    explicit basic_point_m(coord_iterator begin, coord_iterator end)
-    {
-        assert(std::distance(begin, end) == N);
-        size_t i = 0;
-        for (auto it = begin; it != end; ++it)
-        {
-            coords[i++] = *it;
-        }
-    }
-
-    explicit basic_point_m(coord_const_iterator begin, coord_const_iterator end)
+    /*!
+     * @brief Creates a point from a sequence of coordinates of any arithmetic type
+     * @param begin the first coordinate
+     * @param end the past-the-end coordinate
+     */
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_point_m(CoordIterator begin, CoordIterator end)
     {
-        assert(std::distance(begin, end) == N);
+        assert(static_cast<size_t>(std::distance(begin, end)) == N);
         size_t i = 0;
         for (auto it = begin; it != end; ++it)
         {
-            coords[i++] = *it;
+            coords[i++] = utils::coord_cast<T>(*it);
         }
     }
 
     std::size_t size() const noexcept
     {
-        return this->ndim();
+        return N;
     }
 
     // operators
@@ -694,7 +680,7 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
     friend class basic_geometry<basic_point_m<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
         return geometry_type::POINTM;
     }
@@ -706,15 +692,15 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
-        return {x, y, x, y};
+        return {static_cast<double>(x), static_cast<double>(y), static_cast<double>(x), static_cast<double>(y)};
     }
 
     // json
@@ -732,7 +718,7 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
                 throw exceptions::parse_error("invalid geometry type");
             }
             auto coords = j.at("coordinates").get<std::vector<double>>();
-            return {coords.at(0), coords.at(1), coords.at(2)};
+            return {utils::coord_cast<T>(coords.at(0)), utils::coord_cast<T>(coords.at(1)), utils::coord_cast<T>(coords.at(2))};
         }
         catch (const std::out_of_range& e)
         {
@@ -757,7 +743,7 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
             ss << std::setprecision(precision);
         }
         ss << "{\"type\":\"Point\",\"coordinates\":"
-           << "[" << x << "," << y << "," << m << "]}";
+           << "[" << utils::coord_out(x) << "," << utils::coord_out(y) << "," << utils::coord_out(m) << "]}";
         return ss.str();
     }
 
@@ -767,13 +753,13 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
     static basic_point_m<T> from_wkt_(const std::string& wkt)
     {
         wkt_reader reader{};
-        auto result = reader.read(wkt);
-        auto data   = result.data;
+        auto result      = reader.read(wkt);
+        const auto& data = result.data;
         if (data.geom_type != geometry_type::POINTM)
         {
             throw exceptions::parse_error("invalid wkt string");
         }
-        return {data.coords[0], data.coords[1], data.coords[2]};
+        return {utils::coord_cast<T>(data.coords[0]), utils::coord_cast<T>(data.coords[1]), utils::coord_cast<T>(data.coords[2])};
     }
 
     std::string wkt_(std::int32_t precision = -1) const
@@ -784,7 +770,7 @@ class basic_point_m : public basic_geometry<basic_point_m<T>>
             ss << std::setprecision(precision);
         }
         ss << "POINT M "
-           << "(" << x << " " << y << " " << m << ")";
+           << "(" << utils::coord_out(x) << " " << utils::coord_out(y) << " " << utils::coord_out(m) << ")";
         return ss.str();
     }
 };
@@ -839,29 +825,25 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
     basic_point_zm(T x, T y, T z, T m)
         : x(x), y(y), z(z), m(m) {}
 
-    explicit basic_point_zm(coord_iterator begin, coord_iterator end)
-    {
-        assert(std::distance(begin, end) == N);
-        size_t i = 0;
-        for (auto it = begin; it != end; ++it)
-        {
-            coords[i++] = *it;
-        }
-    }
-
-    explicit basic_point_zm(coord_const_iterator begin, coord_const_iterator end)
+    /*!
+     * @brief Creates a point from a sequence of coordinates of any arithmetic type
+     * @param begin the first coordinate
+     * @param end the past-the-end coordinate
+     */
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_point_zm(CoordIterator begin, CoordIterator end)
     {
-        assert(std::distance(begin, end) == N);
+        assert(static_cast<size_t>(std::distance(begin, end)) == N);
         size_t i = 0;
         for (auto it = begin; it != end; ++it)
         {
-            coords[i++] = *it;
+            coords[i++] = utils::coord_cast<T>(*it);
         }
     }
 
     std::size_t size() const noexcept
     {
-        return this->ndim();
+        return N;
     }
 
     // operators
@@ -938,7 +920,7 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
     friend class basic_geometry<basic_point_zm<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
         return geometry_type::POINTZM;
     }
@@ -950,15 +932,15 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
     bounds_t bounds_() const
     {
-        return {x, y, x, y};
+        return {static_cast<double>(x), static_cast<double>(y), static_cast<double>(x), static_cast<double>(y)};
     }
 
     // json
@@ -976,7 +958,7 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
                 throw exceptions::parse_error("invalid geometry type");
             }
             auto coords = j.at("coordinates").get<std::vector<double>>();
-            return {coords.at(0), coords.at(1), coords.at(2), coords.at(3)};
+            return {utils::coord_cast<T>(coords.at(0)), utils::coord_cast<T>(coords.at(1)), utils::coord_cast<T>(coords.at(2)), utils::coord_cast<T>(coords.at(3))};
         }
         catch (const std::out_of_range& e)
         {
@@ -1001,7 +983,7 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
             ss << std::setprecision(precision);
         }
         ss << "{\"type\":\"Point\",\"coordinates\":"
-           << "[" << x << "," << y << "," << z << "," << m << "]}";
+           << "[" << utils::coord_out(x) << "," << utils::coord_out(y) << "," << utils::coord_out(z) << "," << utils::coord_out(m) << "]}";
         return ss.str();
     }
 
@@ -1011,13 +993,13 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
     static basic_point_zm<T> from_wkt_(const std::string& wkt)
     {
         wkt_reader reader{};
-        auto result = reader.read(wkt);
-        auto data   = result.data;
+        auto result      = reader.read(wkt);
+        const auto& data = result.data;
         if (data.geom_type != geometry_type::POINTZM)
         {
             throw exceptions::parse_error("invalid wkt string");
         }
-        return {data.coords[0], data.coords[1], data.coords[2], data.coords[3]};
+        return {utils::coord_cast<T>(data.coords[0]), utils::coord_cast<T>(data.coords[1]), utils::coord_cast<T>(data.coords[2]), utils::coord_cast<T>(data.coords[3])};
     }
 
     /// @private
@@ -1029,7 +1011,7 @@ class basic_point_zm : public basic_geometry<basic_point_zm<T>>
             ss << std::setprecision(precision);
         }
         ss << "POINT ZM "
-           << "(" << x << " " << y << " " << z << " " << m << ")";
+           << "(" << utils::coord_out(x) << " " << utils::coord_out(y) << " " << utils::coord_out(z) << " " << utils::coord_out(m) << ")";
         return ss.str();
     }
 };
@@ -1078,5 +1060,40 @@ template <typename T>
 struct is_basic_point_zm<basic_point_zm<T>> : std::true_type
 {};
 
+/*!
+ * @brief The geometry type and the dimensions of a geometry class, known at compile time
+ *
+ * The members are std::integral_constant types, usable as constants through their value or as
+ * tags selecting an overload per dimension, so the per point branches on the dimension of the
+ * writers and the algorithms are resolved by the compiler. geometry_t holds a geometry of any
+ * type and has no traits.
+ *
+ * @tparam Geometry a point, multipoint, linestring, multilinestring, polygon or multipolygon class
+ *
+ * @since 0.0.1
+ */
+template <typename Geometry>
+struct dimension_traits
+{
+    /// the point type of the geometry
+    using point_type = typename Geometry::point_type;
+
+    /// whether the points have a z-coordinate
+    using has_z = std::integral_constant<bool, is_basic_point_z<point_type>::value or is_basic_point_zm<point_type>::value>;
+
+    /// whether the points have a m-coordinate
+    using has_m = std::integral_constant<bool, is_basic_point_m<point_type>::value or is_basic_point_zm<point_type>::value>;
+
+    /// the number of coordinates of the points
+    using ndim = std::integral_constant<size_t, 2 + (has_z::value ? 1 : 0) + (has_m::value ? 1 : 0)>;
+
+    /// the dimension type
+    using dim = std::integral_constant<dimension_type, has_z::value ? (has_m::value ? dimension_type::XYZM : dimension_type::XYZ)
+                                                                    : (has_m::value ? dimension_type::XYM : dimension_type::XY)>;
+
+    /// the geometry type
+    using geom_type = std::integral_constant<geometry_type, basic_geometry<Geometry>::static_geom_type_()>;
+};
+
 }  // namespace shapes
 }  // namespace simo
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <simo/geom/geometry.hpp>
 #include <simo/geom/linearring.hpp>
 #include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/detail/validity.hpp>
 
 namespace simo
 {
@@ -46,22 +47,12 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
         : base_type(init.begin(), init.end()) {}
 
 
-    explicit basic_polygon(coord_const_iterator first, coord_const_iterator last)
+    template <typename CoordIterator, typename = typename std::enable_if<utils::is_coord_iterator<CoordIterator>::value>::type>
+    explicit basic_polygon(CoordIterator first, CoordIterator last)
     {
         /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
-        for (auto it = first; it != last; it += n)
-        {
-            this->emplace_back(it, it + n);
-        }
-    }
-
-    explicit basic_polygon(coord_iterator first, coord_iterator last)
-    {
-        /// @todo deal with repetition
-        size_t n = this->ndim();
-        this->reserve(std::distance(first, last));
+        constexpr size_t n = dimension_traits<basic_polygon<T>>::ndim::value;
+        this->reserve(static_cast<size_t>(std::distance(first, last)) / n);
         for (auto it = first; it != last; it += n)
         {
             this->emplace_back(it, it + n);
@@ -73,8 +64,7 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
     {
         if (std::distance(coord_first, coord_last) > 0)
         {
-            auto n = this->ndim();
-            this->reserve((coord_last - coord_first) / n);
+            this->reserve(static_cast<size_t>(std::distance(offset_first, offset_last)));
             size_t lo = 0;
             for (auto it = offset_first; it != offset_last; ++it)
             {
@@ -108,13 +98,18 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
         return not operator==(lhs, rhs);
     }
 
-    std::vector<std::tuple<double, double>> xy() const
+    /*!
+     * @return the (x, y) coordinates of all the points, part after part
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
     {
-        std::vector<std::tuple<double, double>> res;
-        res.reserve(this->size());
-        for (const auto& p : *this)
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        for (const auto& part : *this)
         {
-            res.emplace_back(p.x, p.y);
+            auto part_xy = part.xy();
+            res.insert(res.end(), part_xy.begin(), part_xy.end());
         }
         return res;
     }
@@ -135,21 +130,12 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
     friend class basic_geometry<basic_polygon<T>>;
 
     /// @private
-    geometry_type geom_type_() const noexcept
+    static constexpr geometry_type geom_type_() noexcept
     {
-        if (is_basic_linestring_z<T>::value)
-        {
-            return geometry_type::POLYGONZ;
-        }
-        if (is_basic_linestring_m<T>::value)
-        {
-            return geometry_type::POLYGONM;
-        }
-        if (is_basic_linestring_zm<T>::value)
-        {
-            return geometry_type::POLYGONZM;
-        }
-        return geometry_type::POLYGON;
+        return is_basic_linestring_z<T>::value ? geometry_type::POLYGONZ :
+               is_basic_linestring_m<T>::value ? geometry_type::POLYGONM :
+               is_basic_linestring_zm<T>::value ? geometry_type::POLYGONZM :
+               geometry_type::POLYGON;
     }
 
     /// @private
@@ -163,9 +149,9 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const
     {
-        /// @todo (pavel) add checks
+        return detail::validate_polygon(*this);
     }
 
     /// @private
@@ -200,24 +186,23 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
                 throw exceptions::parse_error("invalid geometry type: " + std::string(geom_type));
             }
             const auto& rings = j.at("coordinates");
-            std::vector<T> res;
+            basic_polygon<T> res;
             res.reserve(rings.size());
-            std::vector<point_type> points;
             for (const auto& ring : rings)
             {
                 if (not ring.empty())
                 {
                     const auto& coords = ring.get<std::vector<std::vector<double>>>();
+                    T points;
                     points.reserve(coords.size());
                     std::for_each(std::begin(coords), std::end(coords),
                                   [&points](const std::vector<double>& coord) {
                                       points.emplace_back(coord.begin(), coord.end());
                                   });
-                    res.emplace_back(points.begin(), points.end());
+                    res.push_back(std::move(points));
                 }
-                points.clear();
             }
-            return basic_polygon<T>(res.begin(), res.end());
+            return res;
         }
         catch (const nlohmann::json::exception& e)
         {
@@ -260,7 +245,7 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
                     {
                         ss << ",";
                     }
-                    ss << p.coords[k];
+                    ss << utils::coord_out(p.coords[k]);
                 }
                 ss << "]";
                 ++i;
@@ -297,11 +282,11 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
             ss << std::setprecision(precision);
         }
         ss << "POLYGON";
-        if (this->has_z())
+        if (dimension_traits<basic_polygon<T>>::has_z::value)
         {
             ss << "Z";
         }
-        if (this->has_m())
+        if (dimension_traits<basic_polygon<T>>::has_m::value)
         {
             ss << "M";
         }
@@ -327,7 +312,7 @@ class basic_polygon : public std::vector<T, AllocatorType>, public basic_geometr
                     {
                         ss << " ";
                     }
-                    ss << p.coords[k];
+                    ss << utils::coord_out(p.coords[k]);
                 }
             }
             ss << ")";
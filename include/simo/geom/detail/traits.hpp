@@ -0,0 +1,124 @@
+#pragma once
+
+#include <ciso646>
+#include <simo/geom/detail/point.hpp>
+#include <simo/geom/detail/multipoint.hpp>
+#include <simo/geom/detail/linestring.hpp>
+#include <simo/geom/detail/multilinestring.hpp>
+#include <simo/geom/detail/polygon.hpp>
+#include <simo/geom/detail/multipolygon.hpp>
+#include <simo/geom/detail/view.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/// tag for Point geometries
+struct point_tag
+{};
+
+/// tag for MultiPoint geometries
+struct multipoint_tag
+{};
+
+/// tag for LineString geometries
+struct linestring_tag
+{};
+
+/// tag for MultiLineString geometries
+struct multilinestring_tag
+{};
+
+/// tag for Polygon geometries
+struct polygon_tag
+{};
+
+/// tag for MultiPolygon geometries
+struct multipolygon_tag
+{};
+
+/*!
+ * @brief Maps a geometry type to its tag, algorithms use the tag to select the implementation
+ *
+ * @tparam T the geometry type
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+struct geometry_traits;
+
+template <typename T>
+struct geometry_traits<basic_point<T>>
+{
+    using tag = point_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_point_z<T>>
+{
+    using tag = point_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_point_m<T>>
+{
+    using tag = point_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_point_zm<T>>
+{
+    using tag = point_tag;
+};
+
+template <typename T, typename AllocatorType>
+struct geometry_traits<basic_multipoint<T, AllocatorType>>
+{
+    using tag = multipoint_tag;
+};
+
+template <typename T, typename AllocatorType>
+struct geometry_traits<basic_linestring<T, AllocatorType>>
+{
+    using tag = linestring_tag;
+};
+
+template <typename T, typename AllocatorType>
+struct geometry_traits<basic_multilinestring<T, AllocatorType>>
+{
+    using tag = multilinestring_tag;
+};
+
+template <typename T, typename AllocatorType>
+struct geometry_traits<basic_polygon<T, AllocatorType>>
+{
+    using tag = polygon_tag;
+};
+
+template <typename T, typename AllocatorType>
+struct geometry_traits<basic_multipolygon<T, AllocatorType>>
+{
+    using tag = multipolygon_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_linestring_view<T>>
+{
+    using tag = linestring_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_polygon_view<T>>
+{
+    using tag = polygon_tag;
+};
+
+template <typename T>
+struct geometry_traits<basic_multipolygon_view<T>>
+{
+    using tag = multipolygon_tag;
+};
+
+}  // namespace shapes
+}  // namespace simo
@@ -107,5 +107,21 @@ enum class geometry_type : uint16_t
     TINZM                = 3016
 };
 
+/*!
+ * @brief Reasons for a geometry to be invalid
+ *
+ * @since 0.0.1
+ */
+enum class validity_code : uint8_t
+{
+    VALID              = 0,
+    TOO_FEW_POINTS     = 1,
+    RING_NOT_CLOSED    = 2,
+    SELF_INTERSECTION  = 3,
+    RING_CROSSING      = 4,
+    HOLE_OUTSIDE_SHELL = 5,
+    NESTED_HOLES       = 6
+};
+
 }  // namespace shapes
 }  // namespace simo
\ No newline at end of file
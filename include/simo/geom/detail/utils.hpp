@@ -1,6 +1,14 @@
 #pragma once
 
 #include <ciso646>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <simo/exceptions.hpp>
 #include <simo/geom/detail/types.hpp>
 
 namespace simo
@@ -255,6 +263,143 @@ bool is_multipolygon(geometry_type geom_type) noexcept
     return geom_type == geometry_type::MULTIPOLYGON or geom_type == geometry_type::MULTIPOLYGONZ or geom_type == geometry_type::MULTIPOLYGONM or geom_type == geometry_type::MULTIPOLYGONZM;
 }
 
+/// true if the iterator dereferences to a number, as opposed to a point
+template <typename Iterator, typename = void>
+struct is_coord_iterator : std::false_type
+{};
+
+template <typename Iterator>
+struct is_coord_iterator<Iterator, typename std::enable_if<std::is_arithmetic<
+                                       typename std::decay<decltype(*std::declval<Iterator>())>::type>::value>::type>
+    : std::true_type
+{};
+
+/// @private
+template <typename T, typename U>
+T coord_cast(U value, std::true_type) noexcept
+{
+    return static_cast<T>(std::llround(value));
+}
+
+/// @private
+template <typename T, typename U>
+T coord_cast(U value, std::false_type) noexcept
+{
+    return static_cast<T>(value);
+}
+
+/*!
+ * @brief Converts a coordinate to the coordinate type of a geometry
+ *
+ * The parsers read the coordinates as double, a floating point coordinate stored in an integral
+ * type is rounded to the nearest integer rather than truncated.
+ *
+ * @param value the coordinate
+ * @return the converted coordinate
+ *
+ * @since 0.0.1
+ */
+template <typename T, typename U>
+T coord_cast(U value) noexcept
+{
+    return coord_cast<T>(value, std::integral_constant<bool, std::is_integral<T>::value and std::is_floating_point<U>::value>{});
+}
+
+/*!
+ * @brief Promotes a coordinate for stream output, so the 8 bit integers are written as numbers
+ *
+ * @param value the coordinate
+ * @return the promoted coordinate
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+auto coord_out(T value) noexcept -> decltype(+value)
+{
+    return +value;
+}
+
+/// true if a value can be copied as its bytes, the libstdc++ of gcc 4.9 lacks std::is_trivially_copyable
+template <typename T>
+struct is_trivially_copyable
+#if defined(__GLIBCXX__) and not defined(_GLIBCXX_USE_CXX11_ABI)
+    : std::integral_constant<bool, __has_trivial_copy(T) and __has_trivial_assign(T) and
+                                       std::is_trivially_destructible<T>::value>
+#else
+    : std::is_trivially_copyable<T>
+#endif
+{};
+
+/// true if a point is stored as its coordinates only, so an array of points is an array of coordinates
+template <typename Point>
+struct is_packed_point
+    : std::integral_constant<bool, is_trivially_copyable<Point>::value and std::is_standard_layout<Point>::value and
+                                       sizeof(Point) == Point::N * sizeof(typename Point::coord_type)>
+{};
+
+/// true if the iterator points to contiguous values of the given type
+template <typename Iterator, typename T>
+struct is_contiguous_iterator
+    : std::integral_constant<bool, std::is_same<Iterator, T*>::value or std::is_same<Iterator, const T*>::value or
+                                       std::is_same<Iterator, typename std::vector<T>::iterator>::value or
+                                       std::is_same<Iterator, typename std::vector<T>::const_iterator>::value>
+{};
+
+/// @private the coordinates are copied with a single memcpy
+template <typename Container, typename CoordIterator>
+void assign_coords(Container& points, CoordIterator first, size_t size, std::true_type)
+{
+    points.resize(size / Container::value_type::N);
+    if (size > 0)
+    {
+        std::memcpy(static_cast<void*>(points.data()), &*first, size * sizeof(typename Container::value_type::coord_type));
+    }
+}
+
+/// @private the coordinates are converted a point at a time
+template <typename Container, typename CoordIterator>
+void assign_coords(Container& points, CoordIterator first, size_t size, std::false_type)
+{
+    constexpr size_t n = Container::value_type::N;
+    points.clear();
+    points.reserve(size / n);
+    for (size_t i = 0; i < size; i += n, std::advance(first, n))
+    {
+        auto last = first;
+        std::advance(last, n);
+        points.emplace_back(first, last);
+    }
+}
+
+/*!
+ * @brief Replaces the points of a container with the points of a coordinate sequence
+ *
+ * A contiguous sequence of the coordinate type of packed points, like a std::vector<double> or a
+ * const double* buffer for the double points, is copied in one memcpy, the other sequences are
+ * converted a point at a time.
+ *
+ * @param points the container of points
+ * @param first the first coordinate
+ * @param last the past-the-end coordinate
+ * @throw geometry_error if the number of coordinates is not a multiple of the number of dimensions
+ *
+ * @since 0.0.1
+ */
+template <typename Container, typename CoordIterator>
+void assign_coords(Container& points, CoordIterator first, CoordIterator last)
+{
+    using point_type = typename Container::value_type;
+    auto size        = static_cast<size_t>(std::distance(first, last));
+    if (size % point_type::N != 0)
+    {
+        throw exceptions::geometry_error("the number of coordinates " + std::to_string(size) + " is not a multiple of " +
+                                         std::to_string(point_type::N));
+    }
+    assign_coords(points, first, size,
+                  std::integral_constant<bool, is_packed_point<point_type>::value and
+                                                   is_contiguous_iterator<CoordIterator, typename point_type::coord_type>::value>{});
+}
+
 }  // namespace utils
 }  // namespace shapes
 }  // namespace simo
\ No newline at end of file
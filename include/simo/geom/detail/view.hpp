@@ -0,0 +1,1001 @@
+#pragma once
+
+#include <ciso646>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <simo/exceptions.hpp>
+#include <simo/geom/detail/geometry.hpp>
+#include <simo/geom/detail/utils.hpp>
+#include <simo/geom/detail/point.hpp>
+#include <simo/geom/detail/linestring.hpp>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/detail/validity.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+namespace detail
+{
+
+/// @private iterates over the parts of a view, the parts are views returned by value
+template <typename View>
+class view_iterator
+{
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = typename View::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const value_type*;
+    using reference         = value_type;
+
+    view_iterator(const View* view, size_t index) noexcept
+        : m_view(view), m_index(index)
+    {
+    }
+
+    value_type operator*() const
+    {
+        return (*m_view)[m_index];
+    }
+
+    view_iterator& operator++() noexcept
+    {
+        ++m_index;
+        return *this;
+    }
+
+    view_iterator operator++(int) noexcept
+    {
+        auto res = *this;
+        ++m_index;
+        return res;
+    }
+
+    friend bool operator==(const view_iterator& lhs, const view_iterator& rhs) noexcept
+    {
+        return lhs.m_view == rhs.m_view and lhs.m_index == rhs.m_index;
+    }
+
+    friend bool operator!=(const view_iterator& lhs, const view_iterator& rhs) noexcept
+    {
+        return not operator==(lhs, rhs);
+    }
+
+  private:
+    /// the view
+    const View* m_view;
+
+    /// the index of the part
+    size_t m_index;
+};
+
+/*!
+ * @brief Checks the offsets of the parts of a view, the offsets are the ends of the parts
+ *
+ * @param offsets the offsets
+ * @param size the number of parts
+ * @param n the multiple of the part sizes
+ * @param last the end of the viewed values
+ * @throw geometry_error if the offsets are decreasing or past last, or a part size is not a multiple of n
+ */
+inline void check_offsets(const size_t* offsets, size_t size, size_t n, size_t last)
+{
+    size_t lo = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (offsets[i] < lo or offsets[i] > last or (offsets[i] - lo) % n != 0)
+        {
+            throw exceptions::geometry_error("invalid offset " + std::to_string(offsets[i]) + " at index " + std::to_string(i));
+        }
+        lo = offsets[i];
+    }
+}
+
+}  // namespace detail
+
+template <typename T>
+class basic_polygon_view;
+
+template <typename T>
+class basic_multipolygon_view;
+
+/*!
+ * @brief A non-owning linestring over a borrowed array of interleaved coordinates
+ *
+ * The view does not copy the coordinates, the array must outlive it. The view is read-only,
+ * it has the output functions and works with the algorithms taking a linestring.
+ *
+ * The points are read in place as an array of T over the coordinates, no T object is ever
+ * created there. The standard leaves this access undefined, it relies on T being trivially
+ * copyable and stored as its coordinates only, which the compilers supported by the library
+ * read as the coordinates themselves.
+ *
+ * @tparam T the point type, stored as its coordinates only
+ * @ingroup geometry
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+class basic_linestring_view : public basic_geometry<basic_linestring_view<T>>
+{
+    static_assert(utils::is_packed_point<T>::value, "the points must be stored as their coordinates only");
+    static_assert(utils::is_trivially_copyable<T>::value, "the points must be trivially copyable");
+
+  public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using reference       = const T&;
+    using const_reference = const T&;
+    using iterator        = const T*;
+    using const_iterator  = const T*;
+
+    using point_type           = typename T::point_type;
+    using point_iterator       = const T*;
+    using point_const_iterator = const T*;
+
+    using coord_type = typename T::coord_type;
+
+    basic_linestring_view() noexcept = default;
+
+    /*!
+     * @param coords the coordinates
+     * @param size the number of coordinates, a multiple of the number of dimensions
+     * @throw geometry_error if the size is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    basic_linestring_view(const coord_type* coords, size_t size)
+        : m_points(reinterpret_cast<const T*>(coords)), m_size(size / T::N)
+    {
+        if (size % T::N != 0)
+        {
+            throw exceptions::geometry_error("the number of coordinates " + std::to_string(size) + " is not a multiple of " +
+                                             std::to_string(T::N));
+        }
+    }
+
+    /*!
+     * @param linestring the linestring, it must outlive the view
+     *
+     * @since 0.0.1
+     */
+    template <typename AllocatorType>
+    explicit basic_linestring_view(const basic_linestring<T, AllocatorType>& linestring) noexcept
+        : m_points(linestring.data()), m_size(linestring.size())
+    {
+    }
+
+    // operators
+
+    /*!
+     * @param lhs a linestring view
+     * @param rhs a linestring view
+     * @return true if all points are equal, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator==(const basic_linestring_view<T>& lhs, const basic_linestring_view<T>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * @param lhs a linestring view
+     * @param rhs a linestring view
+     * @return true if at least one point is different, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator!=(const basic_linestring_view<T>& lhs, const basic_linestring_view<T>& rhs)
+    {
+        return not operator==(lhs, rhs);
+    }
+
+    const T& operator[](size_t pos) const noexcept
+    {
+        return m_points[pos];
+    }
+
+    /*!
+     * @param pos the index of the point
+     * @return the point at the given index
+     * @throw std::out_of_range if the index is out of range
+     *
+     * @since 0.0.1
+     */
+    const T& at(size_t pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("invalid point index: " + std::to_string(pos));
+        }
+        return m_points[pos];
+    }
+
+    const T& front() const noexcept
+    {
+        return m_points[0];
+    }
+
+    const T& back() const noexcept
+    {
+        return m_points[m_size - 1];
+    }
+
+    const T* data() const noexcept
+    {
+        return m_points;
+    }
+
+    const T* begin() const noexcept
+    {
+        return m_points;
+    }
+
+    const T* end() const noexcept
+    {
+        return m_points + m_size;
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /*!
+     * @return the (x, y) coordinates of the points
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
+    {
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        res.reserve(m_size);
+        for (const auto& p : *this)
+        {
+            res.emplace_back(p.x, p.y);
+        }
+        return res;
+    }
+
+    /*!
+     * @param precision the number of decimal digits
+     * @return the encoded polyline of the points
+     *
+     * @since 0.0.1
+     */
+    std::string polyline(std::int32_t precision = 5) const
+    {
+        static_assert(is_basic_point<T>::value, "must contain XY points");
+
+        std::string res;
+        res.reserve(m_size * 6);
+        double prev_lng = 0;
+        double prev_lat = 0;
+        for (const auto& p : *this)
+        {
+            res += polyline::encode(p.lat - prev_lat, precision);
+            res += polyline::encode(p.lng - prev_lng, precision);
+            prev_lat = p.lat;
+            prev_lng = p.lng;
+        }
+        return res;
+    }
+
+  private:
+    friend class basic_geometry<basic_linestring_view<T>>;
+
+    template <typename>
+    friend class basic_polygon_view;
+
+    /// the first point
+    const T* m_points = nullptr;
+
+    /// the number of points
+    size_t m_size = 0;
+
+    /// @private
+    static constexpr geometry_type geom_type_() noexcept
+    {
+        return is_basic_point_z<T>::value ? geometry_type::LINESTRINGZ :
+               is_basic_point_m<T>::value ? geometry_type::LINESTRINGM :
+               is_basic_point_zm<T>::value ? geometry_type::LINESTRINGZM :
+               geometry_type::LINESTRING;
+    }
+
+    /// @private
+    bool is_closed_() const noexcept
+    {
+        return empty() or front() == back();
+    }
+
+    /// @private
+    validity_report validate_() const noexcept
+    {
+        if (empty())
+        {
+            return {};
+        }
+        if (m_size < 2)
+        {
+            return {validity_code::TOO_FEW_POINTS, "LineString should be either empty or with 2 or more points"};
+        }
+        if (m_size == 2 and front() == back())
+        {
+            return {validity_code::TOO_FEW_POINTS, "LineString with exactly two equal points",
+                    static_cast<double>(front().x), static_cast<double>(front().y)};
+        }
+        return {};
+    }
+
+    /// @private
+    bounds_t bounds_() const
+    {
+        bounds_t res{};
+        for (const auto& p : *this)
+        {
+            res.extend(p.x, p.y);
+        }
+        return res;
+    }
+
+    /// @private writes the points, e.g. [[1,2],[3,4]]
+    void json_points_(std::ostream& os) const
+    {
+        os << "[";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                os << ",";
+            }
+            os << "[";
+            const auto& p = m_points[i];
+            for (size_t j = 0; j < p.size(); ++j)
+            {
+                if (j > 0)
+                {
+                    os << ",";
+                }
+                os << utils::coord_out(p.coords[j]);
+            }
+            os << "]";
+        }
+        os << "]";
+    }
+
+    /// @private writes the points, e.g. (1 2,3 4)
+    void wkt_points_(std::ostream& os) const
+    {
+        os << "(";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                os << ",";
+            }
+            const auto& p = m_points[i];
+            for (size_t j = 0; j < p.size(); ++j)
+            {
+                if (j > 0)
+                {
+                    os << " ";
+                }
+                os << utils::coord_out(p.coords[j]);
+            }
+        }
+        os << ")";
+    }
+
+    /// @private
+    std::string json_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "{\"type\":\"LineString\",\"coordinates\":";
+        json_points_(ss);
+        ss << "}";
+        return ss.str();
+    }
+
+    /// @private
+    std::string wkt_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "LINESTRING";
+        if (dimension_traits<basic_linestring_view<T>>::has_z::value)
+        {
+            ss << "Z";
+        }
+        if (dimension_traits<basic_linestring_view<T>>::has_m::value)
+        {
+            ss << "M";
+        }
+        wkt_points_(ss);
+        return ss.str();
+    }
+};
+
+/*!
+ * @brief A non-owning polygon over a borrowed array of interleaved coordinates and the offsets of its rings
+ *
+ * The offsets are the ends of the rings in the coordinates, as in the offset constructors of
+ * the polygon. The rings are linestring views, returned by value. The arrays must outlive the view.
+ * The points are read in place, as for the linestring view.
+ *
+ * @tparam T the point type, stored as its coordinates only
+ * @ingroup geometry
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+class basic_polygon_view : public basic_geometry<basic_polygon_view<T>>
+{
+  public:
+    using value_type      = basic_linestring_view<T>;
+    using size_type       = size_t;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using iterator        = detail::view_iterator<basic_polygon_view<T>>;
+    using const_iterator  = iterator;
+
+    using point_type = typename T::point_type;
+    using coord_type = typename T::coord_type;
+
+    basic_polygon_view() noexcept = default;
+
+    /*!
+     * @param coords the coordinates
+     * @param num_coords the number of coordinates
+     * @param offsets the ends of the rings in the coordinates
+     * @param size the number of rings
+     * @throw geometry_error if the offsets are decreasing or past the coordinates, or a ring size is not a
+     * multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    basic_polygon_view(const coord_type* coords, size_t num_coords, const size_t* offsets, size_t size)
+        : basic_polygon_view(coords, offsets, size, 0)
+    {
+        detail::check_offsets(offsets, size, T::N, num_coords);
+    }
+
+    // operators
+
+    /*!
+     * @param lhs a polygon view
+     * @param rhs a polygon view
+     * @return true if all rings are equal, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator==(const basic_polygon_view<T>& lhs, const basic_polygon_view<T>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * @param lhs a polygon view
+     * @param rhs a polygon view
+     * @return true if at least one ring is different, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator!=(const basic_polygon_view<T>& lhs, const basic_polygon_view<T>& rhs)
+    {
+        return not operator==(lhs, rhs);
+    }
+
+    value_type operator[](size_t pos) const noexcept
+    {
+        size_t lo = pos == 0 ? m_first : m_offsets[pos - 1];
+        value_type res;
+        res.m_points = reinterpret_cast<const T*>(m_coords + lo);
+        res.m_size   = (m_offsets[pos] - lo) / T::N;
+        return res;
+    }
+
+    /*!
+     * @param pos the index of the ring
+     * @return the ring at the given index
+     * @throw std::out_of_range if the index is out of range
+     *
+     * @since 0.0.1
+     */
+    value_type at(size_t pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("invalid ring index: " + std::to_string(pos));
+        }
+        return (*this)[pos];
+    }
+
+    value_type front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    value_type back() const noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+    iterator begin() const noexcept
+    {
+        return {this, 0};
+    }
+
+    iterator end() const noexcept
+    {
+        return {this, m_size};
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /*!
+     * @return the (x, y) coordinates of the points of all rings
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
+    {
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        for (const auto& ring : *this)
+        {
+            for (const auto& p : ring)
+            {
+                res.emplace_back(p.x, p.y);
+            }
+        }
+        return res;
+    }
+
+  private:
+    friend class basic_geometry<basic_polygon_view<T>>;
+
+    template <typename>
+    friend class basic_multipolygon_view;
+
+    /// the coordinates
+    const coord_type* m_coords = nullptr;
+
+    /// the ends of the rings in the coordinates
+    const size_t* m_offsets = nullptr;
+
+    /// the number of rings
+    size_t m_size = 0;
+
+    /// the start of the first ring in the coordinates
+    size_t m_first = 0;
+
+    /// @private the rings of a multipolygon view, the offsets are checked by the multipolygon view
+    basic_polygon_view(const coord_type* coords, const size_t* offsets, size_t size, size_t first) noexcept
+        : m_coords(coords), m_offsets(offsets), m_size(size), m_first(first)
+    {
+    }
+
+    /// @private
+    static constexpr geometry_type geom_type_() noexcept
+    {
+        return is_basic_point_z<T>::value ? geometry_type::POLYGONZ :
+               is_basic_point_m<T>::value ? geometry_type::POLYGONM :
+               is_basic_point_zm<T>::value ? geometry_type::POLYGONZM :
+               geometry_type::POLYGON;
+    }
+
+    /// @private
+    bool is_closed_() const noexcept
+    {
+        for (const auto& ring : *this)
+        {
+            if (not ring.is_closed())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @private
+    validity_report validate_() const
+    {
+        return detail::validate_polygon(*this);
+    }
+
+    /// @private
+    bounds_t bounds_() const
+    {
+        bounds_t res{};
+        for (const auto& ring : *this)
+        {
+            res.extend(ring.bounds());
+        }
+        return res;
+    }
+
+    /// @private writes the rings, e.g. [[[1,2],[3,4]]]
+    void json_rings_(std::ostream& os) const
+    {
+        os << "[";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                os << ",";
+            }
+            (*this)[i].json_points_(os);
+        }
+        os << "]";
+    }
+
+    /// @private writes the rings, e.g. ((1 2,3 4))
+    void wkt_rings_(std::ostream& os) const
+    {
+        os << "(";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                os << ",";
+            }
+            (*this)[i].wkt_points_(os);
+        }
+        os << ")";
+    }
+
+    /// @private
+    std::string json_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "{\"type\":\"Polygon\",\"coordinates\":";
+        json_rings_(ss);
+        ss << "}";
+        return ss.str();
+    }
+
+    /// @private
+    std::string wkt_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "POLYGON";
+        if (dimension_traits<basic_polygon_view<T>>::has_z::value)
+        {
+            ss << "Z";
+        }
+        if (dimension_traits<basic_polygon_view<T>>::has_m::value)
+        {
+            ss << "M";
+        }
+        wkt_rings_(ss);
+        return ss.str();
+    }
+};
+
+/*!
+ * @brief A non-owning multipolygon over a borrowed array of interleaved coordinates and the offsets of its rings and polygons
+ *
+ * The ring offsets are the ends of the rings in the coordinates, the polygon offsets are the
+ * ends of the polygons in the rings. The polygons are polygon views, returned by value. The
+ * arrays must outlive the view. The points are read in place, as for the linestring view.
+ *
+ * @tparam T the point type, stored as its coordinates only
+ * @ingroup geometry
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+class basic_multipolygon_view : public basic_geometry<basic_multipolygon_view<T>>
+{
+  public:
+    using value_type      = basic_polygon_view<T>;
+    using size_type       = size_t;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using iterator        = detail::view_iterator<basic_multipolygon_view<T>>;
+    using const_iterator  = iterator;
+
+    using point_type = typename T::point_type;
+    using coord_type = typename T::coord_type;
+
+    basic_multipolygon_view() noexcept = default;
+
+    /*!
+     * @param coords the coordinates
+     * @param num_coords the number of coordinates
+     * @param ring_offsets the ends of the rings in the coordinates
+     * @param num_rings the number of rings
+     * @param polygon_offsets the ends of the polygons in the rings
+     * @param size the number of polygons
+     * @throw geometry_error if the offsets are decreasing or past the rings or the coordinates, or a ring size
+     * is not a multiple of the number of dimensions
+     *
+     * @since 0.0.1
+     */
+    basic_multipolygon_view(const coord_type* coords, size_t num_coords, const size_t* ring_offsets, size_t num_rings,
+                            const size_t* polygon_offsets, size_t size)
+        : m_coords(coords), m_ring_offsets(ring_offsets), m_polygon_offsets(polygon_offsets), m_size(size)
+    {
+        detail::check_offsets(ring_offsets, num_rings, T::N, num_coords);
+        detail::check_offsets(polygon_offsets, size, 1, num_rings);
+    }
+
+    // operators
+
+    /*!
+     * @param lhs a multipolygon view
+     * @param rhs a multipolygon view
+     * @return true if all polygons are equal, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator==(const basic_multipolygon_view<T>& lhs, const basic_multipolygon_view<T>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * @param lhs a multipolygon view
+     * @param rhs a multipolygon view
+     * @return true if at least one polygon is different, otherwise false
+     *
+     * @since 0.0.1
+     */
+    friend bool operator!=(const basic_multipolygon_view<T>& lhs, const basic_multipolygon_view<T>& rhs)
+    {
+        return not operator==(lhs, rhs);
+    }
+
+    value_type operator[](size_t pos) const noexcept
+    {
+        size_t lo = pos == 0 ? 0 : m_polygon_offsets[pos - 1];
+        return value_type(m_coords, m_ring_offsets + lo, m_polygon_offsets[pos] - lo, lo == 0 ? 0 : m_ring_offsets[lo - 1]);
+    }
+
+    /*!
+     * @param pos the index of the polygon
+     * @return the polygon at the given index
+     * @throw std::out_of_range if the index is out of range
+     *
+     * @since 0.0.1
+     */
+    value_type at(size_t pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("invalid polygon index: " + std::to_string(pos));
+        }
+        return (*this)[pos];
+    }
+
+    value_type front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    value_type back() const noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+    iterator begin() const noexcept
+    {
+        return {this, 0};
+    }
+
+    iterator end() const noexcept
+    {
+        return {this, m_size};
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /*!
+     * @return the (x, y) coordinates of the points of all polygons
+     *
+     * @since 0.0.1
+     */
+    std::vector<std::tuple<coord_type, coord_type>> xy() const
+    {
+        std::vector<std::tuple<coord_type, coord_type>> res;
+        for (const auto& polygon : *this)
+        {
+            auto coords = polygon.xy();
+            res.insert(res.end(), coords.begin(), coords.end());
+        }
+        return res;
+    }
+
+  private:
+    friend class basic_geometry<basic_multipolygon_view<T>>;
+
+    /// the coordinates
+    const coord_type* m_coords = nullptr;
+
+    /// the ends of the rings in the coordinates
+    const size_t* m_ring_offsets = nullptr;
+
+    /// the ends of the polygons in the rings
+    const size_t* m_polygon_offsets = nullptr;
+
+    /// the number of polygons
+    size_t m_size = 0;
+
+    /// @private
+    static constexpr geometry_type geom_type_() noexcept
+    {
+        return is_basic_point_z<T>::value ? geometry_type::MULTIPOLYGONZ :
+               is_basic_point_m<T>::value ? geometry_type::MULTIPOLYGONM :
+               is_basic_point_zm<T>::value ? geometry_type::MULTIPOLYGONZM :
+               geometry_type::MULTIPOLYGON;
+    }
+
+    /// @private
+    bool is_closed_() const noexcept
+    {
+        for (const auto& polygon : *this)
+        {
+            if (not polygon.is_closed())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @private
+    validity_report validate_() const
+    {
+        for (const auto& polygon : *this)
+        {
+            auto res = polygon.validate();
+            if (not res.valid())
+            {
+                return res;
+            }
+        }
+        return {};
+    }
+
+    /// @private
+    bounds_t bounds_() const
+    {
+        bounds_t res{};
+        for (const auto& polygon : *this)
+        {
+            res.extend(polygon.bounds());
+        }
+        return res;
+    }
+
+    /// @private
+    std::string json_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "{\"type\":\"MultiPolygon\",\"coordinates\":[";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                ss << ",";
+            }
+            (*this)[i].json_rings_(ss);
+        }
+        ss << "]}";
+        return ss.str();
+    }
+
+    /// @private
+    std::string wkt_(std::int32_t precision = -1) const
+    {
+        std::stringstream ss;
+        if (precision >= 0)
+        {
+            ss << std::setprecision(precision);
+        }
+        ss << "MULTIPOLYGON";
+        if (dimension_traits<basic_multipolygon_view<T>>::has_z::value)
+        {
+            ss << "Z";
+        }
+        if (dimension_traits<basic_multipolygon_view<T>>::has_m::value)
+        {
+            ss << "M";
+        }
+        ss << "(";
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (i > 0)
+            {
+                ss << ",";
+            }
+            (*this)[i].wkt_rings_(ss);
+        }
+        ss << ")";
+        return ss.str();
+    }
+};
+
+}  // namespace shapes
+}  // namespace simo
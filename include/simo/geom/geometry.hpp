@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ciso646>
+#include <utility>
 #include <simo/geom/detail/geometry.hpp>
 #include <simo/geom/point.hpp>
 #include <simo/geom/multipoint.hpp>
@@ -223,21 +224,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     {
     }
 
+    explicit geometry_t(multipoint_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOINT)
+    {
+    }
+
     explicit geometry_t(const multipoint_z_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOINTZ)
     {
     }
 
+    explicit geometry_t(multipoint_z_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOINTZ)
+    {
+    }
+
     explicit geometry_t(const multipoint_m_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOINTM)
     {
     }
 
+    explicit geometry_t(multipoint_m_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOINTM)
+    {
+    }
+
     explicit geometry_t(const multipoint_zm_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOINTZM)
     {
     }
 
+    explicit geometry_t(multipoint_zm_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOINTZM)
+    {
+    }
+
     // linestring
 
     explicit geometry_t(const linestring_t<T>& value)
@@ -245,21 +266,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     {
     }
 
+    explicit geometry_t(linestring_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::LINESTRING)
+    {
+    }
+
     explicit geometry_t(const linestring_z_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::LINESTRINGZ)
     {
     }
 
+    explicit geometry_t(linestring_z_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::LINESTRINGZ)
+    {
+    }
+
     explicit geometry_t(const linestring_m_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::LINESTRINGM)
     {
     }
 
+    explicit geometry_t(linestring_m_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::LINESTRINGM)
+    {
+    }
+
     explicit geometry_t(const linestring_zm_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::LINESTRINGZM)
     {
     }
 
+    explicit geometry_t(linestring_zm_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::LINESTRINGZM)
+    {
+    }
+
     // multilinestring
 
     explicit geometry_t(const multilinestring_t<T>& value)
@@ -267,21 +308,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     {
     }
 
+    explicit geometry_t(multilinestring_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTILINESTRING)
+    {
+    }
+
     explicit geometry_t(const multilinestring_z_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTILINESTRINGZ)
     {
     }
 
+    explicit geometry_t(multilinestring_z_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTILINESTRINGZ)
+    {
+    }
+
     explicit geometry_t(const multilinestring_m_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTILINESTRINGM)
     {
     }
 
+    explicit geometry_t(multilinestring_m_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTILINESTRINGM)
+    {
+    }
+
     explicit geometry_t(const multilinestring_zm_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTILINESTRINGZM)
     {
     }
 
+    explicit geometry_t(multilinestring_zm_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTILINESTRINGZM)
+    {
+    }
+
     // polygon
 
     explicit geometry_t(const polygon_t<T>& value)
@@ -289,21 +350,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     {
     }
 
+    explicit geometry_t(polygon_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::POLYGON)
+    {
+    }
+
     explicit geometry_t(const polygon_z_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::POLYGONZ)
     {
     }
 
+    explicit geometry_t(polygon_z_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::POLYGONZ)
+    {
+    }
+
     explicit geometry_t(const polygon_m_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::POLYGONM)
     {
     }
 
+    explicit geometry_t(polygon_m_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::POLYGONM)
+    {
+    }
+
     explicit geometry_t(const polygon_zm_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::POLYGONZM)
     {
     }
 
+    explicit geometry_t(polygon_zm_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::POLYGONZM)
+    {
+    }
+
     // multipolygon
 
     explicit geometry_t(const multipolygon_t<T>& value)
@@ -311,21 +392,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     {
     }
 
+    explicit geometry_t(multipolygon_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOLYGON)
+    {
+    }
+
     explicit geometry_t(const multipolygon_z_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOLYGONZ)
     {
     }
 
+    explicit geometry_t(multipolygon_z_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOLYGONZ)
+    {
+    }
+
     explicit geometry_t(const multipolygon_m_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOLYGONM)
     {
     }
 
+    explicit geometry_t(multipolygon_m_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOLYGONM)
+    {
+    }
+
     explicit geometry_t(const multipolygon_zm_t<T>& value)
         : m_value(value), m_geom_type(geometry_type::MULTIPOLYGONZM)
     {
     }
 
+    explicit geometry_t(multipolygon_zm_t<T>&& value)
+        : m_value(std::move(value)), m_geom_type(geometry_type::MULTIPOLYGONZM)
+    {
+    }
+
     ~geometry_t()
     {
         switch (m_geom_type)
@@ -995,21 +1096,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
         {
         }
 
+        explicit geom_value(multipoint_t<T>&& p)
+            : m_multipoint(new multipoint_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipoint_z_t<T>& p)
             : m_multipoint_z(new multipoint_z_t<T>(p))
         {
         }
 
+        explicit geom_value(multipoint_z_t<T>&& p)
+            : m_multipoint_z(new multipoint_z_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipoint_m_t<T>& p)
             : m_multipoint_m(new multipoint_m_t<T>(p))
         {
         }
 
+        explicit geom_value(multipoint_m_t<T>&& p)
+            : m_multipoint_m(new multipoint_m_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipoint_zm_t<T>& p)
             : m_multipoint_zm(new multipoint_zm_t<T>(p))
         {
         }
 
+        explicit geom_value(multipoint_zm_t<T>&& p)
+            : m_multipoint_zm(new multipoint_zm_t<T>(std::move(p)))
+        {
+        }
+
         // linestring
 
         explicit geom_value(const linestring_t<T>& p)
@@ -1017,21 +1138,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
         {
         }
 
+        explicit geom_value(linestring_t<T>&& p)
+            : m_linestring(new linestring_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const linestring_z_t<T>& p)
             : m_linestring_z(new linestring_z_t<T>(p))
         {
         }
 
+        explicit geom_value(linestring_z_t<T>&& p)
+            : m_linestring_z(new linestring_z_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const linestring_m_t<T>& p)
             : m_linestring_m(new linestring_m_t<T>(p))
         {
         }
 
+        explicit geom_value(linestring_m_t<T>&& p)
+            : m_linestring_m(new linestring_m_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const linestring_zm_t<T>& p)
             : m_linestring_zm(new linestring_zm_t<T>(p))
         {
         }
 
+        explicit geom_value(linestring_zm_t<T>&& p)
+            : m_linestring_zm(new linestring_zm_t<T>(std::move(p)))
+        {
+        }
+
         // multilinestring
 
         explicit geom_value(const multilinestring_t<T>& p)
@@ -1039,21 +1180,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
         {
         }
 
+        explicit geom_value(multilinestring_t<T>&& p)
+            : m_multilinestring(new multilinestring_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multilinestring_z_t<T>& p)
             : m_multilinestring_z(new multilinestring_z_t<T>(p))
         {
         }
 
+        explicit geom_value(multilinestring_z_t<T>&& p)
+            : m_multilinestring_z(new multilinestring_z_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multilinestring_m_t<T>& p)
             : m_multilinestring_m(new multilinestring_m_t<T>(p))
         {
         }
 
+        explicit geom_value(multilinestring_m_t<T>&& p)
+            : m_multilinestring_m(new multilinestring_m_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multilinestring_zm_t<T>& p)
             : m_multilinestring_zm(new multilinestring_zm_t<T>(p))
         {
         }
 
+        explicit geom_value(multilinestring_zm_t<T>&& p)
+            : m_multilinestring_zm(new multilinestring_zm_t<T>(std::move(p)))
+        {
+        }
+
         // polygon
 
         explicit geom_value(const polygon_t<T>& p)
@@ -1061,21 +1222,41 @@ class geometry_t : public basic_geometry<geometry_t<T>>
         {
         }
 
+        explicit geom_value(polygon_t<T>&& p)
+            : m_polygon(new polygon_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const polygon_z_t<T>& p)
             : m_polygon_z(new polygon_z_t<T>(p))
         {
         }
 
+        explicit geom_value(polygon_z_t<T>&& p)
+            : m_polygon_z(new polygon_z_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const polygon_m_t<T>& p)
             : m_polygon_m(new polygon_m_t<T>(p))
         {
         }
 
+        explicit geom_value(polygon_m_t<T>&& p)
+            : m_polygon_m(new polygon_m_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const polygon_zm_t<T>& p)
             : m_polygon_zm(new polygon_zm_t<T>(p))
         {
         }
 
+        explicit geom_value(polygon_zm_t<T>&& p)
+            : m_polygon_zm(new polygon_zm_t<T>(std::move(p)))
+        {
+        }
+
         // multipolygon
 
         explicit geom_value(const multipolygon_t<T>& p)
@@ -1083,20 +1264,40 @@ class geometry_t : public basic_geometry<geometry_t<T>>
         {
         }
 
+        explicit geom_value(multipolygon_t<T>&& p)
+            : m_multipolygon(new multipolygon_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipolygon_z_t<T>& p)
             : m_multipolygon_z(new multipolygon_z_t<T>(p))
         {
         }
 
+        explicit geom_value(multipolygon_z_t<T>&& p)
+            : m_multipolygon_z(new multipolygon_z_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipolygon_m_t<T>& p)
             : m_multipolygon_m(new multipolygon_m_t<T>(p))
         {
         }
 
+        explicit geom_value(multipolygon_m_t<T>&& p)
+            : m_multipolygon_m(new multipolygon_m_t<T>(std::move(p)))
+        {
+        }
+
         explicit geom_value(const multipolygon_zm_t<T>& p)
             : m_multipolygon_zm(new multipolygon_zm_t<T>(p))
         {
         }
+
+        explicit geom_value(multipolygon_zm_t<T>&& p)
+            : m_multipolygon_zm(new multipolygon_zm_t<T>(std::move(p)))
+        {
+        }
     };
 
     geom_value m_value        = {};
@@ -1133,9 +1334,9 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     }
 
     /// @private
-    void throw_for_invalid_() const
+    validity_report validate_() const noexcept
     {
-        // do nothing
+        return {};
     }
 
     /// @private
@@ -1290,8 +1491,8 @@ class geometry_t : public basic_geometry<geometry_t<T>>
     static geometry_t<T> from_wkt_(const std::string& wkt)
     {
         wkt_reader reader{};
-        auto result = reader.read(wkt);
-        auto data   = result.data;
+        auto result      = reader.read(wkt);
+        const auto& data = result.data;
         switch (data.geom_type)
         {
             case geometry_type::POINT:
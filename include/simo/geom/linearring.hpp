@@ -30,9 +30,7 @@ using LinearRingZ  = linearring_z_t<double>;
 using LinearRingM  = linearring_m_t<double>;
 using LinearRingZM = linearring_zm_t<double>;
 
-/// @todo (pavel) LinearRing is not closed, first and last point are different
-/// @todo (pavel) LinearRing should be either empty or with 4 or more points
-/// @todo (pavel) LinearRing cannot self-intersect
+/// @note a LinearRing is a LineString, its closure, size and self-intersections are checked by the polygon holding it
 /// @todo (pavel) LinearRing should be implicitly closed
 
 }  // namespace shapes
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <ciso646>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <simo/geom/detail/point.hpp>
+#include <simo/geom/detail/linestring.hpp>
+#include <simo/geom/detail/view.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief Adapts a user-defined point type, specialized with SHAPES_REGISTER_POINT_2D or SHAPES_REGISTER_POINT_3D
+ *
+ * A specialization has the coordinate type, the number of dimensions, whether the point is
+ * stored as the coordinates of a basic_point in the same order, and the accessors of the
+ * coordinates. A packed point is trivially copyable, has a standard layout and only members
+ * of the coordinate type at the offsets of the coordinates.
+ *
+ * @tparam Point the user-defined point type
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+struct point_traits;
+
+namespace detail
+{
+
+/// @private
+template <typename Point, typename = void>
+struct is_registered_point : std::false_type
+{};
+
+/// @private
+template <typename Point>
+struct is_registered_point<Point, decltype(void(sizeof(typename point_traits<Point>::coord_type)))> : std::true_type
+{};
+
+/// @private the type itself, dependent on another type so that its use waits for the instantiation
+template <typename Type, typename>
+struct dependent_type
+{
+    using type = Type;
+};
+
+/// @private the basic point with the same coordinates as a registered point
+template <typename Point, size_t N = point_traits<Point>::ndim>
+struct registered_point_type
+{
+    using type = basic_point<typename point_traits<Point>::coord_type>;
+};
+
+/// @private
+template <typename Point>
+struct registered_point_type<Point, 3>
+{
+    using type = basic_point_z<typename point_traits<Point>::coord_type>;
+};
+
+/// @private
+template <typename BasicPoint, typename Point>
+BasicPoint point_cast(const Point& p, std::integral_constant<size_t, 2>)
+{
+    return BasicPoint(point_traits<Point>::x(p), point_traits<Point>::y(p));
+}
+
+/// @private
+template <typename BasicPoint, typename Point>
+BasicPoint point_cast(const Point& p, std::integral_constant<size_t, 3>)
+{
+    return BasicPoint(point_traits<Point>::x(p), point_traits<Point>::y(p), point_traits<Point>::z(p));
+}
+
+/// @private the coordinates of contiguous points stored as the coordinates of a basic point, read in place as the views do
+template <typename Point>
+const typename point_traits<Point>::coord_type* registered_coords(const Point* points) noexcept
+{
+    static_assert(point_traits<Point>::packed, "the points are not stored as the coordinates of a basic point");
+    static_assert(utils::is_trivially_copyable<Point>::value, "the points must be trivially copyable");
+    return reinterpret_cast<const typename point_traits<Point>::coord_type*>(points);
+}
+
+/// @private
+template <typename Linestring, typename PointIterator>
+void assign_points(Linestring& res, PointIterator first, PointIterator last, std::true_type)
+{
+    using point_type = typename std::iterator_traits<PointIterator>::value_type;
+    if (first == last)
+    {
+        return;
+    }
+    res.assign(registered_coords(&*first), static_cast<size_t>(std::distance(first, last)) * point_traits<point_type>::ndim);
+}
+
+/// @private
+template <typename Linestring, typename PointIterator>
+void assign_points(Linestring& res, PointIterator first, PointIterator last, std::false_type)
+{
+    using point_type = typename std::iterator_traits<PointIterator>::value_type;
+    res.reserve(static_cast<size_t>(std::distance(first, last)));
+    for (auto it = first; it != last; ++it)
+    {
+        res.push_back(point_cast<typename Linestring::point_type>(*it, std::integral_constant<size_t, point_traits<point_type>::ndim>{}));
+    }
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Whether a point type is registered with SHAPES_REGISTER_POINT_2D or SHAPES_REGISTER_POINT_3D
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+struct is_registered_point : detail::is_registered_point<Point>
+{};
+
+/*!
+ * @brief The basic point with the same coordinate type and dimensions as a registered point
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+using registered_point_t = typename detail::registered_point_type<Point>::type;
+
+/*!
+ * @param p a registered point
+ * @return the basic point with the same coordinates
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+registered_point_t<Point> point_cast(const Point& p)
+{
+    static_assert(is_registered_point<Point>::value, "the point type is not registered");
+    return detail::point_cast<registered_point_t<Point>>(p, std::integral_constant<size_t, point_traits<Point>::ndim>{});
+}
+
+/*!
+ * @brief Creates a linestring view over a contiguous array of registered points, without a copy
+ *
+ * The points must be stored as the coordinates of a basic point, e.g. a struct with the x
+ * and y members in this order, or the coordinates could not be borrowed.
+ *
+ * @param points the points, they must outlive the view
+ * @param size the number of points
+ * @return the linestring view
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+basic_linestring_view<registered_point_t<Point>> make_linestring_view(const Point* points, size_t size)
+{
+    static_assert(is_registered_point<Point>::value, "the point type is not registered");
+    return {detail::registered_coords(points), size * point_traits<Point>::ndim};
+}
+
+/*!
+ * @brief Creates a polygon view over a contiguous array of registered points, without a copy
+ *
+ * The points must be stored as the coordinates of a basic point, as for make_linestring_view.
+ * The offsets are in coordinates, as for the polygon view, the end of a ring of k points after
+ * an offset o is o + k * ndim.
+ *
+ * @param points the points, they must outlive the view
+ * @param num_points the number of points
+ * @param offsets the ends of the rings in the coordinates, they must outlive the view
+ * @param size the number of rings
+ * @return the polygon view
+ * @throw geometry_error if the offsets are decreasing or past the points, or a ring size is not a
+ * multiple of the number of dimensions
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+basic_polygon_view<registered_point_t<Point>> make_polygon_view(const Point* points, size_t num_points, const size_t* offsets,
+                                                                size_t size)
+{
+    static_assert(is_registered_point<Point>::value, "the point type is not registered");
+    return {detail::registered_coords(points), num_points * point_traits<Point>::ndim, offsets, size};
+}
+
+/*!
+ * @brief Creates a multipolygon view over a contiguous array of registered points, without a copy
+ *
+ * The points must be stored as the coordinates of a basic point, as for make_linestring_view.
+ * The ring offsets are in coordinates, as for the multipolygon view.
+ *
+ * @param points the points, they must outlive the view
+ * @param num_points the number of points
+ * @param ring_offsets the ends of the rings in the coordinates, they must outlive the view
+ * @param num_rings the number of rings
+ * @param polygon_offsets the ends of the polygons in the rings, they must outlive the view
+ * @param size the number of polygons
+ * @return the multipolygon view
+ * @throw geometry_error if the offsets are decreasing or past the rings or the points, or a ring size
+ * is not a multiple of the number of dimensions
+ *
+ * @since 0.0.1
+ */
+template <typename Point>
+basic_multipolygon_view<registered_point_t<Point>> make_multipolygon_view(const Point* points, size_t num_points,
+                                                                          const size_t* ring_offsets, size_t num_rings,
+                                                                          const size_t* polygon_offsets, size_t size)
+{
+    static_assert(is_registered_point<Point>::value, "the point type is not registered");
+    return {detail::registered_coords(points), num_points * point_traits<Point>::ndim, ring_offsets, num_rings, polygon_offsets,
+            size};
+}
+
+/*!
+ * @brief Creates a linestring from a sequence of registered points
+ *
+ * The points stored as the coordinates of a basic point are copied with a single memcpy
+ * from a contiguous sequence, the other points are converted one at a time.
+ *
+ * @param first the first point
+ * @param last the past-the-end point
+ * @return the linestring
+ *
+ * @since 0.0.1
+ */
+template <typename PointIterator>
+basic_linestring<registered_point_t<typename std::iterator_traits<PointIterator>::value_type>> make_linestring(PointIterator first,
+                                                                                                            PointIterator last)
+{
+    using point_type = typename std::iterator_traits<PointIterator>::value_type;
+    static_assert(is_registered_point<point_type>::value, "the point type is not registered");
+    basic_linestring<registered_point_t<point_type>> res;
+    detail::assign_points(res, first, last,
+                          std::integral_constant<bool, point_traits<point_type>::packed and
+                                                           utils::is_contiguous_iterator<PointIterator, point_type>::value>{});
+    return res;
+}
+
+}  // namespace shapes
+}  // namespace simo
+
+/*!
+ * @brief Registers a 2D point type with its coordinate type and the names of its x and y members
+ *
+ * Use it at global scope, e.g. SHAPES_REGISTER_POINT_2D(LatLng, double, lng, lat).
+ *
+ * @since 0.0.1
+ */
+#define SHAPES_REGISTER_POINT_2D(Type, CoordType, X, Y)                                                                \
+    namespace simo                                                                                                     \
+    {                                                                                                                  \
+    namespace shapes                                                                                                   \
+    {                                                                                                                  \
+    template <>                                                                                                        \
+    struct point_traits<Type>                                                                                          \
+    {                                                                                                                  \
+        using coord_type = CoordType;                                                                                  \
+        static constexpr size_t ndim = 2;                                                                              \
+        template <typename Dummy>                                                                                      \
+        using layout_type = typename detail::dependent_type<Type, Dummy>::type;                                        \
+        template <bool StandardLayout, typename Dummy = void>                                                          \
+        struct layout : std::false_type                                                                                \
+        {};                                                                                                            \
+        template <typename Dummy>                                                                                      \
+        struct layout<true, Dummy>                                                                                     \
+            : std::integral_constant<bool, offsetof(layout_type<Dummy>, X) == 0 and                                    \
+                                               offsetof(layout_type<Dummy>, Y) == sizeof(CoordType)>                   \
+        {};                                                                                                            \
+        static constexpr bool packed = std::is_same<decltype(Type::X), CoordType>::value and                           \
+                                       std::is_same<decltype(Type::Y), CoordType>::value and                           \
+                                       utils::is_trivially_copyable<Type>::value and                                   \
+                                       sizeof(Type) == 2 * sizeof(CoordType) and                                       \
+                                       layout<std::is_standard_layout<Type>::value>::value;                            \
+        static coord_type x(const Type& p) noexcept                                                                    \
+        {                                                                                                              \
+            return p.X;                                                                                                \
+        }                                                                                                              \
+        static coord_type y(const Type& p) noexcept                                                                    \
+        {                                                                                                              \
+            return p.Y;                                                                                                \
+        }                                                                                                              \
+    };                                                                                                                 \
+    }                                                                                                                  \
+    }
+
+/*!
+ * @brief Registers a 3D point type with its coordinate type and the names of its x, y and z members
+ *
+ * Use it at global scope, e.g. SHAPES_REGISTER_POINT_3D(Vec3f, float, x, y, z).
+ *
+ * @since 0.0.1
+ */
+#define SHAPES_REGISTER_POINT_3D(Type, CoordType, X, Y, Z)                                                             \
+    namespace simo                                                                                                     \
+    {                                                                                                                  \
+    namespace shapes                                                                                                   \
+    {                                                                                                                  \
+    template <>                                                                                                        \
+    struct point_traits<Type>                                                                                          \
+    {                                                                                                                  \
+        using coord_type = CoordType;                                                                                  \
+        static constexpr size_t ndim = 3;                                                                              \
+        template <typename Dummy>                                                                                      \
+        using layout_type = typename detail::dependent_type<Type, Dummy>::type;                                        \
+        template <bool StandardLayout, typename Dummy = void>                                                          \
+        struct layout : std::false_type                                                                                \
+        {};                                                                                                            \
+        template <typename Dummy>                                                                                      \
+        struct layout<true, Dummy>                                                                                     \
+            : std::integral_constant<bool, offsetof(layout_type<Dummy>, X) == 0 and                                    \
+                                               offsetof(layout_type<Dummy>, Y) == sizeof(CoordType) and                \
+                                               offsetof(layout_type<Dummy>, Z) == 2 * sizeof(CoordType)>               \
+        {};                                                                                                            \
+        static constexpr bool packed = std::is_same<decltype(Type::X), CoordType>::value and                           \
+                                       std::is_same<decltype(Type::Y), CoordType>::value and                           \
+                                       std::is_same<decltype(Type::Z), CoordType>::value and                           \
+                                       utils::is_trivially_copyable<Type>::value and                                   \
+                                       sizeof(Type) == 3 * sizeof(CoordType) and                                       \
+                                       layout<std::is_standard_layout<Type>::value>::value;                            \
+        static coord_type x(const Type& p) noexcept                                                                    \
+        {                                                                                                              \
+            return p.X;                                                                                                \
+        }                                                                                                              \
+        static coord_type y(const Type& p) noexcept                                                                    \
+        {                                                                                                              \
+            return p.Y;                                                                                                \
+        }                                                                                                              \
+        static coord_type z(const Type& p) noexcept                                                                    \
+        {                                                                                                              \
+            return p.Z;                                                                                                \
+        }                                                                                                              \
+    };                                                                                                                 \
+    }                                                                                                                  \
+    }
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <ciso646>
+#include <simo/geom/detail/view.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+template <class T = double>
+using linestring_view_t = basic_linestring_view<basic_point<T>>;
+
+template <class T = double>
+using linestring_view_z_t = basic_linestring_view<basic_point_z<T>>;
+
+template <class T = double>
+using linestring_view_m_t = basic_linestring_view<basic_point_m<T>>;
+
+template <class T = double>
+using linestring_view_zm_t = basic_linestring_view<basic_point_zm<T>>;
+
+template <class T = double>
+using polygon_view_t = basic_polygon_view<basic_point<T>>;
+
+template <class T = double>
+using polygon_view_z_t = basic_polygon_view<basic_point_z<T>>;
+
+template <class T = double>
+using polygon_view_m_t = basic_polygon_view<basic_point_m<T>>;
+
+template <class T = double>
+using polygon_view_zm_t = basic_polygon_view<basic_point_zm<T>>;
+
+template <class T = double>
+using multipolygon_view_t = basic_multipolygon_view<basic_point<T>>;
+
+template <class T = double>
+using multipolygon_view_z_t = basic_multipolygon_view<basic_point_z<T>>;
+
+template <class T = double>
+using multipolygon_view_m_t = basic_multipolygon_view<basic_point_m<T>>;
+
+template <class T = double>
+using multipolygon_view_zm_t = basic_multipolygon_view<basic_point_zm<T>>;
+
+using linestring_view    = linestring_view_t<double>;
+using linestring_view_z  = linestring_view_z_t<double>;
+using linestring_view_m  = linestring_view_m_t<double>;
+using linestring_view_zm = linestring_view_zm_t<double>;
+
+using polygon_view    = polygon_view_t<double>;
+using polygon_view_z  = polygon_view_z_t<double>;
+using polygon_view_m  = polygon_view_m_t<double>;
+using polygon_view_zm = polygon_view_zm_t<double>;
+
+using multipolygon_view    = multipolygon_view_t<double>;
+using multipolygon_view_z  = multipolygon_view_z_t<double>;
+using multipolygon_view_m  = multipolygon_view_m_t<double>;
+using multipolygon_view_zm = multipolygon_view_zm_t<double>;
+
+using LineStringView   = linestring_view_t<double>;
+using LineStringViewZ  = linestring_view_z_t<double>;
+using LineStringViewM  = linestring_view_m_t<double>;
+using LineStringViewZM = linestring_view_zm_t<double>;
+
+using PolygonView   = polygon_view_t<double>;
+using PolygonViewZ  = polygon_view_z_t<double>;
+using PolygonViewM  = polygon_view_m_t<double>;
+using PolygonViewZM = polygon_view_zm_t<double>;
+
+using MultiPolygonView   = multipolygon_view_t<double>;
+using MultiPolygonViewZ  = multipolygon_view_z_t<double>;
+using MultiPolygonViewM  = multipolygon_view_m_t<double>;
+using MultiPolygonViewZM = multipolygon_view_zm_t<double>;
+
+}  // namespace shapes
+}  // namespace simo
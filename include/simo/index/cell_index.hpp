@@ -0,0 +1,291 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/quadkey.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief A hash index of bounds keyed by the quadkey cells of a single level
+ *
+ * Every item is listed in the cells its bounds overlap, the lists are stored back to back and
+ * the hash map points each occupied cell to its list, so a point query is a hash lookup and a
+ * scan of one list. For uniformly dense data, with a level giving a few items per cell, the
+ * queries are faster than walking a tree, while skewed data makes some lists long.
+ *
+ * An item overlapping more than MAX_CELLS_PER_ITEM cells is not listed in its cells, it goes to
+ * an overflow list that every query scans, so a few large bounds do not blow up the index. The
+ * index suits items about the size of a cell, the overflow list of many large items makes the
+ * queries linear.
+ *
+ * The bounds are in longitude and latitude.
+ *
+ * @ingroup index
+ *
+ * @since 0.0.1
+ */
+class cell_index
+{
+  public:
+    /*!
+     * @brief Creates an empty index
+     *
+     * @since 0.0.1
+     */
+    cell_index() = default;
+
+    /*!
+     * @brief Creates an index from the given bounds, the items are identified by their position
+     *
+     * @param first the first bounds
+     * @param last the past-the-end bounds
+     * @param level the level of the cells, from 0 to 30
+     * @throw geometry_error if the level is out of range
+     *
+     * @since 0.0.1
+     */
+    template <typename Iterator>
+    cell_index(Iterator first, Iterator last, uint32_t level)
+        : m_level(level), m_boxes(first, last)
+    {
+        detail::check_quadkey_level(level);
+        m_ranges.reserve(m_boxes.size());
+        std::vector<std::pair<uint64_t, size_t>> entries;
+        entries.reserve(m_boxes.size());
+        for (size_t i = 0; i < m_boxes.size(); ++i)
+        {
+            m_ranges.push_back(range_of(m_boxes[i]));
+            const auto& r = m_ranges.back();
+            if (r[0] > r[2])
+            {
+                continue;
+            }
+            if (uint64_t{r[2] - r[0] + 1} * uint64_t{r[3] - r[1] + 1} > MAX_CELLS_PER_ITEM)
+            {
+                m_overflow.push_back(i);
+                continue;
+            }
+            for (uint32_t y = r[1]; y <= r[3]; ++y)
+            {
+                for (uint32_t x = r[0]; x <= r[2]; ++x)
+                {
+                    entries.emplace_back(quadkey::id(quadkey::cell{m_level, x, y}), i);
+                }
+            }
+        }
+        std::sort(entries.begin(), entries.end());
+
+        m_items.reserve(entries.size());
+        m_cells.reserve(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (i == 0 or entries[i].first != entries[i - 1].first)
+            {
+                m_cells[entries[i].first] = {i, i};
+            }
+            m_cells[entries[i].first].second = i + 1;
+            m_items.push_back(entries[i].second);
+        }
+    }
+
+    /*!
+     * @return the number of items in the index
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_boxes.size();
+    }
+
+    /*!
+     * @return true if the index has no items, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool empty() const noexcept
+    {
+        return m_boxes.empty();
+    }
+
+    /*!
+     * @return the level of the cells
+     *
+     * @since 0.0.1
+     */
+    uint32_t level() const noexcept
+    {
+        return m_level;
+    }
+
+    /*!
+     * @return the number of cells holding some items
+     *
+     * @since 0.0.1
+     */
+    size_t num_cells() const noexcept
+    {
+        return m_cells.size();
+    }
+
+    /*!
+     * @brief Calls f(index) for every item whose bounds contain the given point
+     *
+     * @param x the longitude
+     * @param y the latitude
+     * @param f the function to call
+     *
+     * @since 0.0.1
+     */
+    template <typename F>
+    void query(double x, double y, F f) const
+    {
+        for (auto item : m_overflow)
+        {
+            if (m_boxes[item].contains(x, y))
+            {
+                f(item);
+            }
+        }
+        auto it = m_cells.find(quadkey::id(quadkey::from_point(x, y, m_level)));
+        if (it == m_cells.end())
+        {
+            return;
+        }
+        for (size_t i = it->second.first; i < it->second.second; ++i)
+        {
+            if (m_boxes[m_items[i]].contains(x, y))
+            {
+                f(m_items[i]);
+            }
+        }
+    }
+
+    /*!
+     * @brief Calls f(index) once for every item whose bounds intersect the given bounds
+     *
+     * @param b the query bounds
+     * @param f the function to call
+     *
+     * @since 0.0.1
+     */
+    template <typename F>
+    void query(const bounds_t& b, F f) const
+    {
+        auto r = range_of(b);
+        if (r[0] > r[2])
+        {
+            return;
+        }
+        for (auto item : m_overflow)
+        {
+            if (m_boxes[item].intersects(b))
+            {
+                f(item);
+            }
+        }
+        if (m_cells.empty())
+        {
+            return;
+        }
+        // an item spanning many cells is reported from the first cell it shares with the query
+        auto visit = [&](uint32_t x, uint32_t y, const std::pair<size_t, size_t>& list) {
+            for (size_t i = list.first; i < list.second; ++i)
+            {
+                auto item     = m_items[i];
+                const auto& s = m_ranges[item];
+                if (x == std::max(s[0], r[0]) and y == std::max(s[1], r[1]) and m_boxes[item].intersects(b))
+                {
+                    f(item);
+                }
+            }
+        };
+        auto num_cells = static_cast<double>(r[2] - r[0] + 1) * static_cast<double>(r[3] - r[1] + 1);
+        if (num_cells > static_cast<double>(m_cells.size()))
+        {
+            // fewer occupied cells than cells in the query
+            for (const auto& entry : m_cells)
+            {
+                auto c = quadkey::from_id(entry.first);
+                if (c.x >= r[0] and c.x <= r[2] and c.y >= r[1] and c.y <= r[3])
+                {
+                    visit(c.x, c.y, entry.second);
+                }
+            }
+            return;
+        }
+        for (uint32_t y = r[1]; y <= r[3]; ++y)
+        {
+            for (uint32_t x = r[0]; x <= r[2]; ++x)
+            {
+                auto it = m_cells.find(quadkey::id(quadkey::cell{m_level, x, y}));
+                if (it != m_cells.end())
+                {
+                    visit(x, y, it->second);
+                }
+            }
+        }
+    }
+
+    /*!
+     * @param b the query bounds
+     * @return the indices of the items whose bounds intersect the given bounds
+     *
+     * @since 0.0.1
+     */
+    std::vector<size_t> query(const bounds_t& b) const
+    {
+        std::vector<size_t> res;
+        query(b, [&res](size_t i) { res.push_back(i); });
+        return res;
+    }
+
+    /// the maximum number of cells listing an item, the larger items go to the overflow list
+    static const uint64_t MAX_CELLS_PER_ITEM = 64;
+
+  private:
+    /// @private the columns and rows (minx, miny, maxx, maxy) of the cells overlapping a bounds, inverted if empty
+    std::array<uint32_t, 4> range_of(const bounds_t& b) const noexcept
+    {
+        if (b.minx > b.maxx or b.miny > b.maxy)
+        {
+            return {{1, 1, 0, 0}};
+        }
+        auto top    = quadkey::from_point(b.minx, b.maxy, m_level);
+        auto bottom = quadkey::from_point(b.maxx, b.miny, m_level);
+        return {{top.x, top.y, bottom.x, bottom.y}};
+    }
+
+    /// the level of the cells
+    uint32_t m_level = 0;
+
+    /// the bounds of the items
+    std::vector<bounds_t> m_boxes;
+
+    /// the cell range of every item
+    std::vector<std::array<uint32_t, 4>> m_ranges;
+
+    /// the items of every cell, back to back
+    std::vector<size_t> m_items;
+
+    /// the first and past-the-end positions of the items of every occupied cell
+    std::unordered_map<uint64_t, std::pair<size_t, size_t>> m_cells;
+
+    /// the items overlapping too many cells, scanned by every query
+    std::vector<size_t> m_overflow;
+};
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <simo/geom/detail/bounds.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief A static R-tree packed with the Sort-Tile-Recursive (STR) algorithm
+ *
+ * The tree is built once from a sequence of bounds and stored in flat arrays,
+ * level by level, so queries do not chase pointers.
+ *
+ * @sa Leutenegger et al. "STR: A Simple and Efficient Algorithm for R-Tree Packing"
+ * @ingroup index
+ *
+ * @since 0.0.1
+ */
+class strtree
+{
+  public:
+    /*!
+     * @brief Creates an empty tree
+     *
+     * @since 0.0.1
+     */
+    strtree() = default;
+
+    /*!
+     * @brief Creates a tree from the given bounds, the items are identified by their position
+     *
+     * @param first the first bounds
+     * @param last the past-the-end bounds
+     * @param node_capacity the maximum number of children per node
+     *
+     * @since 0.0.1
+     */
+    template <typename Iterator>
+    strtree(Iterator first, Iterator last, size_t node_capacity = 16)
+        : m_node_capacity(std::max<size_t>(2, node_capacity))
+    {
+        m_size = static_cast<size_t>(std::distance(first, last));
+        if (m_size == 0)
+        {
+            return;
+        }
+
+        std::vector<bounds_t> items(first, last);
+        std::vector<size_t> order(m_size);
+        std::iota(order.begin(), order.end(), 0);
+        pack(items, order);
+
+        m_boxes.reserve(m_size * 2);
+        m_children.reserve(m_size * 2);
+        for (auto i : order)
+        {
+            m_boxes.push_back(items[i]);
+            m_children.push_back(i);
+        }
+        m_levels.push_back(0);
+
+        // builds the upper levels, each node covers up to node_capacity consecutive entries of the level below
+        size_t lo = 0;
+        size_t hi = m_boxes.size();
+        while (hi - lo > 1)
+        {
+            m_levels.push_back(hi);
+            for (size_t i = lo; i < hi; i += m_node_capacity)
+            {
+                bounds_t b{};
+                size_t end = std::min(hi, i + m_node_capacity);
+                for (size_t j = i; j < end; ++j)
+                {
+                    b.extend(m_boxes[j]);
+                }
+                m_boxes.push_back(b);
+                m_children.push_back(i);
+            }
+            lo = hi;
+            hi = m_boxes.size();
+        }
+    }
+
+    /*!
+     * @return the number of items in the tree
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /*!
+     * @return true if the tree has no items, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /*!
+     * @return the bounds of all the items in the tree
+     *
+     * @since 0.0.1
+     */
+    bounds_t bounds() const
+    {
+        return m_boxes.empty() ? bounds_t{} : m_boxes.back();
+    }
+
+    /*!
+     * @brief Calls f(index) for every item whose bounds intersect the given bounds
+     *
+     * @param b the query bounds
+     * @param f the function to call
+     *
+     * @since 0.0.1
+     */
+    template <typename F>
+    void query(const bounds_t& b, F f) const
+    {
+        if (m_size == 0)
+        {
+            return;
+        }
+        // (node position, level) pairs, the root is the last node
+        std::vector<std::pair<size_t, size_t>> stack;
+        stack.emplace_back(m_boxes.size() - 1, m_levels.size() - 1);
+        while (not stack.empty())
+        {
+            auto node = stack.back();
+            stack.pop_back();
+            if (not m_boxes[node.first].intersects(b))
+            {
+                continue;
+            }
+            if (node.second == 0)
+            {
+                f(m_children[node.first]);
+                continue;
+            }
+            size_t lo  = m_children[node.first];
+            size_t end = std::min(lo + m_node_capacity, m_levels[node.second]);
+            for (size_t i = lo; i < end; ++i)
+            {
+                stack.emplace_back(i, node.second - 1);
+            }
+        }
+    }
+
+    /*!
+     * @param b the query bounds
+     * @return the indices of the items whose bounds intersect the given bounds
+     *
+     * @since 0.0.1
+     */
+    std::vector<size_t> query(const bounds_t& b) const
+    {
+        std::vector<size_t> res;
+        query(b, [&res](size_t i) { res.push_back(i); });
+        return res;
+    }
+
+  private:
+    /// @private
+    void pack(const std::vector<bounds_t>& items, std::vector<size_t>& order) const
+    {
+        auto center_x = [&items](size_t i) { return items[i].minx + items[i].maxx; };
+        auto center_y = [&items](size_t i) { return items[i].miny + items[i].maxy; };
+
+        auto num_leaves = (m_size + m_node_capacity - 1) / m_node_capacity;
+        auto num_slices = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(num_leaves))));
+        auto slice_size = num_slices * m_node_capacity;
+
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return center_x(a) < center_x(b); });
+        for (size_t lo = 0; lo < m_size; lo += slice_size)
+        {
+            auto hi = std::min(m_size, lo + slice_size);
+            std::sort(order.begin() + lo, order.begin() + hi, [&](size_t a, size_t b) { return center_y(a) < center_y(b); });
+        }
+    }
+
+    /// the maximum number of children per node
+    size_t m_node_capacity = 16;
+
+    /// the number of items
+    size_t m_size = 0;
+
+    /// the node bounds, level by level starting from the leaves
+    std::vector<bounds_t> m_boxes;
+
+    /// the item index for leaves, the position of the first child otherwise
+    std::vector<size_t> m_children;
+
+    /// the position of the first node of each level
+    std::vector<size_t> m_levels;
+};
+
+}  // namespace shapes
+}  // namespace simo
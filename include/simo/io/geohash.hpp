@@ -0,0 +1,412 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <simo/exceptions.hpp>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/algorithm/detail/bits.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace geohash
+{
+
+/// the number of bits of a geohash character
+constexpr static const size_t CHAR_BITS = 5;
+
+/// the longest geohash, the 60 bits of its integer form fit in 64 bits
+constexpr static const size_t MAX_PRECISION = 12;
+
+/// the geohash alphabet
+constexpr static const char ALPHABET[] = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+}  // namespace geohash
+
+namespace detail
+{
+
+/// @private the value of a geohash character, -1 if invalid
+inline int32_t geohash_value(char ch) noexcept
+{
+    static const struct table
+    {
+        int8_t values[128];
+
+        table() noexcept
+        {
+            std::fill(values, values + 128, static_cast<int8_t>(-1));
+            for (int8_t i = 0; i < 32; ++i)
+            {
+                values[static_cast<size_t>(geohash::ALPHABET[i])] = i;
+            }
+        }
+    } lookup;
+    auto index = static_cast<unsigned char>(ch);
+    return index < 128 ? lookup.values[index] : -1;
+}
+
+/// @private
+inline void check_geohash_precision(size_t precision)
+{
+    if (precision == 0 or precision > geohash::MAX_PRECISION)
+    {
+        throw exceptions::geometry_error("invalid geohash precision: " + std::to_string(precision));
+    }
+}
+
+/// @private the integer geohash of a coordinate pair
+inline uint64_t geohash_encode(double lng, double lat, size_t bits) noexcept
+{
+    auto code = interleave_bits(quantize_bits(lng, -180, 360), quantize_bits(lat, -90, 180));
+    return code >> (64 - bits);
+}
+
+/// @private writes the characters of an integer geohash
+inline void geohash_chars(uint64_t code, size_t precision, char* out) noexcept
+{
+    for (size_t i = precision; i > 0; --i)
+    {
+        out[i - 1] = geohash::ALPHABET[code & 0x1f];
+        code >>= geohash::CHAR_BITS;
+    }
+}
+
+/// @private the number of longitude and latitude bits of a geohash
+inline std::pair<size_t, size_t> geohash_bits(size_t precision) noexcept
+{
+    size_t bits = precision * geohash::CHAR_BITS;
+    return {(bits + 1) / 2, bits / 2};
+}
+
+/// @private the integer geohash of a cell of the geohash grid
+inline uint64_t geohash_cell(uint32_t col, uint32_t row, size_t precision) noexcept
+{
+    auto bits = geohash_bits(precision);
+    auto code = interleave_bits(col << (32 - bits.first), row << (32 - bits.second));
+    return code >> (64 - precision * geohash::CHAR_BITS);
+}
+
+/// @private adds the columns of the geohash cells touched by the part of a segment in a band of latitudes
+inline void geohash_band_span(double x1, double y1, double x2, double y2, double miny, double maxy,
+                              std::vector<std::pair<double, double>>& spans)
+{
+    if (std::max(y1, y2) < miny or std::min(y1, y2) > maxy)
+    {
+        return;
+    }
+    double lo = std::min(x1, x2);
+    double hi = std::max(x1, x2);
+    if (y1 != y2)
+    {
+        // the x of the segment where it enters and leaves the band
+        double a = x1 + (x2 - x1) * (std::max(miny, std::min(y1, y2)) - y1) / (y2 - y1);
+        double b = x1 + (x2 - x1) * (std::min(maxy, std::max(y1, y2)) - y1) / (y2 - y1);
+        lo       = std::max(lo, std::min(a, b));
+        hi       = std::min(hi, std::max(a, b));
+    }
+    spans.emplace_back(lo, hi);
+}
+
+}  // namespace detail
+
+namespace geohash
+{
+
+/*!
+ * @brief Computes the integer geohash of a coordinate pair
+ *
+ * The longitude and latitude are quantized to 32 bits each, then their bits are interleaved with a
+ * single PDEP instruction when BMI2 is enabled at compile time, or with lookup tables otherwise.
+ * The coordinates out of range are clamped.
+ *
+ * @param lng the longitude
+ * @param lat the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @return the 5 * precision bits of the geohash, the first character in the highest bits
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+inline uint64_t encode_int(double lng, double lat, size_t precision = MAX_PRECISION)
+{
+    detail::check_geohash_precision(precision);
+    return detail::geohash_encode(lng, lat, precision * CHAR_BITS);
+}
+
+/*!
+ * @brief Computes the geohash of a coordinate pair
+ * @param lng the longitude
+ * @param lat the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @return the geohash
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+inline std::string encode(double lng, double lat, size_t precision = MAX_PRECISION)
+{
+    auto code = encode_int(lng, lat, precision);
+    std::string res(precision, '0');
+    detail::geohash_chars(code, precision, &res[0]);
+    return res;
+}
+
+/*!
+ * @brief Computes the geohash of a point, x is the longitude and y the latitude
+ * @param point the point
+ * @param precision the number of characters, from 1 to 12
+ * @return the geohash
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename Point, typename = typename std::enable_if<std::is_class<Point>::value>::type>
+std::string encode(const Point& point, size_t precision = MAX_PRECISION)
+{
+    return encode(static_cast<double>(point.x), static_cast<double>(point.y), precision);
+}
+
+/*!
+ * @brief Computes the integer geohashes of many points
+ * @param points the points, x is the longitude and y the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @param res the geohashes, in the order of the points, its content is replaced
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void encode(const basic_multipoint<T>& points, size_t precision, std::vector<uint64_t>& res)
+{
+    detail::check_geohash_precision(precision);
+    size_t bits = precision * CHAR_BITS;
+    res.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        res[i] = detail::geohash_encode(static_cast<double>(points[i].x), static_cast<double>(points[i].y), bits);
+    }
+}
+
+/*!
+ * @brief Computes the geohashes of many points
+ * @param points the points, x is the longitude and y the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @param res the geohashes, in the order of the points, its content is replaced
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void encode(const basic_multipoint<T>& points, size_t precision, std::vector<std::string>& res)
+{
+    detail::check_geohash_precision(precision);
+    size_t bits = precision * CHAR_BITS;
+    res.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        auto code = detail::geohash_encode(static_cast<double>(points[i].x), static_cast<double>(points[i].y), bits);
+        // the strings keep their buffers when res is reused
+        res[i].resize(precision);
+        detail::geohash_chars(code, precision, &res[i][0]);
+    }
+}
+
+/*!
+ * @brief Converts an integer geohash to its characters
+ * @param code the integer geohash
+ * @param precision the number of characters, from 1 to 12
+ * @return the geohash
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+inline std::string to_string(uint64_t code, size_t precision)
+{
+    detail::check_geohash_precision(precision);
+    std::string res(precision, '0');
+    detail::geohash_chars(code, precision, &res[0]);
+    return res;
+}
+
+/*!
+ * @brief Converts a geohash to its integer form
+ * @param hash the geohash
+ * @return the integer geohash
+ * @throw parse_error if the geohash is empty, too long or has an invalid character
+ *
+ * @since 0.0.1
+ */
+inline uint64_t to_int(const std::string& hash)
+{
+    if (hash.empty() or hash.size() > MAX_PRECISION)
+    {
+        throw exceptions::parse_error("invalid geohash length: " + std::to_string(hash.size()));
+    }
+    uint64_t res = 0;
+    for (auto ch : hash)
+    {
+        auto value = detail::geohash_value(ch);
+        if (value < 0)
+        {
+            throw exceptions::parse_error("invalid geohash character: " + std::string(1, ch));
+        }
+        res = res << CHAR_BITS | static_cast<uint64_t>(value);
+    }
+    return res;
+}
+
+/*!
+ * @brief Computes the cell of an integer geohash
+ *
+ * The bits are split back into the longitude and latitude with a single PEXT instruction each
+ * when BMI2 is enabled at compile time, or with lookup tables otherwise.
+ *
+ * @param code the integer geohash
+ * @param precision the number of characters, from 1 to 12
+ * @return the bounds of the cell, in longitude and latitude
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+inline bounds_t decode_int(uint64_t code, size_t precision)
+{
+    detail::check_geohash_precision(precision);
+    auto bits      = detail::geohash_bits(precision);
+    uint64_t full  = code << (64 - precision * CHAR_BITS);
+    double lng     = detail::compact_bits(full >> 1) * (360.0 / 4294967296.0) - 180;
+    double lat     = detail::compact_bits(full) * (180.0 / 4294967296.0) - 90;
+    double width   = std::ldexp(360.0, -static_cast<int>(bits.first));
+    double height  = std::ldexp(180.0, -static_cast<int>(bits.second));
+    return {lng, lat, lng + width, lat + height};
+}
+
+/*!
+ * @brief Computes the cell of a geohash
+ * @param hash the geohash
+ * @return the bounds of the cell, in longitude and latitude
+ * @throw parse_error if the geohash is empty, too long or has an invalid character
+ *
+ * @since 0.0.1
+ */
+inline bounds_t decode(const std::string& hash)
+{
+    return decode_int(to_int(hash), hash.size());
+}
+
+/*!
+ * @brief Computes the integer geohashes of the cells covering a polygon
+ *
+ * The cells are scanned one row of latitudes at a time, a cell is part of the cover if an edge of
+ * the polygon crosses it or if it overlaps the interior of the polygon on the middle latitude of
+ * its row. The cells in holes are left out, the cells touching the boundary are kept.
+ *
+ * @param polygon the polygon, x is the longitude and y the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @param res the sorted integer geohashes, its content is replaced
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+void cover(const basic_polygon<T>& polygon, size_t precision, std::vector<uint64_t>& res)
+{
+    detail::check_geohash_precision(precision);
+    res.clear();
+    auto b = polygon.bounds();
+    if (b.minx > b.maxx)
+    {
+        return;
+    }
+
+    auto bits          = detail::geohash_bits(precision);
+    double cols        = std::ldexp(1.0, static_cast<int>(bits.first));
+    double rows        = std::ldexp(1.0, static_cast<int>(bits.second));
+    double cell_width  = 360.0 / cols;
+    double cell_height = 180.0 / rows;
+    auto index         = [](double value, double min, double size, double count) {
+        return static_cast<uint32_t>(std::min(count - 1, std::max(0.0, std::floor((value - min) / size))));
+    };
+
+    uint32_t first_row = index(b.miny, -90, cell_height, rows);
+    uint32_t last_row  = index(b.maxy, -90, cell_height, rows);
+    std::vector<std::pair<double, double>> spans;
+    std::vector<double> crossings;
+    for (uint32_t row = first_row; row <= last_row; ++row)
+    {
+        double miny = -90 + row * cell_height;
+        double maxy = miny + cell_height;
+        double midy = miny + cell_height / 2;
+        spans.clear();
+        crossings.clear();
+        for (const auto& ring : polygon)
+        {
+            for (size_t i = 1; i < ring.size(); ++i)
+            {
+                auto x1 = static_cast<double>(ring[i - 1].x);
+                auto y1 = static_cast<double>(ring[i - 1].y);
+                auto x2 = static_cast<double>(ring[i].x);
+                auto y2 = static_cast<double>(ring[i].y);
+                detail::geohash_band_span(x1, y1, x2, y2, miny, maxy, spans);
+                if ((y1 > midy) != (y2 > midy))
+                {
+                    crossings.push_back(x1 + (midy - y1) * (x2 - x1) / (y2 - y1));
+                }
+            }
+        }
+        std::sort(crossings.begin(), crossings.end());
+        for (size_t i = 1; i < crossings.size(); i += 2)
+        {
+            spans.emplace_back(crossings[i - 1], crossings[i]);
+        }
+
+        // merges the spans in columns, the cells of a row are visited once
+        std::sort(spans.begin(), spans.end());
+        int64_t last_col = -1;
+        for (const auto& span : spans)
+        {
+            auto lo = std::max<int64_t>(index(span.first, -180, cell_width, cols), last_col + 1);
+            auto hi = static_cast<int64_t>(index(span.second, -180, cell_width, cols));
+            for (auto col = lo; col <= hi; ++col)
+            {
+                res.push_back(detail::geohash_cell(static_cast<uint32_t>(col), row, precision));
+            }
+            last_col = std::max(last_col, hi);
+        }
+    }
+    std::sort(res.begin(), res.end());
+}
+
+/*!
+ * @brief Computes the geohashes of the cells covering a polygon
+ * @param polygon the polygon, x is the longitude and y the latitude
+ * @param precision the number of characters, from 1 to 12
+ * @return the sorted geohashes
+ * @throw geometry_error if the precision is out of range
+ *
+ * @since 0.0.1
+ */
+template <typename T>
+std::vector<std::string> cover(const basic_polygon<T>& polygon, size_t precision)
+{
+    std::vector<uint64_t> codes;
+    cover(polygon, precision, codes);
+    std::vector<std::string> res;
+    res.reserve(codes.size());
+    for (auto code : codes)
+    {
+        res.push_back(to_string(code, precision));
+    }
+    return res;
+}
+
+}  // namespace geohash
+}  // namespace shapes
+}  // namespace simo
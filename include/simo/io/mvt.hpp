@@ -0,0 +1,1566 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <simo/exceptions.hpp>
+#include <simo/geom/detail/bounds.hpp>
+#include <simo/geom/detail/traits.hpp>
+#include <simo/io/polyline.hpp>
+
+namespace simo
+{
+namespace shapes
+{
+namespace mvt
+{
+
+/// the version of the vector tile specification written
+constexpr static const uint32_t VERSION = 2;
+
+/// the default number of tile units along a side
+constexpr static const uint32_t DEFAULT_EXTENT = 4096;
+
+/*!
+ * @brief Vector tile geometry types
+ *
+ * @since 0.0.1
+ */
+enum class geom_type : uint8_t
+{
+    UNKNOWN    = 0,
+    POINT      = 1,
+    LINESTRING = 2,
+    POLYGON    = 3
+};
+
+/*!
+ * @brief Vector tile value types, numbered as the fields of the Value message
+ *
+ * @since 0.0.1
+ */
+enum class value_type : uint8_t
+{
+    STRING = 1,
+    FLOAT  = 2,
+    DOUBLE = 3,
+    INT    = 4,
+    UINT   = 5,
+    SINT   = 6,
+    BOOL   = 7
+};
+
+/*!
+ * @brief A feature property value
+ *
+ * @since 0.0.1
+ */
+struct value
+{
+    /// the type of the value
+    value_type type;
+
+    /// the string value
+    std::string string_value;
+
+    union
+    {
+        /// the float value
+        float float_value;
+
+        /// the double value
+        double double_value;
+
+        /// the int and sint values
+        int64_t int_value;
+
+        /// the uint value
+        uint64_t uint_value;
+
+        /// the bool value
+        bool bool_value;
+    };
+
+    /*!
+     * @brief Creates a string value
+     * @param str the string
+     *
+     * @since 0.0.1
+     */
+    value(std::string str)
+        : type(value_type::STRING), string_value(std::move(str)), uint_value(0)
+    {}
+
+    /*!
+     * @brief Creates a string value
+     * @param str the null terminated string
+     *
+     * @since 0.0.1
+     */
+    value(const char* str)
+        : value(std::string(str))
+    {}
+
+    /*!
+     * @brief Creates a float value
+     * @param number the number
+     *
+     * @since 0.0.1
+     */
+    value(float number)
+        : type(value_type::FLOAT), uint_value(0)
+    {
+        float_value = number;
+    }
+
+    /*!
+     * @brief Creates a double value
+     * @param number the number
+     *
+     * @since 0.0.1
+     */
+    value(double number)
+        : type(value_type::DOUBLE), double_value(number)
+    {}
+
+    /*!
+     * @brief Creates a bool value
+     * @param flag the flag
+     *
+     * @since 0.0.1
+     */
+    value(bool flag)
+        : type(value_type::BOOL), uint_value(0)
+    {
+        bool_value = flag;
+    }
+
+    /*!
+     * @brief Creates an integer value, signed integers are zigzag encoded (sint)
+     * @param number the number
+     *
+     * @since 0.0.1
+     */
+    template <typename T,
+              typename std::enable_if<std::is_integral<T>::value and not std::is_same<T, bool>::value, int>::type = 0>
+    value(T number)
+        : type(std::is_signed<T>::value ? value_type::SINT : value_type::UINT)
+    {
+        if (std::is_signed<T>::value)
+        {
+            int_value = static_cast<int64_t>(number);
+        }
+        else
+        {
+            uint_value = static_cast<uint64_t>(number);
+        }
+    }
+
+    friend bool operator==(const value& lhs, const value& rhs)
+    {
+        if (lhs.type != rhs.type)
+        {
+            return false;
+        }
+        switch (lhs.type)
+        {
+            case value_type::STRING:
+                return lhs.string_value == rhs.string_value;
+            case value_type::FLOAT:
+                return lhs.float_value == rhs.float_value;
+            case value_type::DOUBLE:
+                return lhs.double_value == rhs.double_value;
+            case value_type::BOOL:
+                return lhs.bool_value == rhs.bool_value;
+            default:
+                return lhs.uint_value == rhs.uint_value;
+        }
+    }
+
+    friend bool operator!=(const value& lhs, const value& rhs)
+    {
+        return not(lhs == rhs);
+    }
+};
+
+/// the properties of a feature, as (key, value) pairs
+using properties = std::vector<std::pair<std::string, value>>;
+
+namespace detail
+{
+
+/// the protobuf wire types
+constexpr static const uint32_t WIRE_VARINT  = 0;
+constexpr static const uint32_t WIRE_FIXED64 = 1;
+constexpr static const uint32_t WIRE_BYTES   = 2;
+constexpr static const uint32_t WIRE_FIXED32 = 5;
+
+/// the geometry commands
+constexpr static const uint32_t MOVE_TO    = 1;
+constexpr static const uint32_t LINE_TO    = 2;
+constexpr static const uint32_t CLOSE_PATH = 7;
+
+/// @private the number of bytes of a varint
+inline size_t varint_size(uint64_t number) noexcept
+{
+    size_t res = 1;
+    while (number >= 0x80)
+    {
+        number >>= 7;
+        ++res;
+    }
+    return res;
+}
+
+/// @private
+inline void write_varint(std::string& out, uint64_t number)
+{
+    while (number >= 0x80)
+    {
+        out += static_cast<char>((number & 0x7f) | 0x80);
+        number >>= 7;
+    }
+    out += static_cast<char>(number);
+}
+
+/// @private
+inline void write_key(std::string& out, uint32_t field, uint32_t wire_type)
+{
+    write_varint(out, (field << 3) | wire_type);
+}
+
+/// @private writes the bytes of an integer in little endian order
+inline void write_fixed(std::string& out, uint64_t bits, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out += static_cast<char>((bits >> (8 * i)) & 0xff);
+    }
+}
+
+/// @private
+inline void write_bytes(std::string& out, uint32_t field, const std::string& bytes)
+{
+    write_key(out, field, WIRE_BYTES);
+    write_varint(out, bytes.size());
+    out += bytes;
+}
+
+/// @private the payload size of a packed repeated uint32 field
+inline size_t packed_size(const std::vector<uint32_t>& numbers) noexcept
+{
+    size_t res = 0;
+    for (auto number : numbers)
+    {
+        res += varint_size(number);
+    }
+    return res;
+}
+
+/// @private
+inline void write_packed(std::string& out, uint32_t field, const std::vector<uint32_t>& numbers, size_t size)
+{
+    write_key(out, field, WIRE_BYTES);
+    write_varint(out, size);
+    for (auto number : numbers)
+    {
+        write_varint(out, number);
+    }
+}
+
+/// @private the Value message
+inline void write_value(std::string& out, const value& val)
+{
+    auto field = static_cast<uint32_t>(val.type);
+    switch (val.type)
+    {
+        case value_type::STRING:
+            write_bytes(out, field, val.string_value);
+            break;
+        case value_type::FLOAT:
+        {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &val.float_value, sizeof(bits));
+            write_key(out, field, WIRE_FIXED32);
+            write_fixed(out, bits, sizeof(bits));
+            break;
+        }
+        case value_type::DOUBLE:
+        {
+            uint64_t bits = 0;
+            std::memcpy(&bits, &val.double_value, sizeof(bits));
+            write_key(out, field, WIRE_FIXED64);
+            write_fixed(out, bits, sizeof(bits));
+            break;
+        }
+        case value_type::SINT:
+            write_key(out, field, WIRE_VARINT);
+            write_varint(out, (static_cast<uint64_t>(val.int_value) << 1) ^ static_cast<uint64_t>(val.int_value >> 63));
+            break;
+        case value_type::BOOL:
+            write_key(out, field, WIRE_VARINT);
+            write_varint(out, val.bool_value ? 1 : 0);
+            break;
+        default:
+            write_key(out, field, WIRE_VARINT);
+            write_varint(out, val.uint_value);
+            break;
+    }
+}
+
+/// a point in tile coordinates
+struct tile_point
+{
+    /// the x-coordinate, growing to the right
+    int32_t x;
+
+    /// the y-coordinate, growing downwards
+    int32_t y;
+};
+
+/// @private
+inline uint32_t command(uint32_t id, size_t count) noexcept
+{
+    return (id & 0x7) | (static_cast<uint32_t>(count) << 3);
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Encodes the features of a vector tile layer
+ *
+ * The geometries are scaled from the tile bounds to integer tile coordinates, whose y axis points
+ * down, and written as MoveTo / LineTo / ClosePath command streams with zigzag encoded deltas.
+ * The keys and values of the properties are deduplicated across the features of the layer.
+ *
+ * The geometries are expected to be clipped to the tile, with clip(), beforehand.
+ *
+ * @since 0.0.1
+ */
+class layer_encoder
+{
+  public:
+    /*!
+     * @brief Creates a layer encoder
+     * @param name the layer name
+     * @param bounds the tile bounds, in the coordinates of the geometries
+     * @param extent the number of tile units along a side
+     *
+     * @since 0.0.1
+     */
+    layer_encoder(std::string name, const bounds_t& bounds, uint32_t extent = DEFAULT_EXTENT)
+        : m_name(std::move(name)),
+          m_bounds(bounds),
+          m_extent(extent),
+          m_scale_x(extent / (bounds.maxx - bounds.minx)),
+          m_scale_y(extent / (bounds.maxy - bounds.miny))
+    {}
+
+    /*!
+     * @brief Adds a feature to the layer
+     * @param geom the point, linestring, polygon or multi geometry
+     * @param props the feature properties
+     * @return whether the feature was added, a geometry collapsing in tile coordinates is skipped
+     *
+     * @since 0.0.1
+     */
+    template <typename Geometry>
+    bool add_feature(const Geometry& geom, const properties& props = {})
+    {
+        return add(geom, props, false, 0);
+    }
+
+    /*!
+     * @brief Adds a feature with an identifier to the layer
+     * @param geom the point, linestring, polygon or multi geometry
+     * @param props the feature properties
+     * @param id the feature identifier
+     * @return whether the feature was added, a geometry collapsing in tile coordinates is skipped
+     *
+     * @since 0.0.1
+     */
+    template <typename Geometry>
+    bool add_feature(const Geometry& geom, const properties& props, uint64_t id)
+    {
+        return add(geom, props, true, id);
+    }
+
+    /*!
+     * @return the number of features added
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /*!
+     * @brief Serializes the layer as a field of the Tile message
+     *
+     * The serialized layers of a tile can be concatenated.
+     *
+     * @return the protobuf encoded layer
+     *
+     * @since 0.0.1
+     */
+    std::string serialize() const
+    {
+        std::string layer;
+        detail::write_key(layer, 15, detail::WIRE_VARINT);
+        detail::write_varint(layer, VERSION);
+        detail::write_bytes(layer, 1, m_name);
+        layer += m_features;
+        layer += m_keys;
+        layer += m_values;
+        detail::write_key(layer, 5, detail::WIRE_VARINT);
+        detail::write_varint(layer, m_extent);
+
+        std::string res;
+        detail::write_bytes(res, 3, layer);
+        return res;
+    }
+
+  private:
+    /// the layer name
+    std::string m_name;
+
+    /// the tile bounds
+    bounds_t m_bounds;
+
+    /// the number of tile units along a side
+    uint32_t m_extent;
+
+    /// the tile units per x unit
+    double m_scale_x;
+
+    /// the tile units per y unit
+    double m_scale_y;
+
+    /// the number of features
+    size_t m_size = 0;
+
+    /// the encoded features
+    std::string m_features;
+
+    /// the encoded keys
+    std::string m_keys;
+
+    /// the encoded values
+    std::string m_values;
+
+    /// the index of every key
+    std::unordered_map<std::string, uint32_t> m_key_index;
+
+    /// the index of every value, by its encoding
+    std::unordered_map<std::string, uint32_t> m_value_index;
+
+    /// the scratch for the value encodings
+    std::string m_value_bytes;
+
+    /// the tags of the current feature
+    std::vector<uint32_t> m_tags;
+
+    /// the commands of the current feature
+    std::vector<uint32_t> m_commands;
+
+    /// the current path in tile coordinates
+    std::vector<detail::tile_point> m_path;
+
+    /// the cursor of the command stream
+    detail::tile_point m_cursor = {0, 0};
+
+    template <typename Geometry>
+    bool add(const Geometry& geom, const properties& props, bool has_id, uint64_t id)
+    {
+        m_commands.clear();
+        m_cursor = {0, 0};
+        auto type = encode(geom, typename geometry_traits<Geometry>::tag());
+        if (m_commands.empty())
+        {
+            return false;
+        }
+
+        m_tags.clear();
+        for (const auto& prop : props)
+        {
+            m_tags.push_back(key_index(prop.first));
+            m_tags.push_back(value_index(prop.second));
+        }
+
+        size_t tags_size     = detail::packed_size(m_tags);
+        size_t commands_size = detail::packed_size(m_commands);
+        // the type and the geometry keys, the type
+        size_t size = 3 + detail::varint_size(commands_size) + commands_size;
+        if (has_id)
+        {
+            size += 1 + detail::varint_size(id);
+        }
+        if (not m_tags.empty())
+        {
+            size += 1 + detail::varint_size(tags_size) + tags_size;
+        }
+
+        detail::write_key(m_features, 2, detail::WIRE_BYTES);
+        detail::write_varint(m_features, size);
+        if (has_id)
+        {
+            detail::write_key(m_features, 1, detail::WIRE_VARINT);
+            detail::write_varint(m_features, id);
+        }
+        if (not m_tags.empty())
+        {
+            detail::write_packed(m_features, 2, m_tags, tags_size);
+        }
+        detail::write_key(m_features, 3, detail::WIRE_VARINT);
+        detail::write_varint(m_features, static_cast<uint32_t>(type));
+        detail::write_packed(m_features, 4, m_commands, commands_size);
+        ++m_size;
+        return true;
+    }
+
+    uint32_t key_index(const std::string& key)
+    {
+        auto it = m_key_index.find(key);
+        if (it != m_key_index.end())
+        {
+            return it->second;
+        }
+        auto index = static_cast<uint32_t>(m_key_index.size());
+        m_key_index.emplace(key, index);
+        detail::write_bytes(m_keys, 3, key);
+        return index;
+    }
+
+    uint32_t value_index(const value& val)
+    {
+        m_value_bytes.clear();
+        detail::write_value(m_value_bytes, val);
+        auto it = m_value_index.find(m_value_bytes);
+        if (it != m_value_index.end())
+        {
+            return it->second;
+        }
+        auto index = static_cast<uint32_t>(m_value_index.size());
+        m_value_index.emplace(m_value_bytes, index);
+        detail::write_bytes(m_values, 4, m_value_bytes);
+        return index;
+    }
+
+    template <typename Point>
+    detail::tile_point to_tile(const Point& p) const noexcept
+    {
+        return {static_cast<int32_t>(std::round((static_cast<double>(p.x) - m_bounds.minx) * m_scale_x)),
+                static_cast<int32_t>(std::round((m_bounds.maxy - static_cast<double>(p.y)) * m_scale_y))};
+    }
+
+    void write_point(const detail::tile_point& p)
+    {
+        m_commands.push_back(polyline::zigzag(p.x - m_cursor.x));
+        m_commands.push_back(polyline::zigzag(p.y - m_cursor.y));
+        m_cursor = p;
+    }
+
+    /// converts a path to tile coordinates, without repeated points
+    template <typename Path>
+    void load_path(const Path& path)
+    {
+        m_path.clear();
+        for (const auto& p : path)
+        {
+            auto q = to_tile(p);
+            if (m_path.empty() or q.x != m_path.back().x or q.y != m_path.back().y)
+            {
+                m_path.push_back(q);
+            }
+        }
+    }
+
+    void write_path(size_t n)
+    {
+        m_commands.push_back(detail::command(detail::MOVE_TO, 1));
+        write_point(m_path[0]);
+        m_commands.push_back(detail::command(detail::LINE_TO, n - 1));
+        for (size_t i = 1; i < n; ++i)
+        {
+            write_point(m_path[i]);
+        }
+    }
+
+    template <typename Point>
+    geom_type encode(const Point& point, point_tag)
+    {
+        m_commands.push_back(detail::command(detail::MOVE_TO, 1));
+        write_point(to_tile(point));
+        return geom_type::POINT;
+    }
+
+    template <typename MultiPoint>
+    geom_type encode(const MultiPoint& multipoint, multipoint_tag)
+    {
+        if (multipoint.empty())
+        {
+            return geom_type::POINT;
+        }
+        m_commands.push_back(detail::command(detail::MOVE_TO, multipoint.size()));
+        for (const auto& p : multipoint)
+        {
+            write_point(to_tile(p));
+        }
+        return geom_type::POINT;
+    }
+
+    template <typename LineString>
+    geom_type encode(const LineString& linestring, linestring_tag)
+    {
+        load_path(linestring);
+        if (m_path.size() > 1)
+        {
+            write_path(m_path.size());
+        }
+        return geom_type::LINESTRING;
+    }
+
+    template <typename MultiLineString>
+    geom_type encode(const MultiLineString& multilinestring, multilinestring_tag)
+    {
+        for (const auto& linestring : multilinestring)
+        {
+            encode(linestring, linestring_tag());
+        }
+        return geom_type::LINESTRING;
+    }
+
+    /// writes a ring with the winding of an exterior ring or a hole, returns whether it has an area
+    template <typename LinearRing>
+    bool write_ring(const LinearRing& ring, bool exterior)
+    {
+        load_path(ring);
+        if (m_path.size() > 1 and m_path.front().x == m_path.back().x and m_path.front().y == m_path.back().y)
+        {
+            m_path.pop_back();
+        }
+        if (m_path.size() < 3)
+        {
+            return false;
+        }
+        int64_t area = 0;
+        for (size_t i = 0, j = m_path.size() - 1; i < m_path.size(); j = i++)
+        {
+            area += static_cast<int64_t>(m_path[j].x) * m_path[i].y - static_cast<int64_t>(m_path[i].x) * m_path[j].y;
+        }
+        if (area == 0)
+        {
+            return false;
+        }
+        // the exterior rings have a positive area in tile coordinates, the holes a negative one
+        if ((area > 0) != exterior)
+        {
+            std::reverse(m_path.begin(), m_path.end());
+        }
+        write_path(m_path.size());
+        m_commands.push_back(detail::command(detail::CLOSE_PATH, 1));
+        return true;
+    }
+
+    template <typename Polygon>
+    geom_type encode(const Polygon& polygon, polygon_tag)
+    {
+        if (polygon.empty() or not write_ring(polygon[0], true))
+        {
+            return geom_type::POLYGON;
+        }
+        for (size_t i = 1; i < polygon.size(); ++i)
+        {
+            write_ring(polygon[i], false);
+        }
+        return geom_type::POLYGON;
+    }
+
+    template <typename MultiPolygon>
+    geom_type encode(const MultiPolygon& multipolygon, multipolygon_tag)
+    {
+        for (const auto& polygon : multipolygon)
+        {
+            encode(polygon, polygon_tag());
+        }
+        return geom_type::POLYGON;
+    }
+};
+
+namespace detail
+{
+
+/// a range of bytes of the tile
+struct byte_span
+{
+    /// the first byte
+    const char* data;
+
+    /// the number of bytes
+    size_t size;
+};
+
+/// reads the fields of a protobuf message in place
+class pbf_reader
+{
+  public:
+    pbf_reader(const char* data, size_t size)
+        : m_data(data), m_end(data + size)
+    {}
+
+    explicit pbf_reader(const byte_span& span)
+        : pbf_reader(span.data, span.size)
+    {}
+
+    /// reads the key of the next field, returns false at the end of the message
+    bool next()
+    {
+        if (m_data == m_end)
+        {
+            return false;
+        }
+        auto key    = varint();
+        m_field     = static_cast<uint32_t>(key >> 3);
+        m_wire_type = static_cast<uint32_t>(key & 0x7);
+        return true;
+    }
+
+    /// whether the message has more bytes
+    bool has_more() const noexcept
+    {
+        return m_data != m_end;
+    }
+
+    uint32_t field() const noexcept
+    {
+        return m_field;
+    }
+
+    uint32_t wire_type() const noexcept
+    {
+        return m_wire_type;
+    }
+
+    uint64_t varint()
+    {
+        uint64_t res = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            if (m_data == m_end)
+            {
+                throw exceptions::parse_error("truncated varint");
+            }
+            auto byte = static_cast<uint8_t>(*m_data++);
+            res |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (byte < 0x80)
+            {
+                return res;
+            }
+        }
+        throw exceptions::parse_error("varint too long");
+    }
+
+    byte_span bytes()
+    {
+        auto size = varint();
+        if (size > static_cast<uint64_t>(m_end - m_data))
+        {
+            throw exceptions::parse_error("truncated field");
+        }
+        byte_span res = {m_data, static_cast<size_t>(size)};
+        m_data += size;
+        return res;
+    }
+
+    /// reads a little endian fixed size integer
+    uint64_t fixed(size_t size)
+    {
+        if (size > static_cast<size_t>(m_end - m_data))
+        {
+            throw exceptions::parse_error("truncated field");
+        }
+        uint64_t res = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            res |= static_cast<uint64_t>(static_cast<uint8_t>(m_data[i])) << (8 * i);
+        }
+        m_data += size;
+        return res;
+    }
+
+    void skip()
+    {
+        switch (m_wire_type)
+        {
+            case WIRE_VARINT:
+                varint();
+                break;
+            case WIRE_FIXED64:
+                fixed(8);
+                break;
+            case WIRE_BYTES:
+                bytes();
+                break;
+            case WIRE_FIXED32:
+                fixed(4);
+                break;
+            default:
+                throw exceptions::parse_error("unknown wire type " + std::to_string(m_wire_type));
+        }
+    }
+
+  private:
+    /// the next byte
+    const char* m_data;
+
+    /// the end of the message
+    const char* m_end;
+
+    /// the field number of the current field
+    uint32_t m_field = 0;
+
+    /// the wire type of the current field
+    uint32_t m_wire_type = 0;
+};
+
+/// @private the Value message
+inline value read_value(const byte_span& span)
+{
+    pbf_reader reader(span);
+    while (reader.next())
+    {
+        switch (reader.field())
+        {
+            case 1:
+            {
+                auto bytes = reader.bytes();
+                return value(std::string(bytes.data, bytes.size));
+            }
+            case 2:
+            {
+                auto bits    = static_cast<uint32_t>(reader.fixed(4));
+                float number = 0;
+                std::memcpy(&number, &bits, sizeof(number));
+                return value(number);
+            }
+            case 3:
+            {
+                auto bits     = reader.fixed(8);
+                double number = 0;
+                std::memcpy(&number, &bits, sizeof(number));
+                return value(number);
+            }
+            case 4:
+            {
+                value res(static_cast<int64_t>(reader.varint()));
+                res.type = value_type::INT;
+                return res;
+            }
+            case 5:
+                return value(reader.varint());
+            case 6:
+            {
+                auto bits = reader.varint();
+                return value(static_cast<int64_t>(bits >> 1) ^ -static_cast<int64_t>(bits & 1));
+            }
+            case 7:
+                return value(reader.varint() != 0);
+            default:
+                reader.skip();
+        }
+    }
+    throw exceptions::parse_error("empty value");
+}
+
+/// maps tile coordinates to the coordinates of the decoded geometries
+struct tile_transform
+{
+    /// the x-coordinate of the tile origin
+    double origin_x;
+
+    /// the y-coordinate of the tile origin
+    double origin_y;
+
+    /// the x units per tile unit
+    double scale_x;
+
+    /// the y units per tile unit, negative if the y axis points up
+    double scale_y;
+
+    template <typename Point>
+    Point apply(const tile_point& p) const
+    {
+        using coord_type = typename Point::coord_type;
+
+        Point res;
+        res.x = static_cast<coord_type>(origin_x + p.x * scale_x);
+        res.y = static_cast<coord_type>(origin_y + p.y * scale_y);
+        return res;
+    }
+};
+
+/// @private the tile coordinates as they are
+inline tile_transform identity_transform() noexcept
+{
+    return {0, 0, 1, 1};
+}
+
+/// @private the tile coordinates scaled to the tile bounds
+inline tile_transform bounds_transform(const bounds_t& bounds, uint32_t extent) noexcept
+{
+    return {bounds.minx, bounds.maxy, (bounds.maxx - bounds.minx) / extent, -(bounds.maxy - bounds.miny) / extent};
+}
+
+/// decodes a geometry command stream as it is read
+class command_reader
+{
+  public:
+    explicit command_reader(const byte_span& span)
+        : m_reader(span)
+    {}
+
+    /// reads the next command, returns false at the end of the stream
+    bool next(uint32_t& id, uint32_t& count)
+    {
+        if (not m_reader.has_more())
+        {
+            return false;
+        }
+        auto command = static_cast<uint32_t>(m_reader.varint());
+        id           = command & 0x7;
+        count        = command >> 3;
+        if (id != MOVE_TO and id != LINE_TO and id != CLOSE_PATH)
+        {
+            throw exceptions::parse_error("unknown command " + std::to_string(id));
+        }
+        return true;
+    }
+
+    /// reads the parameters of the next point, throws if the cursor leaves the 32 bits coordinates
+    const tile_point& point()
+    {
+        m_cursor.x = advance(m_cursor.x);
+        m_cursor.y = advance(m_cursor.y);
+        return m_cursor;
+    }
+
+  private:
+    /// moves a cursor coordinate by the next parameter
+    int32_t advance(int32_t coord)
+    {
+        int64_t res = int64_t{coord} + polyline::unzigzag(static_cast<uint32_t>(m_reader.varint()));
+        if (res < std::numeric_limits<int32_t>::min() or res > std::numeric_limits<int32_t>::max())
+        {
+            throw exceptions::parse_error("cursor out of range " + std::to_string(res));
+        }
+        return static_cast<int32_t>(res);
+    }
+
+    /// the packed command integers
+    pbf_reader m_reader;
+
+    /// the current point
+    tile_point m_cursor = {0, 0};
+};
+
+}  // namespace detail
+
+class feature_reader;
+
+/*!
+ * @brief Reads a vector tile layer in place
+ *
+ * The layer only records where its keys, values and features are, the features are decoded on
+ * request. The tile bytes must outlive the reader.
+ *
+ * @since 0.0.1
+ */
+class layer_reader
+{
+  public:
+    /*!
+     * @brief Creates a layer reader
+     * @param data the Layer message
+     * @param size the message size
+     * @throw parse_error if the message is malformed
+     *
+     * @since 0.0.1
+     */
+    layer_reader(const char* data, size_t size)
+    {
+        detail::pbf_reader reader(data, size);
+        while (reader.next())
+        {
+            switch (reader.field())
+            {
+                case 1:
+                    m_name = reader.bytes();
+                    break;
+                case 2:
+                    m_features.push_back(reader.bytes());
+                    break;
+                case 3:
+                    m_keys.push_back(reader.bytes());
+                    break;
+                case 4:
+                    m_values.push_back(reader.bytes());
+                    break;
+                case 5:
+                    m_extent = static_cast<uint32_t>(reader.varint());
+                    break;
+                case 15:
+                    m_version = static_cast<uint32_t>(reader.varint());
+                    break;
+                default:
+                    reader.skip();
+            }
+        }
+        if (m_extent == 0)
+        {
+            throw exceptions::parse_error("layer extent is zero");
+        }
+    }
+
+    /*!
+     * @return the layer name
+     *
+     * @since 0.0.1
+     */
+    std::string name() const
+    {
+        return {m_name.data, m_name.size};
+    }
+
+    /*!
+     * @return the version of the vector tile specification
+     *
+     * @since 0.0.1
+     */
+    uint32_t version() const noexcept
+    {
+        return m_version;
+    }
+
+    /*!
+     * @return the number of tile units along a side
+     *
+     * @since 0.0.1
+     */
+    uint32_t extent() const noexcept
+    {
+        return m_extent;
+    }
+
+    /*!
+     * @return the number of features
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_features.size();
+    }
+
+    /*!
+     * @param pos the feature index
+     * @return the feature at the given index
+     * @throw parse_error if the feature is malformed
+     *
+     * @since 0.0.1
+     */
+    feature_reader operator[](size_t pos) const;
+
+    /*!
+     * @brief Computes the bounds of the layer without decoding the geometries
+     * @return the bounds of the features, in tile coordinates
+     *
+     * @since 0.0.1
+     */
+    bounds_t bounds() const;
+
+    /*!
+     * @brief Decodes a key
+     * @param index the key index
+     * @return the key
+     * @throw index_error if the index is out of range
+     *
+     * @since 0.0.1
+     */
+    std::string key(uint32_t index) const
+    {
+        if (index >= m_keys.size())
+        {
+            throw exceptions::index_error("invalid key index " + std::to_string(index));
+        }
+        return {m_keys[index].data, m_keys[index].size};
+    }
+
+    /*!
+     * @brief Decodes a value
+     * @param index the value index
+     * @return the value
+     * @throw index_error if the index is out of range
+     * @throw parse_error if the value is malformed
+     *
+     * @since 0.0.1
+     */
+    value get_value(uint32_t index) const
+    {
+        if (index >= m_values.size())
+        {
+            throw exceptions::index_error("invalid value index " + std::to_string(index));
+        }
+        return detail::read_value(m_values[index]);
+    }
+
+  private:
+    /// the layer name
+    detail::byte_span m_name = {nullptr, 0};
+
+    /// the specification version
+    uint32_t m_version = 1;
+
+    /// the number of tile units along a side
+    uint32_t m_extent = DEFAULT_EXTENT;
+
+    /// the encoded keys
+    std::vector<detail::byte_span> m_keys;
+
+    /// the encoded values
+    std::vector<detail::byte_span> m_values;
+
+    /// the encoded features
+    std::vector<detail::byte_span> m_features;
+};
+
+/*!
+ * @brief Reads a vector tile feature in place
+ *
+ * The command stream is decoded as the geometry is read, straight into the result.
+ *
+ * @since 0.0.1
+ */
+class feature_reader
+{
+  public:
+    /*!
+     * @brief Creates a feature reader
+     * @param layer the layer of the feature
+     * @param data the Feature message
+     * @param size the message size
+     * @throw parse_error if the message is malformed
+     *
+     * @since 0.0.1
+     */
+    feature_reader(const layer_reader& layer, const char* data, size_t size)
+        : m_layer(&layer)
+    {
+        detail::pbf_reader reader(data, size);
+        while (reader.next())
+        {
+            switch (reader.field())
+            {
+                case 1:
+                    m_id     = reader.varint();
+                    m_has_id = true;
+                    break;
+                case 2:
+                    m_tags = reader.bytes();
+                    break;
+                case 3:
+                    m_type = static_cast<geom_type>(reader.varint());
+                    break;
+                case 4:
+                    m_geometry = reader.bytes();
+                    break;
+                default:
+                    reader.skip();
+            }
+        }
+    }
+
+    /*!
+     * @return the geometry type
+     *
+     * @since 0.0.1
+     */
+    geom_type type() const noexcept
+    {
+        return m_type;
+    }
+
+    /*!
+     * @return whether the feature has an identifier
+     *
+     * @since 0.0.1
+     */
+    bool has_id() const noexcept
+    {
+        return m_has_id;
+    }
+
+    /*!
+     * @return the feature identifier, zero if missing
+     *
+     * @since 0.0.1
+     */
+    uint64_t id() const noexcept
+    {
+        return m_id;
+    }
+
+    /*!
+     * @brief Decodes the feature properties
+     * @return the (key, value) pairs
+     * @throw parse_error if the tags are malformed
+     *
+     * @since 0.0.1
+     */
+    mvt::properties properties() const
+    {
+        mvt::properties res;
+        detail::pbf_reader reader(m_tags);
+        while (reader.has_more())
+        {
+            auto key = static_cast<uint32_t>(reader.varint());
+            if (not reader.has_more())
+            {
+                throw exceptions::parse_error("odd number of tags");
+            }
+            auto val = static_cast<uint32_t>(reader.varint());
+            res.emplace_back(m_layer->key(key), m_layer->get_value(val));
+        }
+        return res;
+    }
+
+    /*!
+     * @brief Computes the bounds of the geometry, without storing its points
+     * @return the bounds in tile coordinates, empty bounds if the geometry is empty
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    bounds_t bounds() const
+    {
+        bounds_t res;
+        detail::command_reader reader(m_geometry);
+        uint32_t id    = 0;
+        uint32_t count = 0;
+        while (reader.next(id, count))
+        {
+            if (id == detail::CLOSE_PATH)
+            {
+                continue;
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const auto& p = reader.point();
+                res.minx      = std::min(res.minx, static_cast<double>(p.x));
+                res.miny      = std::min(res.miny, static_cast<double>(p.y));
+                res.maxx      = std::max(res.maxx, static_cast<double>(p.x));
+                res.maxy      = std::max(res.maxy, static_cast<double>(p.y));
+            }
+        }
+        return res;
+    }
+
+    /*!
+     * @brief Decodes a point geometry in tile coordinates
+     * @param res the points, cleared first
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void points(basic_multipoint<T>& res) const
+    {
+        decode_points(res, detail::identity_transform());
+    }
+
+    /*!
+     * @brief Decodes a point geometry scaled to the tile bounds
+     * @param res the points, cleared first
+     * @param tile the tile bounds
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void points(basic_multipoint<T>& res, const bounds_t& tile) const
+    {
+        decode_points(res, detail::bounds_transform(tile, m_layer->extent()));
+    }
+
+    /*!
+     * @brief Decodes a linestring geometry in tile coordinates
+     * @param res the linestrings, cleared first
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void linestrings(basic_multilinestring<T>& res) const
+    {
+        decode_linestrings(res, detail::identity_transform());
+    }
+
+    /*!
+     * @brief Decodes a linestring geometry scaled to the tile bounds
+     * @param res the linestrings, cleared first
+     * @param tile the tile bounds
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void linestrings(basic_multilinestring<T>& res, const bounds_t& tile) const
+    {
+        decode_linestrings(res, detail::bounds_transform(tile, m_layer->extent()));
+    }
+
+    /*!
+     * @brief Decodes a polygon geometry in tile coordinates
+     *
+     * A ring with a positive area in tile coordinates starts a polygon, the rings with a negative
+     * area are the holes of the last polygon. The rings without area are dropped.
+     *
+     * @param res the polygons, cleared first
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void polygons(basic_multipolygon<T>& res) const
+    {
+        decode_polygons(res, detail::identity_transform());
+    }
+
+    /*!
+     * @brief Decodes a polygon geometry scaled to the tile bounds
+     *
+     * The exterior rings are clockwise as the tile is drawn, the rings are reversed so that the
+     * exterior rings become counter-clockwise and the holes clockwise with the y axis pointing up.
+     *
+     * @param res the polygons, cleared first
+     * @param tile the tile bounds
+     * @throw parse_error if the geometry is malformed
+     *
+     * @since 0.0.1
+     */
+    template <typename T>
+    void polygons(basic_multipolygon<T>& res, const bounds_t& tile) const
+    {
+        decode_polygons(res, detail::bounds_transform(tile, m_layer->extent()));
+    }
+
+  private:
+    /// the layer of the feature
+    const layer_reader* m_layer;
+
+    /// whether the feature has an identifier
+    bool m_has_id = false;
+
+    /// the feature identifier
+    uint64_t m_id = 0;
+
+    /// the geometry type
+    geom_type m_type = geom_type::UNKNOWN;
+
+    /// the packed tags
+    detail::byte_span m_tags = {nullptr, 0};
+
+    /// the packed commands
+    detail::byte_span m_geometry = {nullptr, 0};
+
+    template <typename T>
+    void decode_points(basic_multipoint<T>& res, const detail::tile_transform& transform) const
+    {
+        res.clear();
+        detail::command_reader reader(m_geometry);
+        uint32_t id    = 0;
+        uint32_t count = 0;
+        while (reader.next(id, count))
+        {
+            if (id != detail::MOVE_TO)
+            {
+                throw exceptions::parse_error("points must only have MoveTo commands");
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                res.push_back(transform.apply<T>(reader.point()));
+            }
+        }
+    }
+
+    template <typename T>
+    void decode_linestrings(basic_multilinestring<T>& res, const detail::tile_transform& transform) const
+    {
+        using point_type = typename T::point_type;
+
+        res.clear();
+        detail::command_reader reader(m_geometry);
+        uint32_t id    = 0;
+        uint32_t count = 0;
+        while (reader.next(id, count))
+        {
+            if (id == detail::MOVE_TO)
+            {
+                if (count != 1)
+                {
+                    throw exceptions::parse_error("MoveTo of a linestring must have one point");
+                }
+                res.emplace_back();
+            }
+            else if (id != detail::LINE_TO or res.empty())
+            {
+                throw exceptions::parse_error("linestrings must only have MoveTo and LineTo commands");
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                res.back().push_back(transform.apply<point_type>(reader.point()));
+            }
+        }
+    }
+
+    template <typename T>
+    void decode_polygons(basic_multipolygon<T>& res, const detail::tile_transform& transform) const
+    {
+        using ring_type  = typename T::value_type;
+        using point_type = typename T::point_type;
+
+        res.clear();
+        detail::command_reader reader(m_geometry);
+        uint32_t id    = 0;
+        uint32_t count = 0;
+        ring_type ring;
+        // twice the area of the current ring in tile coordinates
+        int64_t area = 0;
+        detail::tile_point first{0, 0};
+        detail::tile_point prev{0, 0};
+        while (reader.next(id, count))
+        {
+            if (id == detail::MOVE_TO)
+            {
+                if (count != 1)
+                {
+                    throw exceptions::parse_error("MoveTo of a ring must have one point");
+                }
+                ring.clear();
+                area  = 0;
+                first = reader.point();
+                prev  = first;
+                ring.push_back(transform.apply<point_type>(first));
+                continue;
+            }
+            if (ring.empty())
+            {
+                throw exceptions::parse_error("ring must start with MoveTo");
+            }
+            if (id == detail::LINE_TO)
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const auto& p = reader.point();
+                    area += static_cast<int64_t>(prev.x) * p.y - static_cast<int64_t>(p.x) * prev.y;
+                    prev = p;
+                    ring.push_back(transform.apply<point_type>(p));
+                }
+                continue;
+            }
+            area += static_cast<int64_t>(prev.x) * first.y - static_cast<int64_t>(first.x) * prev.y;
+            ring.push_back(ring.front());
+            if (transform.scale_y < 0)
+            {
+                // keeps the winding when the y axis is flipped
+                std::reverse(ring.begin(), ring.end());
+            }
+            if (area > 0)
+            {
+                res.emplace_back();
+                res.back().push_back(std::move(ring));
+            }
+            else if (area < 0 and not res.empty())
+            {
+                res.back().push_back(std::move(ring));
+            }
+            ring = ring_type();
+        }
+    }
+};
+
+inline feature_reader layer_reader::operator[](size_t pos) const
+{
+    if (pos >= m_features.size())
+    {
+        throw exceptions::index_error("invalid feature index " + std::to_string(pos));
+    }
+    return {*this, m_features[pos].data, m_features[pos].size};
+}
+
+inline bounds_t layer_reader::bounds() const
+{
+    bounds_t res;
+    for (size_t i = 0; i < size(); ++i)
+    {
+        auto b   = (*this)[i].bounds();
+        res.minx = std::min(res.minx, b.minx);
+        res.miny = std::min(res.miny, b.miny);
+        res.maxx = std::max(res.maxx, b.maxx);
+        res.maxy = std::max(res.maxy, b.maxy);
+    }
+    return res;
+}
+
+/*!
+ * @brief Lists the layers of a vector tile
+ *
+ * @param data the Tile message
+ * @param size the message size
+ * @return the layer readers, pointing into the tile bytes
+ * @throw parse_error if the tile is malformed
+ *
+ * @since 0.0.1
+ */
+inline std::vector<layer_reader> read_layers(const char* data, size_t size)
+{
+    std::vector<layer_reader> res;
+    detail::pbf_reader reader(data, size);
+    while (reader.next())
+    {
+        if (reader.field() == 3 and reader.wire_type() == detail::WIRE_BYTES)
+        {
+            auto layer = reader.bytes();
+            res.emplace_back(layer.data, layer.size);
+            continue;
+        }
+        reader.skip();
+    }
+    return res;
+}
+
+/*!
+ * @brief Lists the layers of a vector tile
+ *
+ * @param tile the Tile message
+ * @return the layer readers, pointing into the tile bytes
+ * @throw parse_error if the tile is malformed
+ *
+ * @since 0.0.1
+ */
+inline std::vector<layer_reader> read_layers(const std::string& tile)
+{
+    return read_layers(tile.data(), tile.size());
+}
+
+}  // namespace mvt
+}  // namespace shapes
+}  // namespace simo
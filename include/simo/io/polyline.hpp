@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ciso646>
+#include <cstdint>
 #include <simo/exceptions.hpp>
 
 namespace simo
@@ -22,6 +23,30 @@ constexpr static const int32_t CHUNK_THRESHOLD = 0x20;
 /// the ascii offset to apply
 constexpr static const int32_t ASCII_OFFSET = 63;
 
+/*!
+ * @brief Maps a signed integer to an unsigned one, the small magnitudes get the small values
+ * @param value the signed integer
+ * @return the zigzag encoded integer, 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3...
+ *
+ * @since 0.0.1
+ */
+inline uint32_t zigzag(int32_t value) noexcept
+{
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+/*!
+ * @brief Reverts the zigzag encoding
+ * @param value the zigzag encoded integer
+ * @return the signed integer
+ *
+ * @since 0.0.1
+ */
+inline int32_t unzigzag(uint32_t value) noexcept
+{
+    return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+
 /*!
  * @brief Encode a polyline coordinate
  * @param coord the coordinate value
@@ -34,20 +59,15 @@ std::string encode(double coord, int32_t precision = 5)
 {
     assert(precision >= 0);
     double pow10 = std::pow(10, precision);
-    auto value   = static_cast<int32_t>(std::round(coord * pow10));
-    value <<= 1;
-    if (coord < 0)
-    {
-        value = ~value;
-    }
+    auto value   = zigzag(static_cast<int32_t>(std::round(coord * pow10)));
     std::string res;
-    while (value >= CHUNK_THRESHOLD)
+    while (value >= static_cast<uint32_t>(CHUNK_THRESHOLD))
     {
-        int32_t ch = ((value & CHUNK_MASK) | CHUNK_THRESHOLD) + ASCII_OFFSET;
+        auto ch = static_cast<int32_t>((value & CHUNK_MASK) | CHUNK_THRESHOLD) + ASCII_OFFSET;
         res += static_cast<char>(ch);
         value >>= CHUNK_SIZE;
     }
-    res += static_cast<char>(value + ASCII_OFFSET);
+    res += static_cast<char>(static_cast<int32_t>(value) + ASCII_OFFSET);
     return res;
 }
 
@@ -74,12 +94,7 @@ int32_t advance(const std::string& text, size_t& index)
             break;
         }
     }
-    if (res & 1)
-    {
-        res = ~res;
-    }
-    res >>= 1;
-    return res;
+    return unzigzag(static_cast<uint32_t>(res));
 }
 
 /*!
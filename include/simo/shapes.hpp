@@ -49,6 +49,29 @@ SOFTWARE.
 #include <simo/geom/polygon.hpp>
 #include <simo/geom/multipolygon.hpp>
 #include <simo/geom/linearring.hpp>
+#include <simo/geom/view.hpp>
+#include <simo/geom/register.hpp>
 #include <simo/io/polyline.hpp>
+#include <simo/io/mvt.hpp>
+#include <simo/io/geohash.hpp>
+#include <simo/thread_pool.hpp>
+#include <simo/geom/detail/traits.hpp>
+#include <simo/index/strtree.hpp>
+#include <simo/algorithm/predicates.hpp>
+#include <simo/algorithm/prepared_polygon.hpp>
+#include <simo/algorithm/points_in_polygon.hpp>
+#include <simo/algorithm/measures.hpp>
+#include <simo/algorithm/geodesic.hpp>
+#include <simo/algorithm/simplify.hpp>
+#include <simo/algorithm/simplify_coverage.hpp>
+#include <simo/algorithm/spatial_join.hpp>
+#include <simo/algorithm/spatial_sort.hpp>
+#include <simo/algorithm/quadkey.hpp>
+#include <simo/index/cell_index.hpp>
+#include <simo/algorithm/projection.hpp>
+#include <simo/algorithm/affine.hpp>
+#include <simo/algorithm/convex_hull.hpp>
+#include <simo/algorithm/clip.hpp>
+#include <simo/algorithm/tile_pyramid.hpp>
 
 #endif  // SIMO_SHAPES_HPP
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <ciso646>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simo
+{
+namespace shapes
+{
+
+/*!
+ * @brief A fixed size pool of worker threads consuming a shared task queue
+ *
+ * @since 0.0.1
+ */
+class thread_pool
+{
+  public:
+    /*!
+     * @brief Creates a thread pool
+     *
+     * @param num_threads the number of worker threads, zero means one per hardware thread
+     *
+     * @since 0.0.1
+     */
+    explicit thread_pool(size_t num_threads = 0)
+    {
+        if (num_threads == 0)
+        {
+            num_threads = default_concurrency();
+        }
+        m_workers.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            m_workers.emplace_back([this] { run(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// waits for the queued tasks and joins the worker threads
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /*!
+     * @brief Queues a task for execution
+     *
+     * @param f the task
+     * @return a future holding the task result or the exception raised by the task
+     *
+     * @since 0.0.1
+     */
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> submit(F&& f)
+    {
+        using result_type = typename std::result_of<F()>::type;
+        auto task         = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(f));
+        auto res          = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace([task] { (*task)(); });
+        }
+        m_cond.notify_one();
+        return res;
+    }
+
+    /*!
+     * @return the number of worker threads
+     *
+     * @since 0.0.1
+     */
+    size_t size() const noexcept
+    {
+        return m_workers.size();
+    }
+
+    /*!
+     * @return the number of hardware threads, or one if it cannot be determined
+     *
+     * @since 0.0.1
+     */
+    static size_t default_concurrency() noexcept
+    {
+        return std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /*!
+     * @return true if the calling thread is a worker thread of this pool, otherwise false
+     *
+     * @since 0.0.1
+     */
+    bool in_worker() const noexcept
+    {
+        return current() == this;
+    }
+
+  private:
+    /// @private the pool of the calling worker thread, nullptr outside of the pools
+    static const thread_pool*& current() noexcept
+    {
+        static thread_local const thread_pool* res = nullptr;
+        return res;
+    }
+
+    /// @private
+    void run()
+    {
+        current() = this;
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this] { return m_stop or not m_tasks.empty(); });
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+    /// the worker threads
+    std::vector<std::thread> m_workers;
+
+    /// the pending tasks
+    std::queue<std::function<void()>> m_tasks;
+
+    /// guards the task queue
+    std::mutex m_mutex;
+
+    /// signals new tasks or shutdown
+    std::condition_variable m_cond;
+
+    /// whether the pool is shutting down
+    bool m_stop = false;
+};
+
+/*!
+ * @brief Splits [first, last) in chunks of at most grain elements and runs f(lo, hi) for each chunk in the pool
+ *
+ * Called from a task running in the pool, the chunks run on the calling thread instead, since
+ * waiting for them there could block every worker of the pool.
+ *
+ * @param pool the thread pool
+ * @param first the first index
+ * @param last the past-the-end index
+ * @param grain the maximum chunk size
+ * @param f the function to call for each chunk
+ * @throw the first exception raised by f
+ *
+ * @since 0.0.1
+ */
+template <typename F>
+void parallel_for(thread_pool& pool, size_t first, size_t last, size_t grain, F f)
+{
+    grain = std::max<size_t>(1, grain);
+    if (pool.in_worker())
+    {
+        for (size_t lo = first; lo < last; lo += grain)
+        {
+            f(lo, std::min(last, lo + grain));
+        }
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve((last - first + grain - 1) / grain);
+    for (size_t lo = first; lo < last; lo += grain)
+    {
+        size_t hi = std::min(last, lo + grain);
+        futures.push_back(pool.submit([&f, lo, hi] { f(lo, hi); }));
+    }
+    for (auto& future : futures)
+    {
+        future.wait();
+    }
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+}
+
+}  // namespace shapes
+}  // namespace simo
@@ -0,0 +1,131 @@
+#include <ciso646>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Affine")
+{
+    SECTION("matrices")
+    {
+        affine_matrix identity;
+        CHECK(identity.a == 1);
+        CHECK(identity.e == 1);
+        CHECK(identity.i == 1);
+        CHECK(identity.xoff == 0);
+
+        // the multiples of 90 degrees are exact
+        auto r = affine_matrix::rotation(90);
+        CHECK(r.a == 0);
+        CHECK(r.b == -1);
+        CHECK(r.d == 1);
+        CHECK(affine_matrix::rotation(-180).a == -1);
+        CHECK(affine_matrix::rotation(450).d == 1);
+
+        // composition applies the right hand side first
+        auto m = affine_matrix::translation(10, 20) * affine_matrix::scaling(2, 3);
+        Point p(1, 1);
+        affine_transform(p, m);
+        CHECK(p == Point(12, 23));
+        p = Point(1, 1);
+        affine_transform(p, affine_matrix::scaling(2, 3) * affine_matrix::translation(10, 20));
+        CHECK(p == Point(22, 63));
+    }
+
+    SECTION("translate scale rotate")
+    {
+        LineString ls = {{0, 0}, {1, 0}, {1, 1}, {0, 1}, {0.5, 0.5}};
+        translate(ls, 1, 2);
+        CHECK(ls == LineString({{1, 2}, {2, 2}, {2, 3}, {1, 3}, {1.5, 2.5}}));
+        scale(ls, 2, -1);
+        CHECK(ls == LineString({{2, -2}, {4, -2}, {4, -3}, {2, -3}, {3, -2.5}}));
+        rotate(ls, 90, 2, -2);
+        CHECK(ls == LineString({{2, -2}, {2, 0}, {3, 0}, {3, -2}, {2.5, -1}}));
+
+        Point p(1, 0);
+        rotate(p, 30);
+        CHECK(p.x == Approx(std::sqrt(3.0) / 2));
+        CHECK(p.y == Approx(0.5));
+    }
+
+    SECTION("every part of every geometry")
+    {
+        // long runs go through the batches and the tail
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> coords(-100, 100);
+        MultiPolygon mp;
+        mp.resize(3);
+        for (auto& polygon : mp)
+        {
+            polygon.resize(2);
+            for (auto& ring : polygon)
+            {
+                for (size_t i = 0; i < 37; ++i)
+                {
+                    ring.push_back({coords(gen), coords(gen)});
+                }
+            }
+        }
+        auto original = mp;
+        affine_matrix m(0.5, -2, 3, 1.5, 7, -9);
+        affine_transform(mp, m);
+        for (size_t i = 0; i < mp.size(); ++i)
+        {
+            for (size_t j = 0; j < mp[i].size(); ++j)
+            {
+                for (size_t k = 0; k < mp[i][j].size(); ++k)
+                {
+                    const auto& o = original[i][j][k];
+                    CHECK(mp[i][j][k].x == Approx(0.5 * o.x - 2 * o.y + 7));
+                    CHECK(mp[i][j][k].y == Approx(3 * o.x + 1.5 * o.y - 9));
+                }
+            }
+        }
+
+        MultiLineString mls = {{{0, 0}, {1, 1}}, {}, {{2, 2}}};
+        translate(mls, -1, -1);
+        CHECK(mls == MultiLineString({{{-1, -1}, {0, 0}}, {}, {{1, 1}}}));
+
+        MultiPoint points = {{1, 2}, {3, 4}, {5, 6}};
+        scale(points, 10, 10);
+        CHECK(points == MultiPoint({{10, 20}, {30, 40}, {50, 60}}));
+
+        Polygon empty;
+        rotate(empty, 45);
+        CHECK(empty.empty());
+    }
+
+    SECTION("z and m")
+    {
+        LineStringZ lsz = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+        translate(lsz, 1, 1, 1);
+        CHECK(lsz == LineStringZ({{2, 3, 4}, {5, 6, 7}, {8, 9, 10}}));
+        scale(lsz, 1, 1, 2);
+        CHECK(lsz == LineStringZ({{2, 3, 8}, {5, 6, 14}, {8, 9, 20}}));
+        // a full 3D matrix, x' = z and z' = x
+        affine_transform(lsz, affine_matrix(0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0));
+        CHECK(lsz == LineStringZ({{8, 3, 2}, {14, 6, 5}, {20, 9, 8}}));
+
+        // the m-coordinates are not transformed, the z terms are ignored without z
+        LineStringM lsm = {{1, 2, 3}, {4, 5, 6}};
+        translate(lsm, 1, 1, 1);
+        CHECK(lsm == LineStringM({{2, 3, 3}, {5, 6, 6}}));
+        PointZM pzm(1, 2, 3, 4);
+        scale(pzm, 2, 2, 2);
+        CHECK(pzm == PointZM(2, 4, 6, 4));
+    }
+
+    SECTION("integer coordinates")
+    {
+        basic_linestring<basic_point<int32_t>> ls = {{1, 2}, {3, 4}, {5, 6}};
+        translate(ls, 10, 20);
+        CHECK(ls[2].x == 15);
+        CHECK(ls[2].y == 26);
+        rotate(ls, 180);
+        CHECK(ls[0].x == -11);
+        CHECK(ls[0].y == -22);
+    }
+}
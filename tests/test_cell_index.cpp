@@ -0,0 +1,97 @@
+#include <ciso646>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("CellIndex")
+{
+    SECTION("empty index")
+    {
+        cell_index index;
+        CHECK(index.empty());
+        CHECK(index.size() == 0);
+        CHECK(index.query(bounds_t{-10, -10, 10, 10}).empty());
+    }
+
+    SECTION("points and bounds")
+    {
+        std::vector<bounds_t> boxes = {{1, 1, 1, 1}, {-50, -20, 50, 20}, {2, 2, 3, 3}, {}, {100, 40, 101, 41}};
+        cell_index index(boxes.begin(), boxes.end(), 8);
+        CHECK(index.size() == 5);
+        CHECK(index.level() == 8);
+        CHECK(index.num_cells() > 2);
+
+        std::vector<size_t> found;
+        index.query(1, 1, [&](size_t i) { found.push_back(i); });
+        std::sort(found.begin(), found.end());
+        CHECK(found == std::vector<size_t>{0, 1});
+
+        auto res = index.query(bounds_t{0, 0, 2.5, 2.5});
+        std::sort(res.begin(), res.end());
+        CHECK(res == std::vector<size_t>{0, 1, 2});
+
+        // the whole world, through the occupied cells
+        res = index.query(bounds_t{-180, -85, 180, 85});
+        std::sort(res.begin(), res.end());
+        CHECK(res == std::vector<size_t>{0, 1, 2, 4});
+
+        CHECK(index.query(bounds_t{120, 60, 130, 70}).empty());
+        CHECK(index.query(bounds_t{}).empty());
+    }
+
+    SECTION("large bounds")
+    {
+        // the world at level 14 overlaps hundreds of millions of cells
+        std::vector<bounds_t> boxes = {{-180, -85, 180, 85}, {1, 1, 1.001, 1.001}, {-50, -20, 50, 20}};
+        cell_index index(boxes.begin(), boxes.end(), 14);
+        CHECK(index.num_cells() <= 4);
+
+        std::vector<size_t> found;
+        index.query(1.0005, 1.0005, [&](size_t i) { found.push_back(i); });
+        std::sort(found.begin(), found.end());
+        CHECK(found == std::vector<size_t>{0, 1, 2});
+
+        auto res = index.query(bounds_t{60, 30, 61, 31});
+        CHECK(res == std::vector<size_t>{0});
+        res = index.query(bounds_t{0, 0, 2, 2});
+        std::sort(res.begin(), res.end());
+        CHECK(res == std::vector<size_t>{0, 1, 2});
+    }
+
+    SECTION("same results as the tree")
+    {
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<double> coord(-10, 10);
+        std::vector<bounds_t> boxes;
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            double x = coord(gen);
+            double y = coord(gen);
+            boxes.push_back(bounds_t{x, y, x + 0.3, y + 0.2});
+        }
+        strtree tree(boxes.begin(), boxes.end());
+        cell_index index(boxes.begin(), boxes.end(), 10);
+        for (size_t i = 0; i < 200; ++i)
+        {
+            double x    = coord(gen);
+            double y    = coord(gen);
+            auto window = bounds_t{x, y, x + 0.5, y + 0.5};
+            auto a      = tree.query(window);
+            auto b      = index.query(window);
+            std::sort(a.begin(), a.end());
+            std::sort(b.begin(), b.end());
+            CHECK(a == b);
+
+            std::vector<size_t> c;
+            index.query(x, y, [&](size_t j) { c.push_back(j); });
+            auto d = tree.query(bounds_t{x, y, x, y});
+            std::sort(c.begin(), c.end());
+            std::sort(d.begin(), d.end());
+            CHECK(c == d);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#include <ciso646>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Clip")
+{
+    auto bounds = bounds_t{0, 0, 10, 10};
+
+    SECTION("multipoint")
+    {
+        auto mp = MultiPoint{{-1, 5}, {0, 0}, {5, 5}, {10, 11}, {10, 10}};
+        CHECK(clip(mp, bounds) == MultiPoint{{0, 0}, {5, 5}, {10, 10}});
+    }
+
+    SECTION("linestring")
+    {
+        // inside, crossing, outside
+        CHECK(clip(LineString{{1, 1}, {2, 2}, {3, 1}}, bounds) == MultiLineString{{{1, 1}, {2, 2}, {3, 1}}});
+        CHECK(clip(LineString{{-5, 5}, {15, 5}}, bounds) == MultiLineString{{{0, 5}, {10, 5}}});
+        CHECK(clip(LineString{{-5, -5}, {-5, 15}, {15, 15}}, bounds).empty());
+
+        // the line leaves and enters again
+        auto ls = LineString{{5, 5}, {15, 5}, {15, 8}, {5, 8}, {5, 12}};
+        CHECK(clip(ls, bounds) == MultiLineString{{{5, 5}, {10, 5}}, {{10, 8}, {5, 8}, {5, 10}}});
+
+        // touching a corner leaves no part
+        CHECK(clip(LineString{{-1, 1}, {1, -1}}, bounds).empty());
+
+        // the segments along the edges are inside
+        CHECK(clip(LineString{{0, -5}, {0, 5}}, bounds) == MultiLineString{{{0, 0}, {0, 5}}});
+    }
+
+    SECTION("linestring keeps z")
+    {
+        auto ls = LineStringZ{{-10, 5, 0}, {10, 5, 20}};
+        CHECK(clip(ls, bounds) == MultiLineStringZ{{{0, 5, 10}, {10, 5, 20}}});
+    }
+
+    SECTION("multilinestring")
+    {
+        auto mls = MultiLineString{{{-5, 5}, {5, 5}}, {{20, 20}, {30, 30}}, {{5, 15}, {5, 5}}};
+        CHECK(clip(mls, bounds) == MultiLineString{{{0, 5}, {5, 5}}, {{5, 10}, {5, 5}}});
+    }
+
+    SECTION("polygon")
+    {
+        // inside, outside
+        auto inside = Polygon{{{1, 1}, {2, 1}, {2, 2}, {1, 1}}};
+        CHECK(clip(inside, bounds) == inside);
+        CHECK(clip(Polygon{{{20, 20}, {30, 20}, {30, 30}, {20, 20}}}, bounds).empty());
+
+        // a square overlapping a corner
+        auto p = Polygon{{{5, 5}, {15, 5}, {15, 15}, {5, 15}, {5, 5}}};
+        CHECK(clip(p, bounds) == Polygon{{{5, 10}, {5, 5}, {10, 5}, {10, 10}, {5, 10}}});
+
+        // a shell enclosing the bounds becomes the bounds
+        auto large = Polygon{{{-5, -5}, {15, -5}, {15, 15}, {-5, 15}, {-5, -5}}};
+        CHECK(clip(large, bounds) == Polygon{{{0, 10}, {0, 0}, {10, 0}, {10, 10}, {0, 10}}});
+
+        // the arms of a concave shell stay joined along the edge
+        auto u = Polygon{{{2, -5}, {8, -5}, {8, 5}, {6, 5}, {6, -2}, {4, -2}, {4, 5}, {2, 5}, {2, -5}}};
+        CHECK(clip(u, bounds) == Polygon{{{2, 0}, {8, 0}, {8, 5}, {6, 5}, {6, 0}, {4, 0}, {4, 5}, {2, 5}, {2, 0}}});
+    }
+
+    SECTION("polygon holes")
+    {
+        auto shell = LinearRing{{-5, -5}, {15, -5}, {15, 15}, {-5, 15}, {-5, -5}};
+
+        // a hole inside is kept, a hole outside is dropped
+        auto p = Polygon{shell, {{2, 2}, {2, 4}, {4, 4}, {2, 2}}, {{12, 12}, {12, 14}, {14, 14}, {12, 12}}};
+        CHECK(clip(p, bounds) ==
+              Polygon{{{0, 10}, {0, 0}, {10, 0}, {10, 10}, {0, 10}}, {{2, 2}, {2, 4}, {4, 4}, {2, 2}}});
+
+        // a hole crossing the bounds is clipped
+        auto crossing = Polygon{shell, {{8, 2}, {8, 4}, {12, 4}, {12, 2}, {8, 2}}};
+        auto clipped  = clip(crossing, bounds);
+        REQUIRE(clipped.size() == 2);
+        CHECK(clipped[1] == LinearRing{{10, 2}, {8, 2}, {8, 4}, {10, 4}, {10, 2}});
+
+        // a hole enclosing the bounds leaves nothing
+        auto hollow = Polygon{{{-20, -20}, {30, -20}, {30, 30}, {-20, 30}, {-20, -20}}, shell};
+        CHECK(clip(hollow, bounds).empty());
+
+        // a hole around the bounds but for a wedge crossing them, its vertices are all on the edges
+        auto notched = LinearRing{{-10, -10}, {20, -10}, {20, 20}, {6, 20}, {5, -5}, {4, 20}, {-10, 20}, {-10, -10}};
+        auto wedge   = clip(Polygon{{{-20, -20}, {30, -20}, {30, 30}, {-20, 30}, {-20, -20}}, notched}, bounds);
+        REQUIRE(not wedge.empty());
+        CHECK(contains(wedge, Point(5, 1)));
+        CHECK(not contains(wedge, Point(1, 1)));
+
+        // the same notch in a shell
+        auto notch = clip(Polygon{notched}, bounds);
+        REQUIRE(notch.size() == 1);
+        CHECK(not contains(notch, Point(5, 1)));
+        CHECK(contains(notch, Point(1, 1)));
+    }
+
+    SECTION("multipolygon")
+    {
+        auto mp = MultiPolygon{{{{-5, 0}, {5, 0}, {5, 5}, {-5, 0}}}, {{{20, 20}, {30, 20}, {30, 30}, {20, 20}}}};
+        CHECK(clip(mp, bounds) == MultiPolygon{{{{0, 2.5}, {0, 0}, {5, 0}, {5, 5}, {0, 2.5}}}});
+    }
+
+    SECTION("reused output")
+    {
+        auto ls = LineString{{-5, 5}, {5, 5}, {5, 15}, {8, 15}, {8, 5}};
+        MultiLineString parts;
+        clip(ls, bounds, parts);
+        CHECK(parts.size() == 2);
+        clip(ls, bounds_t{20, 20, 30, 30}, parts);
+        CHECK(parts.empty());
+        clip(ls, bounds_t{4, 4, 6, 6}, parts);
+        CHECK(parts == MultiLineString{{{4, 5}, {5, 5}, {5, 6}}});
+
+        auto mp = MultiPolygon{{{{-5, -5}, {15, -5}, {15, 15}, {-5, -5}}}, {{{1, 1}, {2, 1}, {2, 2}, {1, 1}}}};
+        MultiPolygon res;
+        clip_buffers<Point> buffers;
+        clip(mp, bounds, res, buffers);
+        CHECK(res.size() == 2);
+        clip(mp, bounds_t{12, 0, 13, 1}, res, buffers);
+        CHECK(res == MultiPolygon{{{{13, 0}, {13, 1}, {12, 1}, {12, 0}, {13, 0}}}});
+    }
+}
@@ -0,0 +1,67 @@
+#include <ciso646>
+#include <random>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("ConvexHull")
+{
+    SECTION("multipoint")
+    {
+        auto mp = MultiPoint{{1, 1}, {0, 0}, {2, 0}, {1, 0}, {2, 2}, {0, 2}, {1, 2}, {0.5, 1.5}};
+        CHECK(convex_hull(mp) == Polygon{{{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}}});
+    }
+
+    SECTION("linestring and polygon")
+    {
+        auto ls = LineString{{0, 0}, {3, 1}, {1, 1}, {0, 3}};
+        CHECK(convex_hull(ls) == Polygon{{{0, 0}, {3, 1}, {0, 3}, {0, 0}}});
+
+        // the holes cannot change the hull
+        auto p = Polygon{{{0, 0}, {4, 0}, {2, 1}, {4, 4}, {0, 4}, {0, 0}}, {{1, 1}, {1, 2}, {2, 2}, {1, 1}}};
+        CHECK(convex_hull(p) == Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}});
+    }
+
+    SECTION("multi geometries")
+    {
+        auto mls = MultiLineString{{{0, 0}, {1, 1}}, {{2, 0}, {1, 3}}};
+        CHECK(convex_hull(mls) == Polygon{{{0, 0}, {2, 0}, {1, 3}, {0, 0}}});
+
+        auto mp = MultiPolygon{{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}}, {{{3, 3}, {4, 3}, {4, 4}, {3, 3}}}};
+        CHECK(convex_hull(mp) == Polygon{{{0, 0}, {1, 0}, {4, 3}, {4, 4}, {0, 0}}});
+    }
+
+    SECTION("degenerate")
+    {
+        CHECK(convex_hull(MultiPoint{}).empty());
+        CHECK(convex_hull(Point{1, 2}) == Polygon{{{1, 2}, {1, 2}}});
+        CHECK(convex_hull(MultiPoint{{1, 1}, {1, 1}}) == Polygon{{{1, 1}, {1, 1}}});
+        CHECK(convex_hull(LineString{{2, 2}, {0, 0}, {1, 1}}) == Polygon{{{0, 0}, {2, 2}, {0, 0}}});
+    }
+
+    SECTION("keeps z")
+    {
+        auto mp = MultiPointZ{{0, 0, 1}, {1, 0, 2}, {0, 1, 3}, {0.1, 0.1, 4}};
+        CHECK(convex_hull(mp) == PolygonZ{{{0, 0, 1}, {1, 0, 2}, {0, 1, 3}, {0, 0, 1}}});
+    }
+
+    SECTION("parallel matches serial")
+    {
+        std::mt19937 gen(7);
+        std::normal_distribution<double> coord(0, 10);
+        MultiPoint mp;
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            mp.emplace_back(coord(gen), coord(gen));
+        }
+        thread_pool pool(4);
+        auto serial = convex_hull(mp);
+        CHECK(serial.size() == 1);
+        CHECK(serial[0].size() > 4);
+        CHECK(convex_hull(mp, pool) == serial);
+
+        CHECK(convex_hull(MultiPoint{}, pool).empty());
+        CHECK(convex_hull(MultiPoint{{0, 0}, {1, 0}, {0, 1}}, pool) == Polygon{{{0, 0}, {1, 0}, {0, 1}, {0, 0}}});
+    }
+}
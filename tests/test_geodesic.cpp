@@ -0,0 +1,92 @@
+#include <ciso646>
+#include <cmath>
+#include <random>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Geodesic")
+{
+    SECTION("haversine")
+    {
+        CHECK(geodesic::haversine(0, 0, 0, 0) == 0);
+        CHECK(geodesic::haversine(0, 0, 1, 0) == Approx(geodesic::EARTH_RADIUS * geodesic::RADIANS));
+        CHECK(geodesic::haversine(0, 0, 180, 0) == Approx(geodesic::EARTH_RADIUS * std::acos(-1.0)));
+        // across the antimeridian
+        CHECK(geodesic::haversine(179.5, 0, -179.5, 0) == Approx(geodesic::haversine(0, 0, 1, 0)));
+        // London to Paris
+        CHECK(geodesic::haversine(-0.1278, 51.5074, 2.3522, 48.8566) == Approx(343556).margin(10));
+    }
+
+    SECTION("vincenty")
+    {
+        CHECK(geodesic::vincenty(10, 20, 10, 20) == 0);
+        CHECK(geodesic::vincenty(0, 0, 1, 0) == Approx(111319.491).margin(1e-3));
+        CHECK(geodesic::vincenty(0, 0, 0, 90) == Approx(10001965.729).margin(1e-3));
+        // Flinders Peak to Buninyong, the example of the original paper
+        double lat1 = -(37 + 57 / 60.0 + 3.72030 / 3600);
+        double lng1 = 144 + 25 / 60.0 + 29.52440 / 3600;
+        double lat2 = -(37 + 39 / 60.0 + 10.15610 / 3600);
+        double lng2 = 143 + 55 / 60.0 + 35.38390 / 3600;
+        CHECK(geodesic::vincenty(lng1, lat1, lng2, lat2) == Approx(54972.271).margin(1e-3));
+        // nearly antipodal points do not converge and fall back to the sphere
+        CHECK(geodesic::vincenty(0, 0, 179.7, 0.5) > 19900000);
+    }
+
+    SECTION("points")
+    {
+        CHECK(geodesic::distance(Point(0, 0), Point(1, 0)) == Approx(geodesic::haversine(0, 0, 1, 0)));
+        CHECK(geodesic::distance(PointZ(0, 0, 10), PointZ(1, 0, 20), geodesic::method::VINCENTY) ==
+              Approx(111319.491).margin(1e-3));
+    }
+
+    SECTION("length")
+    {
+        auto ls = LineString{{0, 0}, {1, 0}, {1, 1}};
+        double expected = geodesic::haversine(0, 0, 1, 0) + geodesic::haversine(1, 0, 1, 1);
+        CHECK(geodesic::length(ls) == Approx(expected));
+        CHECK(geodesic::length(MultiLineString{ls, ls}) == Approx(2 * expected));
+        CHECK(geodesic::length(ls, geodesic::method::VINCENTY) ==
+              Approx(geodesic::vincenty(0, 0, 1, 0) + geodesic::vincenty(1, 0, 1, 1)));
+        CHECK(geodesic::length(Polygon{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}}) == 0);
+
+        // long enough for the batched path
+        LineString track;
+        double total = 0;
+        for (size_t i = 0; i < 1001; ++i)
+        {
+            track.emplace_back(-179.9 + 0.37 * static_cast<double>(i), 80 * std::sin(static_cast<double>(i) / 50));
+            if (i > 0)
+            {
+                total += geodesic::haversine(track[i - 1].lng, track[i - 1].lat, track[i].lng, track[i].lat);
+            }
+        }
+        CHECK(geodesic::length(track) == Approx(total).epsilon(1e-12));
+    }
+
+    SECTION("batch")
+    {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<double> lng(-180, 180);
+        std::uniform_real_distribution<double> lat(-90, 90);
+        MultiPoint points;
+        for (size_t i = 0; i < 1003; ++i)
+        {
+            points.emplace_back(lng(gen), lat(gen));
+        }
+        points.emplace_back(0, 90);
+        points.emplace_back(-180, -90);
+        points.emplace_back(12, 34);
+
+        auto origin = Point(12, 34);
+        auto res    = geodesic::distances(origin, points);
+        REQUIRE(res.size() == points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(res[i] == Approx(geodesic::haversine(origin.lng, origin.lat, points[i].lng, points[i].lat)).margin(1e-6));
+        }
+        CHECK(res.back() == 0);
+        CHECK(geodesic::distances(origin, MultiPoint{}).empty());
+    }
+}
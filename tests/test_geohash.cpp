@@ -0,0 +1,135 @@
+#include <ciso646>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the textbook encoder, bisecting the longitude and latitude ranges one bit at a time
+std::string bisect(double lng, double lat, size_t precision)
+{
+    double lng_range[] = {-180, 180};
+    double lat_range[] = {-90, 90};
+    std::string res;
+    bool even = true;
+    int bit   = 0;
+    int ch    = 0;
+    while (res.size() < precision)
+    {
+        double* range = even ? lng_range : lat_range;
+        double value  = even ? lng : lat;
+        double mid    = (range[0] + range[1]) / 2;
+        ch <<= 1;
+        if (value >= mid)
+        {
+            ch |= 1;
+            range[0] = mid;
+        }
+        else
+        {
+            range[1] = mid;
+        }
+        even = not even;
+        if (++bit == 5)
+        {
+            res += geohash::ALPHABET[ch];
+            bit = 0;
+            ch  = 0;
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("Geohash")
+{
+    SECTION("encode")
+    {
+        CHECK(geohash::encode(-5.6, 42.6, 5) == "ezs42");
+        CHECK(geohash::encode(Point(10.40744, 57.64911), 11) == "u4pruydqqvj");
+        CHECK(geohash::encode(-180, -90) == "000000000000");
+        CHECK(geohash::encode(180, 90) == "zzzzzzzzzzzz");
+        CHECK(geohash::encode(0, 0, 1) == "s");
+        CHECK(geohash::encode_int(0, 0, 1) == 24);
+        CHECK_THROWS_AS(geohash::encode(0, 0, 0), exceptions::geometry_error);
+        CHECK_THROWS_AS(geohash::encode(0, 0, 13), exceptions::geometry_error);
+    }
+
+    SECTION("encode matches bisection")
+    {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<double> lng(-180, 180);
+        std::uniform_real_distribution<double> lat(-90, 90);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            double x = lng(gen);
+            double y = lat(gen);
+            CHECK(geohash::encode(x, y, 9) == bisect(x, y, 9));
+        }
+    }
+
+    SECTION("decode")
+    {
+        auto b = geohash::decode("ezs42");
+        CHECK(b.minx == Approx(-5.625));
+        CHECK(b.maxx == Approx(-5.5810546875));
+        CHECK(b.miny == Approx(42.5830078125));
+        CHECK(b.maxy == Approx(42.626953125));
+        CHECK(b.contains(-5.6, 42.6));
+
+        CHECK(geohash::decode_int(geohash::to_int("u4pruydqqvj"), 11).contains(10.40744, 57.64911));
+        CHECK(geohash::to_string(geohash::to_int("u4pruydqqvj"), 11) == "u4pruydqqvj");
+        CHECK_THROWS_AS(geohash::decode(""), exceptions::parse_error);
+        CHECK_THROWS_AS(geohash::decode("ezs4a"), exceptions::parse_error);
+        CHECK_THROWS_AS(geohash::decode("0123456789bcd"), exceptions::parse_error);
+    }
+
+    SECTION("batch")
+    {
+        MultiPoint points = {{-5.6, 42.6}, {10.40744, 57.64911}, {0, 0}};
+        std::vector<std::string> hashes = {"a previous value"};
+        geohash::encode(points, 5, hashes);
+        CHECK(hashes == std::vector<std::string>{"ezs42", "u4pru", "s0000"});
+
+        std::vector<uint64_t> codes;
+        geohash::encode(points, 5, codes);
+        REQUIRE(codes.size() == 3);
+        for (size_t i = 0; i < codes.size(); ++i)
+        {
+            CHECK(geohash::to_string(codes[i], 5) == hashes[i]);
+        }
+    }
+
+    SECTION("cover")
+    {
+        // the four cells around the origin
+        auto cells    = geohash::cover(Polygon{{{-5, -5}, {5, -5}, {5, 5}, {-5, 5}, {-5, -5}}}, 1);
+        auto expected = std::vector<std::string>{geohash::encode(-5, -5, 1), geohash::encode(5, -5, 1),
+                                                 geohash::encode(-5, 5, 1), geohash::encode(5, 5, 1)};
+        std::sort(expected.begin(), expected.end());
+        CHECK(cells == expected);
+
+        // a triangle leaves out the cells beyond its diagonal
+        cells = geohash::cover(Polygon{{{1, 1}, {89, 1}, {1, 44}, {1, 1}}}, 1);
+        CHECK(cells == std::vector<std::string>{"s", "t"});
+
+        // cells of 11.25 by 5.625 degrees, the hole holds 2 columns and 6 rows of them
+        Polygon polygon = {{{0.1, 0.1}, {44.9, 0.1}, {44.9, 44.9}, {0.1, 44.9}, {0.1, 0.1}},
+                           {{11, 5.5}, {11, 39.5}, {34, 39.5}, {34, 5.5}, {11, 5.5}}};
+        cells           = geohash::cover(polygon, 2);
+        CHECK(cells.size() == 4 * 8 - 2 * 6);
+        CHECK(std::is_sorted(cells.begin(), cells.end()));
+        CHECK(std::count(cells.begin(), cells.end(), geohash::encode(17, 20, 2)) == 0);
+        CHECK(std::count(cells.begin(), cells.end(), geohash::encode(5, 20, 2)) == 1);
+        CHECK(std::count(cells.begin(), cells.end(), geohash::encode(17, 40, 2)) == 1);
+
+        CHECK(geohash::cover(Polygon(), 3).empty());
+    }
+}
@@ -96,4 +96,38 @@ TEST_CASE("Geometry")
             std::cout << p->y << std::endl;
         }
     }
+
+    SECTION("moved containers")
+    {
+        // the points are adopted, not copied
+        linestring ls{{1, 2}, {3, 4}, {5, 6}};
+        const auto* data = ls.data();
+        geometry geom(std::move(ls));
+        CHECK(geom.is_linestring());
+        CHECK(geom.get<linestring>()->data() == data);
+        CHECK(*geom.get<linestring>() == linestring({{1, 2}, {3, 4}, {5, 6}}));
+
+        auto mp    = multipolygon::from_json("{\"type\":\"MultiPolygon\",\"coordinates\":[[[[0,0],[1,0],[1,1],[0,0]]]]}");
+        geometry other(std::move(mp));
+        CHECK(mp.empty());
+        CHECK(other.wkt() == "MULTIPOLYGON(((0 0,1 0,1 1,0 0)))");
+    }
+
+    SECTION("dimension traits")
+    {
+        static_assert(dimension_traits<Point>::ndim::value == 2, "xy");
+        static_assert(dimension_traits<PointZM>::ndim::value == 4, "xyzm");
+        static_assert(dimension_traits<LineStringM>::has_m::value and not dimension_traits<LineStringM>::has_z::value, "xym");
+        static_assert(dimension_traits<MultiPolygonZ>::dim::value == dimension_type::XYZ, "xyz");
+        static_assert(dimension_traits<PolygonZM>::geom_type::value == geometry_type::POLYGONZM, "polygon zm");
+        static_assert(dimension_traits<point_m_t<float>>::geom_type::value == geometry_type::POINTM, "point m");
+
+        // the same values as the member functions
+        MultiLineStringZ mls;
+        CHECK(mls.geom_type() == dimension_traits<MultiLineStringZ>::geom_type::value);
+        CHECK(mls.dim() == dimension_traits<MultiLineStringZ>::dim::value);
+        CHECK(mls.ndim() == dimension_traits<MultiLineStringZ>::ndim::value);
+        CHECK(MultiPointM().has_m() == dimension_traits<MultiPointM>::has_m::value);
+        CHECK(PointZ().size() == 3);
+    }
 }
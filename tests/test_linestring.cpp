@@ -695,4 +695,71 @@ TEST_CASE("LineString")
         CHECK(b.minx == 1.0);
         CHECK(b.miny == 2.0);
     }
+
+    SECTION("validity")
+    {
+        CHECK(LineString{}.is_valid());
+        CHECK(LineString{{1, 2}, {3, 4}}.is_valid());
+
+        auto res = LineString{{1, 2}}.validate();
+        CHECK(res.code == validity_code::TOO_FEW_POINTS);
+        CHECK(res.message() == "LineString should be either empty or with 2 or more points");
+
+        res = LineString{{1, 2}, {1, 2}}.validate();
+        CHECK_FALSE(res.valid());
+        CHECK(res.x == 1.0);
+        CHECK(res.y == 2.0);
+        CHECK_THROWS_WITH(LineString({{1, 2}, {1, 2}}).throw_for_invalid(),
+                          "geometry error: LineString with exactly two equal points at POINT (1 2)");
+    }
+
+    SECTION("coordinate types")
+    {
+        using linestring_f = linestring_t<float>;
+        auto lf            = linestring_f::from_wkt("LINESTRING(1.5 2.5,-3.25 4)");
+        CHECK(lf == linestring_f{{1.5f, 2.5f}, {-3.25f, 4.0f}});
+        CHECK(linestring_f::from_json(lf.json()) == lf);
+        CHECK(lf.bounds().minx == -3.25);
+        CHECK(std::get<1>(lf.xy()[1]) == 4.0f);
+        CHECK(linestring_f::from_polyline(lf.polyline()) == lf);
+
+        // micro-degrees
+        using linestring_i = linestring_z_t<int32_t>;
+        auto li            = linestring_i{{-122419416, 37774929, 16}, {2352222, 48856614, 35}};
+        CHECK(li.wkt() == "LINESTRINGZ(-122419416 37774929 16,2352222 48856614 35)");
+        CHECK(linestring_i::from_wkt(li.wkt()) == li);
+        CHECK(linestring_i::from_json(li.json()) == li);
+        CHECK(li.bounds().maxy == 48856614);
+        CHECK(sizeof(li[0]) == 3 * sizeof(int32_t));
+    }
+
+    SECTION("coordinate arrays")
+    {
+        // copied with a memcpy
+        CHECK(utils::is_packed_point<Point>::value);
+        CHECK(utils::is_packed_point<PointZM>::value);
+        std::vector<double> coords = {1, 2, 3, 4, 5, 6};
+        LineString ls(coords.data(), coords.size());
+        CHECK(ls == LineString({{1, 2}, {3, 4}, {5, 6}}));
+        CHECK(LineString(coords.begin(), coords.end()) == ls);
+
+        ls.assign(coords.data(), 4);
+        CHECK(ls == LineString({{1, 2}, {3, 4}}));
+        ls.assign(coords.begin() + 2, coords.end());
+        CHECK(ls == LineString({{3, 4}, {5, 6}}));
+        ls.assign(coords.data(), 0);
+        CHECK(ls.empty());
+        // the vector overloads
+        ls.assign(2, Point(7, 8));
+        CHECK(ls == LineString({{7, 8}, {7, 8}}));
+
+        LineStringZM lszm(coords.data(), 4);
+        CHECK(lszm == LineStringZM({{1, 2, 3, 4}}));
+        // converted a point at a time
+        std::vector<float> floats = {0.5f, 1.5f, 2.5f, 3.5f};
+        CHECK(LineString(floats.begin(), floats.end()) == LineString({{0.5, 1.5}, {2.5, 3.5}}));
+
+        CHECK_THROWS_AS(LineString(coords.data(), 5), exceptions::geometry_error);
+        CHECK_THROWS_AS(lszm.assign(coords.begin(), coords.end()), exceptions::geometry_error);
+    }
 }
@@ -0,0 +1,109 @@
+#include <ciso646>
+#include <cmath>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Measures")
+{
+    auto square = Polygon{
+        {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}},
+        {{2, 2}, {2, 4}, {4, 4}, {4, 2}, {2, 2}}};
+
+    SECTION("area")
+    {
+        CHECK(area(Point(1, 2)) == 0);
+        CHECK(area(LineString{{0, 0}, {1, 1}}) == 0);
+        CHECK(area(square) == Approx(96));
+        CHECK(area(Polygon{{{0, 0}, {0, 10}, {10, 10}, {10, 0}, {0, 0}}}) == Approx(100));
+        // implicitly closed ring
+        CHECK(area(Polygon{{{0, 0}, {10, 0}, {10, 10}}}) == Approx(50));
+        CHECK(area(MultiPolygon{square, Polygon{{{20, 0}, {21, 0}, {21, 1}, {20, 0}}}}) == Approx(96.5));
+        CHECK(area(PolygonZ{{{0, 0, 5}, {4, 0, 6}, {4, 4, 7}, {0, 4, 8}, {0, 0, 5}}}) == Approx(16));
+        CHECK(area(Polygon{}) == 0);
+    }
+
+    SECTION("area far from the origin")
+    {
+        // a thin sliver of many vertices, the naive shoelace loses every digit here
+        Polygon polygon{LinearRing{}};
+        size_t n = 100001;
+        for (size_t i = 0; i < n; ++i)
+        {
+            polygon[0].emplace_back(1e7 + static_cast<double>(i) * 1e-3, 1e7);
+        }
+        polygon[0].emplace_back(1e7 + 100, 1e7 + 1);
+        polygon[0].emplace_back(1e7, 1e7 + 1);
+        polygon[0].emplace_back(1e7, 1e7);
+        CHECK(area(polygon) == Approx(100).epsilon(1e-12));
+    }
+
+    SECTION("length and perimeter")
+    {
+        CHECK(length(Point(1, 2)) == 0);
+        CHECK(length(LineString{{0, 0}, {3, 4}, {3, 10}}) == Approx(11));
+        CHECK(length(MultiLineString{{{0, 0}, {3, 4}}, {{0, 0}, {0, 1}}}) == Approx(6));
+        CHECK(length(square) == 0);
+        CHECK(perimeter(square) == Approx(48));
+        CHECK(perimeter(Polygon{{{0, 0}, {10, 0}, {10, 10}, {0, 10}}}) == Approx(40));
+        CHECK(perimeter(LineString{{0, 0}, {3, 4}}) == 0);
+        CHECK(perimeter(MultiPolygon{square, square}) == Approx(96));
+    }
+
+    SECTION("length in 3D")
+    {
+        CHECK(length(LineStringZ{{0, 0, 0}, {1, 2, 2}, {1, 2, 5}}) == Approx(6));
+        CHECK(length(LineStringZM{{0, 0, 0, 7}, {1, 2, 2, 8}}) == Approx(3));
+        CHECK(length(LineStringM{{0, 0, 0}, {3, 4, 100}}) == Approx(5));
+    }
+
+    SECTION("long linestring")
+    {
+        LineString ls;
+        for (size_t i = 0; i <= 10007; ++i)
+        {
+            ls.emplace_back(static_cast<double>(i % 2), static_cast<double>(i));
+        }
+        CHECK(length(ls) == Approx(10007 * std::sqrt(2.0)));
+    }
+
+    SECTION("centroid")
+    {
+        auto c = centroid(square);
+        CHECK(c.x == Approx((100 * 5 - 4 * 3) / 96.0));
+        CHECK(c.y == Approx((100 * 5 - 4 * 3) / 96.0));
+
+        c = centroid(MultiPolygon{Polygon{{{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}}}, Polygon{{{10, 0}, {12, 0}, {12, 2}, {10, 2}, {10, 0}}}});
+        CHECK(c.x == Approx(6));
+        CHECK(c.y == Approx(1));
+
+        c = centroid(LineString{{0, 0}, {10, 0}, {10, 2}});
+        CHECK(c.x == Approx((5 * 10 + 10 * 2) / 12.0));
+        CHECK(c.y == Approx((0 * 10 + 1 * 2) / 12.0));
+
+        c = centroid(MultiPoint{{0, 0}, {2, 0}, {4, 6}});
+        CHECK(c.x == Approx(2));
+        CHECK(c.y == Approx(2));
+
+        c = centroid(PointZ(1, 2, 3));
+        CHECK(c.x == 1);
+        CHECK(c.y == 2);
+    }
+
+    SECTION("centroid of degenerate geometries")
+    {
+        // zero area falls back to the boundary
+        auto c = centroid(Polygon{{{0, 0}, {4, 0}, {0, 0}}});
+        CHECK(c.x == Approx(2));
+        CHECK(c.y == Approx(0));
+
+        // zero length falls back to the vertices
+        c = centroid(LineString{{1, 1}, {1, 1}});
+        CHECK(c.x == 1);
+        CHECK(c.y == 1);
+
+        CHECK_THROWS_AS(centroid(MultiPoint{}), exceptions::geometry_error);
+        CHECK_THROWS_AS(centroid(Polygon{}), exceptions::geometry_error);
+    }
+}
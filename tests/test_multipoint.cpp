@@ -695,4 +695,17 @@ TEST_CASE("MultiPoint")
         CHECK(b.minx == 1.0);
         CHECK(b.miny == 2.0);
     }
+
+    SECTION("coordinate arrays")
+    {
+        std::vector<double> coords = {1, 2, 3, 4, 5, 6};
+        MultiPoint mp(coords.data(), coords.size());
+        CHECK(mp == MultiPoint({{1, 2}, {3, 4}, {5, 6}}));
+        mp.assign(coords.begin() + 2, coords.begin() + 4);
+        CHECK(mp == MultiPoint({{3, 4}}));
+        MultiPointZ mpz;
+        mpz.assign(coords.data(), coords.size());
+        CHECK(mpz == MultiPointZ({{1, 2, 3}, {4, 5, 6}}));
+        CHECK_THROWS_AS(mp.assign(coords.data(), 3), exceptions::geometry_error);
+    }
 }
@@ -856,4 +856,18 @@ TEST_CASE("MultiPolygon")
     //            //            CHECK(z == 9.0);
     //            //            CHECK(m == -3.5);
     //        }
+
+    SECTION("json roundtrip")
+    {
+        MultiPolygon mp = {{{{0, 0}, {4, 0}, {4, 4}, {0, 0}}, {{1, 1}, {2, 1}, {2, 2}, {1, 1}}}, {{{5, 5}, {6, 5}, {6, 6}, {5, 5}}}};
+        CHECK(mp.json() == R"json({"type":"MultiPolygon","coordinates":[[[[0,0],[4,0],[4,4],[0,0]],[[1,1],[2,1],[2,2],[1,1]]],[[[5,5],[6,5],[6,6],[5,5]]]]})json");
+        CHECK(MultiPolygon::from_json(mp.json()) == mp);
+        CHECK(mp.xy().size() == 12);
+
+        using multipolygon_i = multipolygon_t<int32_t>;
+        auto mi              = multipolygon_i::from_json(mp.json());
+        CHECK(mi.size() == 2);
+        CHECK(mi[0][1][2].x == 2);
+        CHECK(mi.json() == mp.json());
+    }
 }
@@ -0,0 +1,264 @@
+#include <ciso646>
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// the tile of a single layer "l" with a single feature without properties, all the fields fit in one byte
+std::string expected_tile(uint8_t type, const std::vector<uint8_t>& commands)
+{
+    std::string feature = {0x18, static_cast<char>(type), 0x22, static_cast<char>(commands.size())};
+    feature.append(commands.begin(), commands.end());
+    std::string layer = {0x78, 0x02, 0x0a, 0x01, 'l', 0x12, static_cast<char>(feature.size())};
+    layer += feature;
+    layer += std::string{0x28, static_cast<char>(0x80), 0x20};
+    return std::string{0x1a, static_cast<char>(layer.size())} + layer;
+}
+
+// a point given in tile coordinates, the y axis of the tile points down
+Point tile_point(double x, double y)
+{
+    return {x, 4096 - y};
+}
+
+size_t count(const std::string& text, const std::string& pattern)
+{
+    size_t res = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+    {
+        ++res;
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("MVT")
+{
+    auto bounds = bounds_t{0, 0, 4096, 4096};
+
+    SECTION("points")
+    {
+        mvt::layer_encoder point("l", bounds);
+        CHECK(point.add_feature(tile_point(25, 17)));
+        CHECK(point.serialize() == expected_tile(1, {9, 50, 34}));
+
+        mvt::layer_encoder multipoint("l", bounds);
+        multipoint.add_feature(MultiPoint{tile_point(5, 7), tile_point(3, 2)});
+        CHECK(multipoint.serialize() == expected_tile(1, {17, 10, 14, 3, 9}));
+    }
+
+    SECTION("linestrings")
+    {
+        mvt::layer_encoder linestring("l", bounds);
+        linestring.add_feature(LineString{tile_point(2, 2), tile_point(2, 10), tile_point(10, 10)});
+        CHECK(linestring.serialize() == expected_tile(2, {9, 4, 4, 18, 0, 16, 16, 0}));
+
+        mvt::layer_encoder multilinestring("l", bounds);
+        multilinestring.add_feature(MultiLineString{{tile_point(2, 2), tile_point(2, 10), tile_point(10, 10)},
+                                                    {tile_point(1, 1), tile_point(3, 5)}});
+        CHECK(multilinestring.serialize() ==
+              expected_tile(2, {9, 4, 4, 18, 0, 16, 16, 0, 9, 17, 17, 10, 4, 8}));
+    }
+
+    SECTION("polygons")
+    {
+        // the exterior ring is clockwise in tile coordinates
+        auto ring = LinearRing{tile_point(3, 6), tile_point(8, 12), tile_point(20, 34), tile_point(3, 6)};
+        mvt::layer_encoder polygon("l", bounds);
+        polygon.add_feature(Polygon{ring});
+        CHECK(polygon.serialize() == expected_tile(3, {9, 6, 12, 18, 10, 12, 24, 44, 15}));
+
+        // the winding is fixed
+        mvt::layer_encoder reversed("l", bounds);
+        reversed.add_feature(Polygon{{tile_point(20, 34), tile_point(8, 12), tile_point(3, 6), tile_point(20, 34)}});
+        CHECK(reversed.serialize() == polygon.serialize());
+
+        // the holes are counter-clockwise
+        auto shell = LinearRing{tile_point(0, 0), tile_point(10, 0), tile_point(10, 10), tile_point(0, 10),
+                                tile_point(0, 0)};
+        auto hole = LinearRing{tile_point(11, 11), tile_point(20, 11), tile_point(20, 20), tile_point(11, 20),
+                               tile_point(11, 11)};
+        mvt::layer_encoder multipolygon("l", bounds);
+        multipolygon.add_feature(MultiPolygon{{shell}, {hole, hole}});
+        CHECK(multipolygon.serialize() ==
+              expected_tile(3, {9,  0, 0,  26, 20, 0, 0,  20, 19, 0, 15, 9, 22, 2, 26, 18, 0,
+                                0,  18, 17, 0,  15, 9, 0,  0,  26, 18, 0, 0, 17, 17, 0, 15}));
+    }
+
+    SECTION("collapsed geometries are skipped")
+    {
+        mvt::layer_encoder layer("l", bounds_t{0, 0, 1, 1}, 16);
+        CHECK_FALSE(layer.add_feature(LineString{{0.5, 0.5}, {0.51, 0.5}}));
+        CHECK_FALSE(layer.add_feature(Polygon{{{0.5, 0.5}, {0.51, 0.5}, {0.51, 0.51}, {0.5, 0.5}}}));
+        CHECK_FALSE(layer.add_feature(MultiPoint{}));
+        CHECK(layer.add_feature(LineString{{0.5, 0.5}, {0.6, 0.5}}));
+        CHECK(layer.size() == 1);
+
+        // a hole collapsing to a point is dropped
+        mvt::layer_encoder holes("l", bounds_t{0, 0, 1, 1}, 16);
+        holes.add_feature(
+            Polygon{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}, {{0.5, 0.4}, {0.51, 0.4}, {0.51, 0.41}, {0.5, 0.4}}});
+        mvt::layer_encoder shell("l", bounds_t{0, 0, 1, 1}, 16);
+        shell.add_feature(Polygon{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}});
+        CHECK(holes.serialize() == shell.serialize());
+    }
+
+    SECTION("properties")
+    {
+        mvt::layer_encoder layer("l", bounds);
+        layer.add_feature(tile_point(1, 1), {{"name", "a"}, {"height", -1}, {"area", 2.5}}, 7);
+        layer.add_feature(tile_point(2, 2), {{"name", "a"}, {"height", 3u}, {"open", true}});
+        CHECK(layer.size() == 2);
+
+        auto bytes = layer.serialize();
+        CHECK(count(bytes, "name") == 1);
+        CHECK(count(bytes, "height") == 1);
+        // the values, each Value message is a field 4 of the layer
+        CHECK(count(bytes, std::string{0x22, 0x03, 0x0a, 0x01, 'a'}) == 1);
+        CHECK(count(bytes, std::string{0x22, 0x02, 0x30, 0x01}) == 1);
+        CHECK(count(bytes, std::string{0x22, 0x02, 0x28, 0x03}) == 1);
+        CHECK(count(bytes, std::string{0x22, 0x02, 0x38, 0x01}) == 1);
+        CHECK(count(bytes, std::string{0x22, 0x09, 0x19, 0, 0, 0, 0, 0, 0, 0x04, 0x40}) == 1);
+        // the id and tags of the first feature
+        CHECK(count(bytes, std::string{0x08, 0x07, 0x12, 0x06, 0, 0, 1, 1, 2, 2}) == 1);
+        CHECK(count(bytes, std::string{0x12, 0x06, 0, 0, 1, 3, 3, 4}) == 1);
+    }
+
+    SECTION("values")
+    {
+        CHECK(mvt::value("a").type == mvt::value_type::STRING);
+        CHECK(mvt::value(1.5f).type == mvt::value_type::FLOAT);
+        CHECK(mvt::value(1.5).type == mvt::value_type::DOUBLE);
+        CHECK(mvt::value(-2).int_value == -2);
+        CHECK(mvt::value(uint64_t{2}).type == mvt::value_type::UINT);
+        CHECK(mvt::value(false).type == mvt::value_type::BOOL);
+        CHECK(mvt::value(1) != mvt::value(1u));
+        CHECK(mvt::value(std::string("a")) == mvt::value("a"));
+    }
+
+    SECTION("decode")
+    {
+        mvt::layer_encoder points("points", bounds);
+        points.add_feature(MultiPoint{tile_point(5, 7), tile_point(3, 2)}, {{"name", "a"}, {"rank", 2}}, 42);
+        mvt::layer_encoder lines("lines", bounds);
+        lines.add_feature(MultiLineString{{tile_point(2, 2), tile_point(2, 10), tile_point(10, 10)},
+                                          {tile_point(1, 1), tile_point(3, 5)}});
+        auto tile = points.serialize() + lines.serialize();
+
+        auto layers = mvt::read_layers(tile);
+        REQUIRE(layers.size() == 2);
+        CHECK(layers[0].name() == "points");
+        CHECK(layers[0].version() == 2);
+        CHECK(layers[0].extent() == 4096);
+        REQUIRE(layers[0].size() == 1);
+
+        auto feature = layers[0][0];
+        CHECK(feature.type() == mvt::geom_type::POINT);
+        CHECK(feature.has_id());
+        CHECK(feature.id() == 42);
+        CHECK(feature.properties() == mvt::properties{{"name", "a"}, {"rank", 2}});
+        MultiPoint mp;
+        feature.points(mp);
+        CHECK(mp == MultiPoint{{5, 7}, {3, 2}});
+        feature.points(mp, bounds);
+        CHECK(mp == MultiPoint{tile_point(5, 7), tile_point(3, 2)});
+
+        auto line = layers[1][0];
+        CHECK(line.type() == mvt::geom_type::LINESTRING);
+        CHECK_FALSE(line.has_id());
+        CHECK(line.properties().empty());
+        MultiLineString mls;
+        line.linestrings(mls);
+        CHECK(mls == MultiLineString{{{2, 2}, {2, 10}, {10, 10}}, {{1, 1}, {3, 5}}});
+
+        CHECK_THROWS_AS(layers[1][1], exceptions::index_error);
+    }
+
+    SECTION("decode polygons")
+    {
+        // counter-clockwise shells with clockwise holes
+        auto shell = Polygon{{{0, 0}, {100, 0}, {100, 100}, {0, 100}, {0, 0}}, {{10, 10}, {10, 20}, {20, 20}, {10, 10}}};
+        auto other = Polygon{{{200, 200}, {300, 200}, {300, 300}, {200, 200}}};
+        mvt::layer_encoder layer("l", bounds);
+        layer.add_feature(MultiPolygon{shell, other});
+        auto tile = layer.serialize();
+
+        auto layers  = mvt::read_layers(tile);
+        auto feature = layers[0][0];
+        CHECK(feature.type() == mvt::geom_type::POLYGON);
+        MultiPolygon mp;
+        feature.polygons(mp, bounds);
+        // the same rings, starting at another vertex
+        CHECK(mp == MultiPolygon{{{{0, 100}, {0, 0}, {100, 0}, {100, 100}, {0, 100}},
+                                  {{20, 20}, {10, 10}, {10, 20}, {20, 20}}},
+                                 {{{300, 300}, {200, 200}, {300, 200}, {300, 300}}}});
+
+        // the tile y axis points down
+        feature.polygons(mp);
+        REQUIRE(mp.size() == 2);
+        CHECK(mp[0].size() == 2);
+        CHECK(mp[0][0] == LinearRing{{0, 3996}, {100, 3996}, {100, 4096}, {0, 4096}, {0, 3996}});
+        CHECK(mp[1].size() == 1);
+    }
+
+    SECTION("decode bounds")
+    {
+        mvt::layer_encoder layer("l", bounds);
+        layer.add_feature(LineString{tile_point(2, 2), tile_point(2, 10), tile_point(10, 10)});
+        layer.add_feature(tile_point(30, 1));
+        auto tile   = layer.serialize();
+        auto layers = mvt::read_layers(tile);
+
+        auto b = layers[0][0].bounds();
+        CHECK(b.minx == 2);
+        CHECK(b.miny == 2);
+        CHECK(b.maxx == 10);
+        CHECK(b.maxy == 10);
+
+        b = layers[0].bounds();
+        CHECK(b.minx == 2);
+        CHECK(b.miny == 1);
+        CHECK(b.maxx == 30);
+        CHECK(b.maxy == 10);
+    }
+
+    SECTION("decode values")
+    {
+        mvt::properties props = {{"s", "x"}, {"f", 1.5f}, {"d", 2.5}, {"i", -3}, {"u", 4u}, {"b", true}};
+        mvt::layer_encoder layer("l", bounds);
+        layer.add_feature(tile_point(1, 1), props);
+        auto tile = layer.serialize();
+        auto layers = mvt::read_layers(tile);
+        CHECK(layers[0][0].properties() == props);
+    }
+
+    SECTION("malformed tiles")
+    {
+        mvt::layer_encoder layer("l", bounds);
+        layer.add_feature(LineString{tile_point(2, 2), tile_point(2, 10)});
+        auto tile = layer.serialize();
+
+        CHECK_THROWS_AS(mvt::read_layers(tile.substr(0, tile.size() - 1)), exceptions::parse_error);
+        CHECK_THROWS_AS(mvt::read_layers(std::string{0x1a, static_cast<char>(0x80)}), exceptions::parse_error);
+
+        // a point feature read as a linestring
+        mvt::layer_encoder point("l", bounds);
+        point.add_feature(MultiPoint{tile_point(5, 7), tile_point(3, 2)});
+        auto point_tile = point.serialize();
+        auto point_layers = mvt::read_layers(point_tile);
+        MultiLineString mls;
+        CHECK_THROWS_AS(point_layers[0][0].linestrings(mls), exceptions::parse_error);
+
+        // two moves of 2^31 - 1 overflow the cursor
+        auto overflow = expected_tile(1, {0x11, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0x00});
+        auto overflow_layers = mvt::read_layers(overflow);
+        MultiPoint mp;
+        CHECK_THROWS_AS(overflow_layers[0][0].points(mp), exceptions::parse_error);
+    }
+}
@@ -486,4 +486,21 @@ TEST_CASE("Point")
         CHECK(sizeof(point_zm_t<int>) == 4 * sizeof(int));
         CHECK(sizeof(point_zm_t<char>) == 4 * sizeof(char));
     }
+
+    SECTION("coordinate types")
+    {
+        auto pf = point_t<float>::from_json(R"json({"type":"Point","coordinates":[1.5,-2.25]})json");
+        CHECK(pf == point_t<float>(1.5f, -2.25f));
+        CHECK(pf.json() == R"json({"type":"Point","coordinates":[1.5,-2.25]})json");
+        CHECK(pf.bounds().minx == 1.5);
+
+        // the parsed coordinates are rounded to the integer type
+        auto pi = point_zm_t<int32_t>::from_wkt("POINT ZM (1.4 -2.6 3 40000000)");
+        CHECK(pi == point_zm_t<int32_t>(1, -3, 3, 40000000));
+        CHECK(pi.wkt() == "POINT ZM (1 -3 3 40000000)");
+        CHECK(point_t<int32_t>::from_polyline(point_t<int32_t>(38, -120).polyline()) == point_t<int32_t>(38, -120));
+
+        // the 8 bit coordinates are written as numbers
+        CHECK(point_t<int8_t>(65, 66).wkt() == "POINT (65 66)");
+    }
 }
@@ -0,0 +1,54 @@
+#include <ciso646>
+#include <cmath>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("PointsInPolygon")
+{
+    auto square = Polygon{
+        {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}},
+        {{4, 4}, {6, 4}, {6, 6}, {4, 6}, {4, 4}}};
+
+    SECTION("flat arrays")
+    {
+        std::vector<double> xs{1, 5, 11, 0, 4, 10, 9.5, -1, 5};
+        std::vector<double> ys{1, 5, 5, 5, 5, 10, 9.5, -1, 3};
+        std::vector<uint8_t> res(xs.size(), 7);
+        points_in_polygon(xs.data(), ys.data(), xs.size(), square, res.data());
+        CHECK(res == std::vector<uint8_t>{1, 0, 0, 1, 1, 1, 1, 0, 1});
+    }
+
+    SECTION("empty")
+    {
+        CHECK(points_in_polygon(MultiPoint{}, square).empty());
+        CHECK(points_in_polygon(MultiPoint{{1, 1}}, Polygon{}) == std::vector<uint8_t>{0});
+    }
+
+    SECTION("multipoint - matches point_in_polygon")
+    {
+        auto mp = MultiPolygon{square, Polygon{{{20, 0}, {30, 5}, {20, 10}, {25, 5}, {20, 0}}}};
+        // odd sizes exercise the partial batches
+        for (size_t n : {1, 3, 7, 1001, 3000})
+        {
+            MultiPoint points;
+            for (size_t i = 0; i < n; ++i)
+            {
+                points.emplace_back(std::fmod(i * 0.37, 33.0) - 1, std::fmod(i * 0.53, 12.0) - 1);
+            }
+            auto res = points_in_polygon(points, mp);
+            REQUIRE(res.size() == n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                CHECK(res[i] == (point_in_polygon(points[i].x, points[i].y, mp) ? 1 : 0));
+            }
+        }
+    }
+
+    SECTION("multipoint z")
+    {
+        auto res = points_in_polygon(MultiPointZ{{1, 1, 100}, {5, 5, 100}}, square);
+        CHECK(res == std::vector<uint8_t>{1, 0});
+    }
+}
@@ -1,4 +1,5 @@
 #include <ciso646>
+#include <cmath>
 #include <catch/catch.hpp>
 #include <simo/shapes.hpp>
 
@@ -777,4 +778,123 @@ TEST_CASE("Polygon")
             //            CHECK(m == -12.5);
         }
     }
+
+    SECTION("validity")
+    {
+        SECTION("valid")
+        {
+            CHECK(Polygon{}.is_valid());
+            CHECK(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}}.is_valid());
+            CHECK(Polygon{{{0, 0}, {4, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}}.is_valid());
+            CHECK(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{1, 1}, {1, 2}, {2, 2}, {2, 1}, {1, 1}}}.is_valid());
+            // a hole touching the shell at a vertex and another one at a point
+            CHECK(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}},
+                          {{0, 0}, {1, 2}, {2, 1}, {0, 0}},
+                          {{2, 1}, {3, 3}, {3, 1}, {2, 1}}}
+                      .is_valid());
+            // a hole touching the interior of a shell edge
+            CHECK(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{2, 0}, {3, 1}, {1, 1}, {2, 0}}}.is_valid());
+        }
+
+        SECTION("ring size and closure")
+        {
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {1, 0}, {0, 0}}}).throw_for_invalid(),
+                              "geometry error: Polygon ring should be either empty or with 4 or more points");
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {1, 0}, {1, 1}, {0, 1}}}).throw_for_invalid(),
+                              "geometry error: Polygon ring should be closed");
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {1, 0}, {1, 0}, {0, 0}}}).throw_for_invalid(),
+                              "geometry error: Polygon ring with less than 3 distinct points at POINT (0 0)");
+        }
+
+        SECTION("self-intersection")
+        {
+            // a bow-tie
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {2, 2}, {2, 0}, {0, 2}, {0, 0}}}).throw_for_invalid(),
+                              "geometry error: Polygon ring self-intersection at POINT (1 1)");
+            // a spike going back along the previous edge
+            CHECK_FALSE(Polygon{{{0, 0}, {4, 0}, {4, 4}, {4, 2}, {0, 4}, {0, 0}}}.is_valid());
+            // a ring touching itself
+            CHECK_FALSE(Polygon{{{0, 0}, {4, 0}, {2, 2}, {4, 4}, {0, 4}, {2, 2}, {0, 0}}}.is_valid());
+        }
+
+        SECTION("rings crossing")
+        {
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{3, 1}, {5, 1}, {5, 2}, {3, 2}, {3, 1}}})
+                                  .throw_for_invalid(),
+                              Catch::Matchers::StartsWith("geometry error: Polygon rings cross at POINT (4 "));
+            // an overlapping edge
+            CHECK_FALSE(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{1, 0}, {2, 0}, {2, 1}, {1, 0}}}.is_valid());
+            // crossing through a shell vertex and through a point of a shell edge
+            CHECK_FALSE(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{3, 3}, {5, 4}, {4, 5}, {3, 3}}}.is_valid());
+            CHECK_FALSE(Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{3, 1}, {4, 2}, {5, 1}, {3, 1}}}.is_valid());
+        }
+
+        SECTION("holes")
+        {
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}, {{5, 5}, {6, 5}, {6, 6}, {5, 5}}})
+                                  .throw_for_invalid(),
+                              "geometry error: Polygon hole lies outside the shell at POINT (5 5)");
+            CHECK_THROWS_WITH(Polygon({{{0, 0}, {9, 0}, {9, 9}, {0, 9}, {0, 0}},
+                                       {{1, 1}, {1, 8}, {8, 8}, {8, 1}, {1, 1}},
+                                       {{2, 2}, {2, 3}, {3, 3}, {2, 2}}})
+                                  .throw_for_invalid(),
+                              "geometry error: Polygon hole lies inside another hole at POINT (2 2)");
+        }
+
+        SECTION("validate")
+        {
+            auto res = Polygon{{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 0}}}.validate();
+            CHECK(res.valid());
+            CHECK(res.code == validity_code::VALID);
+
+            res = Polygon{{{0, 0}, {2, 2}, {2, 0}, {0, 2}, {0, 0}}}.validate();
+            CHECK(res.code == validity_code::SELF_INTERSECTION);
+            CHECK(res.x == 1.0);
+            CHECK(res.y == 1.0);
+
+            res = Polygon{{{0, 0}, {1, 0}, {1, 1}, {0, 1}}}.validate();
+            CHECK(res.code == validity_code::RING_NOT_CLOSED);
+            CHECK(std::isnan(res.x));
+            CHECK(res.message() == "Polygon ring should be closed");
+
+            auto mp = MultiPolygon{{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}}, {{{0, 0}, {1, 0}, {1, 1}, {0, 1}}}};
+            CHECK(mp.validate().code == validity_code::RING_NOT_CLOSED);
+            CHECK_FALSE(mp.is_valid());
+        }
+
+        SECTION("large ring")
+        {
+            // a jagged circle with a hundred thousand vertices, then its last vertex is moved across the first edge
+            LinearRing ring;
+            const size_t n = 100000;
+            for (size_t i = 0; i < n; ++i)
+            {
+                double angle  = 2 * 3.141592653589793 * static_cast<double>(i) / n;
+                double radius = i % 2 == 0 ? 10 : 9.99;
+                ring.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+            }
+            ring.push_back(ring.front());
+            Polygon jagged{ring};
+            CHECK(jagged.is_valid());
+            jagged[0][n - 1].x = 9.5;
+            jagged[0][n - 1].y = 0.5;
+            CHECK_FALSE(jagged.is_valid());
+        }
+    }
+
+    SECTION("coordinate types")
+    {
+        using polygon_f = polygon_t<float>;
+        auto pf         = polygon_f::from_wkt("POLYGON((0 0,4.5 0,4.5 4.5,0 0),(1 1,2 1,2 2,1 1))");
+        CHECK(pf.size() == 2);
+        CHECK(pf[0][1].x == 4.5f);
+        CHECK(polygon_f::from_json(pf.json()) == pf);
+        CHECK(pf.xy().size() == 8);
+        CHECK(pf.bounds().maxx == 4.5);
+        CHECK(area(pf) == Approx(10.125 - 0.5));
+
+        auto pi = polygon_t<int32_t>{{{0, 0}, {10, 0}, {10, 10}, {0, 0}}};
+        CHECK(pi.json() == R"json({"type":"Polygon","coordinates":[[[0,0],[10,0],[10,10],[0,0]]]})json");
+        CHECK(polygon_t<int32_t>::from_wkt(pi.wkt()) == pi);
+    }
 }
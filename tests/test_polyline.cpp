@@ -30,4 +30,17 @@ TEST_CASE("Polyline")
         CHECK(coords[4] == -126.453);
         CHECK(coords[5] == 43.252);
     }
-}
\ No newline at end of file
+
+    SECTION("zigzag")
+    {
+        CHECK(polyline::zigzag(0) == 0);
+        CHECK(polyline::zigzag(-1) == 1);
+        CHECK(polyline::zigzag(1) == 2);
+        CHECK(polyline::zigzag(-2) == 3);
+        CHECK(polyline::unzigzag(polyline::zigzag(2147483647)) == 2147483647);
+        CHECK(polyline::unzigzag(polyline::zigzag(-2147483647 - 1)) == -2147483647 - 1);
+
+        // a negative coordinate rounding to zero encodes zero
+        CHECK(polyline::encode(-0.000001) == polyline::encode(0));
+    }
+}
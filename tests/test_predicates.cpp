@@ -0,0 +1,105 @@
+#include <ciso646>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Predicates")
+{
+    // 10x10 square with a 2x2 hole in the middle
+    auto square = Polygon{
+        {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}},
+        {{4, 4}, {6, 4}, {6, 6}, {4, 6}, {4, 4}}};
+
+    SECTION("locate - polygon")
+    {
+        CHECK(locate(1, 1, square) == location::INTERIOR);
+        CHECK(locate(5, 5, square) == location::EXTERIOR);
+        CHECK(locate(11, 5, square) == location::EXTERIOR);
+        CHECK(locate(0, 5, square) == location::BOUNDARY);
+        CHECK(locate(4, 5, square) == location::BOUNDARY);
+        CHECK(locate(10, 10, square) == location::BOUNDARY);
+        CHECK(locate(1, 1, Polygon{}) == location::EXTERIOR);
+    }
+
+    SECTION("locate - implicitly closed ring")
+    {
+        auto triangle = Polygon{{{0, 0}, {4, 0}, {0, 4}}};
+        CHECK(locate(1, 1, triangle) == location::INTERIOR);
+        CHECK(locate(0, 2, triangle) == location::BOUNDARY);
+        CHECK(locate(3, 3, triangle) == location::EXTERIOR);
+    }
+
+    SECTION("locate - linestring")
+    {
+        auto ls = LineString{{0, 0}, {2, 0}, {2, 2}};
+        CHECK(locate(1, 0, ls) == location::INTERIOR);
+        CHECK(locate(2, 1, ls) == location::INTERIOR);
+        CHECK(locate(0, 0, ls) == location::BOUNDARY);
+        CHECK(locate(2, 2, ls) == location::BOUNDARY);
+        CHECK(locate(1, 1, ls) == location::EXTERIOR);
+    }
+
+    SECTION("locate - multipolygon")
+    {
+        auto mp = MultiPolygon{square, Polygon{{{20, 20}, {30, 20}, {30, 30}, {20, 20}}}};
+        CHECK(locate(25, 22, mp) == location::INTERIOR);
+        CHECK(locate(5, 5, mp) == location::EXTERIOR);
+        CHECK(point_in_polygon(25, 22, mp));
+        CHECK(point_in_polygon(0, 0, mp));
+        CHECK_FALSE(point_in_polygon(15, 15, mp));
+    }
+
+    SECTION("intersects")
+    {
+        CHECK(intersects(Point{1, 1}, square));
+        CHECK_FALSE(intersects(Point{5, 5}, square));
+        CHECK(intersects(square, Point{0, 3}));
+        CHECK(intersects(LineString{{-1, 5}, {1, 5}}, square));
+        CHECK(intersects(LineString{{1, 1}, {2, 2}}, square));
+        CHECK_FALSE(intersects(LineString{{4.5, 4.5}, {5.5, 5.5}}, square));
+        CHECK(intersects(LineString{{0, 0}, {2, 2}}, LineString{{0, 2}, {2, 0}}));
+        CHECK_FALSE(intersects(LineString{{0, 0}, {2, 2}}, LineString{{3, 0}, {5, 0}}));
+        CHECK(intersects(MultiPoint{{20, 20}, {1, 1}}, square));
+        CHECK(intersects(Polygon{{{1, 1}, {2, 1}, {2, 2}, {1, 1}}}, square));
+        CHECK(intersects(square, Polygon{{{1, 1}, {2, 1}, {2, 2}, {1, 1}}}));
+        CHECK_FALSE(intersects(Polygon{{{4.5, 4.5}, {5.5, 4.5}, {5, 5.5}, {4.5, 4.5}}}, square));
+        CHECK(intersects(Point{-3, -4}, Point{-3, -4}));
+        CHECK(disjoint(Point{-3, -4}, Point{-3, 4}));
+    }
+
+    SECTION("contains / within")
+    {
+        CHECK(contains(square, Point{1, 1}));
+        CHECK_FALSE(contains(square, Point{0, 1}));
+        CHECK_FALSE(contains(square, Point{5, 5}));
+        CHECK(within(Point{1, 1}, square));
+        CHECK(contains(square, LineString{{1, 1}, {3, 3}}));
+        CHECK(contains(square, LineString{{0, 1}, {3, 3}}));
+        CHECK_FALSE(contains(square, LineString{{0, 0}, {10, 0}}));
+        CHECK_FALSE(contains(square, LineString{{1, 1}, {9, 9}}));
+        CHECK(contains(square, Polygon{{{1, 1}, {3, 1}, {3, 3}, {1, 1}}}));
+        CHECK(contains(square, Polygon{{{0, 0}, {3, 0}, {3, 3}, {0, 0}}}));
+        CHECK_FALSE(contains(square, Polygon{{{1, 1}, {9, 1}, {9, 9}, {1, 9}, {1, 1}}}));
+        CHECK_FALSE(contains(square, Polygon{{{-1, 1}, {3, 1}, {3, 3}, {-1, 1}}}));
+        CHECK(contains(square, square));
+        CHECK_FALSE(contains(LineString{{0, 0}, {1, 1}}, square));
+        CHECK(contains(LineString{{0, 0}, {4, 4}}, LineString{{1, 1}, {2, 2}}));
+        CHECK(contains(LineString{{0, 0}, {4, 4}}, Point{2, 2}));
+        CHECK_FALSE(contains(LineString{{0, 0}, {4, 4}}, Point{0, 0}));
+        CHECK(contains(MultiPoint{{0, 0}, {1, 1}}, Point{1, 1}));
+        CHECK(within(MultiPoint{{1, 1}, {2, 2}}, square));
+    }
+
+    SECTION("distance / dwithin")
+    {
+        CHECK(distance(Point{0, 0}, Point{3, 4}) == Approx(5));
+        CHECK(distance(Point{1, 1}, square) == 0);
+        CHECK(distance(Point{5, 5}, square) == Approx(1));
+        CHECK(distance(Point{13, 14}, square) == Approx(5));
+        CHECK(distance(LineString{{12, 0}, {12, 10}}, square) == Approx(2));
+        CHECK(dwithin(Point{13, 14}, square, 5));
+        CHECK_FALSE(dwithin(Point{13, 14}, square, 4.9));
+        CHECK_FALSE(dwithin(Point{100, 100}, square, 1));
+    }
+}
@@ -0,0 +1,110 @@
+#include <ciso646>
+#include <cmath>
+#include <thread>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("PreparedPolygon")
+{
+    auto square = Polygon{
+        {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}},
+        {{4, 4}, {6, 4}, {6, 6}, {4, 6}, {4, 4}}};
+
+    SECTION("empty")
+    {
+        prepared_polygon pp;
+        CHECK(pp.empty());
+        CHECK(pp.locate(0, 0) == location::EXTERIOR);
+        CHECK(prepared_polygon(Polygon{}).empty());
+    }
+
+    SECTION("polygon with holes")
+    {
+        prepared_polygon pp(square);
+        CHECK(pp.size() == 8);
+        CHECK(pp.locate(1, 1) == location::INTERIOR);
+        CHECK(pp.locate(5, 5) == location::EXTERIOR);
+        CHECK(pp.locate(4, 5) == location::BOUNDARY);
+        CHECK(pp.locate(0, 0) == location::BOUNDARY);
+        CHECK(pp.locate(10, 10) == location::BOUNDARY);
+        CHECK(pp.locate(-1, 5) == location::EXTERIOR);
+        CHECK(pp.contains(9, 9));
+        CHECK_FALSE(pp.contains(10, 5));
+        CHECK(pp.intersects(10, 5));
+        CHECK(pp.bounds().minx == 0);
+        CHECK(pp.bounds().maxy == 10);
+    }
+
+    SECTION("matches locate - multipolygon")
+    {
+        auto mp = MultiPolygon{square, Polygon{{{20, 0}, {30, 5}, {20, 10}, {25, 5}, {20, 0}}}};
+        prepared_polygon pp(mp);
+        for (int i = -2; i <= 64; ++i)
+        {
+            for (int j = -2; j <= 24; ++j)
+            {
+                double x = i * 0.5;
+                double y = j * 0.5;
+                CHECK(pp.locate(x, y) == locate(x, y, mp));
+            }
+        }
+    }
+
+    SECTION("matches locate - tall edges")
+    {
+        // a comb whose teeth span the whole height
+        LinearRing ring{{0, 0}};
+        for (int i = 0; i < 100; ++i)
+        {
+            ring.emplace_back(i + 0.5, 100);
+            ring.emplace_back(i + 1, 1);
+        }
+        ring.emplace_back(100, 0);
+        ring.emplace_back(0, 0);
+        auto comb = Polygon{ring};
+        prepared_polygon pp(comb);
+        for (int i = 0; i < 2000; ++i)
+        {
+            double x = std::fmod(i * 7.31, 101.0);
+            double y = std::fmod(i * 3.17, 101.0);
+            CHECK(pp.locate(x, y) == locate(x, y, comb));
+        }
+    }
+
+    SECTION("not a number")
+    {
+        double nan = std::nan("");
+        prepared_polygon pp(Polygon{{{0, 0}, {10, 0}, {5, nan}, {10, 10}, {0, 10}, {0, 0}}});
+        CHECK(pp.size() == 5);
+        CHECK(pp.locate(1, nan) == location::EXTERIOR);
+    }
+
+    SECTION("shared between threads")
+    {
+        prepared_polygon pp(square);
+        std::vector<int> hits(4, 0);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < hits.size(); ++t)
+        {
+            threads.emplace_back([&pp, &hits, t] {
+                for (int i = 0; i < 100; ++i)
+                {
+                    for (int j = 0; j < 100; ++j)
+                    {
+                        hits[t] += pp.contains(i * 0.1 + 0.05, j * 0.1 + 0.05) ? 1 : 0;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (auto h : hits)
+        {
+            CHECK(h == 9600);
+        }
+    }
+}
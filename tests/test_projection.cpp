@@ -0,0 +1,163 @@
+#include <ciso646>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+/// the length of the meridian arc from the equator, by Simpson's rule
+double meridian_arc(double lat)
+{
+    double f   = geodesic::WGS84_F;
+    double e2  = f * (2 - f);
+    double phi = lat * geodesic::RADIANS;
+    size_t n   = 2000;
+    double h   = phi / static_cast<double>(n);
+    double sum = 0;
+    for (size_t i = 0; i <= n; ++i)
+    {
+        double s = std::sin(h * static_cast<double>(i));
+        double m = geodesic::WGS84_A * (1 - e2) / std::pow(1 - e2 * s * s, 1.5);
+        sum += (i == 0 or i == n ? 1 : (i % 2 == 1 ? 4 : 2)) * m;
+    }
+    return sum * h / 3;
+}
+
+}  // namespace
+
+TEST_CASE("Projection")
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> lngs(-180, 180);
+    std::uniform_real_distribution<double> lats(-85, 85);
+    constexpr double pi = 3.14159265358979323846;
+
+    SECTION("utm zone")
+    {
+        CHECK(projection::utm_zone(-180) == 1);
+        CHECK(projection::utm_zone(-177) == 1);
+        CHECK(projection::utm_zone(3) == 31);
+        CHECK(projection::utm_zone(179.9) == 60);
+        CHECK(projection::utm_zone(180) == 60);
+    }
+
+    SECTION("web mercator")
+    {
+        LineString ls;
+        for (size_t i = 0; i < 1001; ++i)
+        {
+            ls.push_back({lngs(gen), lats(gen)});
+        }
+        auto original = ls;
+        projection::to_web_mercator(ls);
+        for (size_t i = 0; i < ls.size(); ++i)
+        {
+            double phi = original[i].y * pi / 180;
+            double y   = projection::WEB_MERCATOR_RADIUS * std::log(std::tan(pi / 4 + phi / 2));
+            CHECK(ls[i].x == Approx(projection::WEB_MERCATOR_RADIUS * original[i].x * pi / 180).margin(1e-6));
+            CHECK(ls[i].y == Approx(y).margin(1e-6));
+        }
+        projection::from_web_mercator(ls);
+        for (size_t i = 0; i < ls.size(); ++i)
+        {
+            CHECK(ls[i].x == Approx(original[i].x).margin(1e-12));
+            CHECK(ls[i].y == Approx(original[i].y).margin(1e-12));
+        }
+
+        // the corners of the Web Mercator square, the latitudes are clamped
+        MultiPoint mp = {{-180, 90}, {180, -90}};
+        projection::to_web_mercator(mp);
+        double half = projection::WEB_MERCATOR_RADIUS * pi;
+        CHECK(mp[0].x == Approx(-half));
+        CHECK(mp[0].y == Approx(half));
+        CHECK(mp[1].x == Approx(half));
+        CHECK(mp[1].y == Approx(-half));
+    }
+
+    SECTION("utm")
+    {
+        // the northing on the central meridian is the scaled meridian arc
+        std::vector<double> meridian_lats = {0, 15, 30, 45, 60, 75, 84};
+        LineString meridian;
+        for (auto lat : meridian_lats)
+        {
+            meridian.push_back({3, lat});
+        }
+        projection::to_utm(meridian, 31);
+        for (size_t i = 0; i < meridian.size(); ++i)
+        {
+            CHECK(meridian[i].x == Approx(projection::UTM_FALSE_EASTING).margin(1e-6));
+            CHECK(meridian[i].y == Approx(0.9996 * meridian_arc(meridian_lats[i])).margin(1e-3));
+        }
+
+        // the southern hemisphere
+        Point p(-3, -45);
+        projection::to_utm(p, 30, false);
+        CHECK(p.x == Approx(projection::UTM_FALSE_EASTING).margin(1e-6));
+        CHECK(p.y == Approx(projection::UTM_FALSE_NORTHING - 0.9996 * meridian_arc(45)).margin(1e-3));
+        projection::from_utm(p, 30, false);
+        CHECK(p.x == Approx(-3).margin(1e-12));
+        CHECK(p.y == Approx(-45).margin(1e-12));
+
+        // roundtrips within 9 degrees of the central meridian, below 1 mm
+        std::uniform_real_distribution<double> offsets(-9, 9);
+        std::uniform_real_distribution<double> utm_lats(-80, 84);
+        Polygon polygon;
+        polygon.resize(2);
+        for (size_t i = 0; i < 1001; ++i)
+        {
+            polygon[i % 2].push_back({15 + offsets(gen), utm_lats(gen)});
+        }
+        auto original = polygon;
+        projection::to_utm(polygon, 33);
+        projection::from_utm(polygon, 33);
+        for (size_t r = 0; r < polygon.size(); ++r)
+        {
+            for (size_t i = 0; i < polygon[r].size(); ++i)
+            {
+                CHECK(polygon[r][i].x == Approx(original[r][i].x).margin(1e-8));
+                CHECK(polygon[r][i].y == Approx(original[r][i].y).margin(1e-8));
+            }
+        }
+
+        // symmetric about the central meridian and the equator
+        MultiPoint mp = {{9, 30}, {21, 30}, {9, -30}};
+        projection::to_utm(mp, 33);
+        CHECK(mp[0].x + mp[1].x == Approx(2 * projection::UTM_FALSE_EASTING));
+        CHECK(mp[0].y == Approx(mp[1].y));
+        CHECK(mp[2].y == Approx(-mp[0].y));
+
+        CHECK_THROWS_AS(projection::to_utm(mp, 0), exceptions::geometry_error);
+        CHECK_THROWS_AS(projection::from_utm(mp, 61), exceptions::geometry_error);
+    }
+
+    SECTION("geometries")
+    {
+        // every point of every part, with the z coordinates unchanged
+        MultiLineStringZ mls = {{{10, 20, 1}, {11, 21, 2}, {12, 22, 3}}, {{13, 23, 4}}};
+        projection::to_web_mercator(mls);
+        CHECK(mls[1][0].x == Approx(projection::WEB_MERCATOR_RADIUS * 13 * pi / 180));
+        CHECK(mls[0][2].z == 3);
+        CHECK(mls[1][0].z == 4);
+        projection::from_web_mercator(mls);
+        CHECK(mls[0][1].x == Approx(11));
+        CHECK(mls[0][1].y == Approx(21));
+
+        MultiPolygon mpoly = {{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}}, {{{2, 2}, {3, 2}, {3, 3}, {2, 2}}}};
+        auto original      = mpoly;
+        projection::to_web_mercator(mpoly);
+        CHECK(mpoly[1][0][2].y > 300000);
+        projection::from_web_mercator(mpoly);
+        CHECK(mpoly[1][0][2].x == Approx(original[1][0][2].x));
+        CHECK(mpoly[1][0][2].y == Approx(original[1][0][2].y));
+
+        LineString empty;
+        projection::to_utm(empty, 1);
+        CHECK(empty.empty());
+    }
+}
@@ -0,0 +1,128 @@
+#include <ciso646>
+#include <algorithm>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Quadkey")
+{
+    SECTION("cells of points")
+    {
+        auto c = quadkey::from_point(-122.4, 47.6, 10);
+        CHECK(c.level == 10);
+        CHECK(c.x == 163);
+        CHECK(c.y == 357);
+        CHECK(quadkey::from_point(Point(0.1, 0.1), 1) == quadkey::cell{1, 1, 0});
+        CHECK(quadkey::from_point(-180, 90, 5) == quadkey::cell{5, 0, 0});
+        CHECK(quadkey::from_point(180, -90, 5) == quadkey::cell{5, 31, 31});
+        CHECK(quadkey::from_point(0, 0, 0) == quadkey::cell{0, 0, 0});
+        CHECK_THROWS_AS(quadkey::from_point(0, 0, 31), exceptions::geometry_error);
+    }
+
+    SECTION("bounds")
+    {
+        auto b = quadkey::bounds(quadkey::cell{0, 0, 0});
+        CHECK(b.minx == -180);
+        CHECK(b.maxx == 180);
+        CHECK(b.maxy == Approx(quadkey::MAX_LATITUDE));
+        CHECK(b.miny == Approx(-quadkey::MAX_LATITUDE));
+
+        auto c = quadkey::from_point(-122.4, 47.6, 10);
+        b      = quadkey::bounds(c);
+        CHECK(b.contains(-122.4, 47.6));
+        CHECK(b.maxx - b.minx == Approx(360.0 / 1024));
+        CHECK(quadkey::bounds(quadkey::cell{1, 1, 0}).miny == Approx(0).margin(1e-12));
+    }
+
+    SECTION("navigation")
+    {
+        auto c = quadkey::cell{3, 3, 5};
+        CHECK(quadkey::to_string(c) == "213");
+        CHECK(quadkey::from_string("213") == c);
+        CHECK(quadkey::to_string(quadkey::cell{0, 0, 0}).empty());
+        CHECK(quadkey::parent(c) == quadkey::cell{2, 1, 2});
+        CHECK(quadkey::to_string(quadkey::parent(c)) == "21");
+        CHECK(quadkey::parent(quadkey::cell{0, 0, 0}) == quadkey::cell{0, 0, 0});
+
+        auto children = quadkey::children(c);
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            CHECK(quadkey::to_string(children[i]) == "213" + std::to_string(i));
+            CHECK(quadkey::parent(children[i]) == c);
+            CHECK(quadkey::id(children[i]) >> 2 == quadkey::id(c));
+        }
+
+        CHECK(quadkey::id(quadkey::cell{0, 0, 0}) == 1);
+        CHECK(quadkey::id(quadkey::cell{1, 0, 0}) != quadkey::id(quadkey::cell{2, 0, 0}));
+        CHECK(quadkey::from_id(quadkey::id(c)) == c);
+        auto deep = quadkey::cell{30, 123456789, 987654321};
+        CHECK(quadkey::from_id(quadkey::id(deep)) == deep);
+        CHECK(quadkey::from_string(quadkey::to_string(deep)) == deep);
+
+        CHECK_THROWS_AS(quadkey::from_string("214"), exceptions::parse_error);
+        CHECK_THROWS_AS(quadkey::from_string(std::string(31, '0')), exceptions::parse_error);
+    }
+
+    SECTION("cover")
+    {
+        std::vector<quadkey::cell> interior;
+        std::vector<quadkey::cell> boundary;
+
+        // a square inside the north east quarter
+        Polygon square = {{{1, 1}, {89, 1}, {89, 60}, {1, 60}, {1, 1}}};
+        quadkey::cover(square, 0, 6, interior, boundary);
+        CHECK_FALSE(interior.empty());
+        CHECK_FALSE(boundary.empty());
+        for (const auto& c : boundary)
+        {
+            CHECK(c.level == 6);
+            CHECK(quadkey::bounds(c).intersects(square.bounds()));
+        }
+        for (const auto& c : interior)
+        {
+            auto b = quadkey::bounds(c);
+            CHECK(square.bounds().contains(b));
+        }
+        // the covers do not overlap and contain every point of the square
+        for (double x = 1.3; x < 89; x += 2)
+        {
+            for (double y = 1.3; y < 60; y += 2)
+            {
+                size_t count = 0;
+                for (const auto& c : interior)
+                {
+                    count += quadkey::bounds(c).contains(x, y) ? 1 : 0;
+                }
+                for (const auto& c : boundary)
+                {
+                    count += quadkey::bounds(c).contains(x, y) ? 1 : 0;
+                }
+                CHECK(count == 1);
+            }
+        }
+        // a coarse interior cell
+        CHECK(std::any_of(interior.begin(), interior.end(), [](const quadkey::cell& c) { return c.level < 5; }));
+
+        // the interior cells are not coarser than the minimum level
+        quadkey::cover(square, 5, 6, interior, boundary);
+        CHECK(std::all_of(interior.begin(), interior.end(), [](const quadkey::cell& c) { return c.level >= 5; }));
+
+        // the cells in a hole are left out
+        Polygon holed = {{{1, 1}, {89, 1}, {89, 60}, {1, 60}, {1, 1}}, {{20, 20}, {20, 40}, {70, 40}, {70, 20}, {20, 20}}};
+        quadkey::cover(holed, 0, 6, interior, boundary);
+        for (const auto& c : interior)
+        {
+            CHECK_FALSE(quadkey::bounds(c).contains(45, 30));
+        }
+        for (const auto& c : boundary)
+        {
+            CHECK_FALSE(quadkey::bounds(c).contains(45, 30));
+        }
+
+        quadkey::cover(Polygon(), 0, 6, interior, boundary);
+        CHECK(interior.empty());
+        CHECK(boundary.empty());
+        CHECK_THROWS_AS(quadkey::cover(square, 7, 6, interior, boundary), exceptions::geometry_error);
+    }
+}
@@ -0,0 +1,135 @@
+#include <ciso646>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+namespace
+{
+
+struct Vec2d
+{
+    double x;
+    double y;
+};
+
+// the latitude first, the coordinates are swapped
+struct LatLng
+{
+    double lat;
+    double lng;
+};
+
+struct Vec3f
+{
+    float x;
+    float y;
+    float z;
+};
+
+// the coordinates have the size of the coordinate type, not its type
+struct Mixed
+{
+    int32_t x;
+    float y;
+};
+
+// the members are in a base and in the derived type, not a standard layout
+struct Base
+{
+    double x;
+};
+
+struct Derived : Base
+{
+    double y;
+};
+
+}  // namespace
+
+SHAPES_REGISTER_POINT_2D(Vec2d, double, x, y)
+SHAPES_REGISTER_POINT_2D(LatLng, double, lng, lat)
+SHAPES_REGISTER_POINT_3D(Vec3f, float, x, y, z)
+SHAPES_REGISTER_POINT_2D(Mixed, int32_t, x, y)
+SHAPES_REGISTER_POINT_2D(Derived, double, x, y)
+
+using namespace simo::shapes;
+
+TEST_CASE("Register")
+{
+    SECTION("traits")
+    {
+        static_assert(is_registered_point<Vec2d>::value, "Vec2d");
+        static_assert(not is_registered_point<int>::value, "int");
+        static_assert(point_traits<Vec2d>::packed, "x then y");
+        static_assert(not point_traits<LatLng>::packed, "y then x");
+        static_assert(point_traits<Vec3f>::packed, "x, y then z");
+        static_assert(std::is_same<registered_point_t<Vec3f>, basic_point_z<float>>::value, "xyz");
+        static_assert(not point_traits<Mixed>::packed, "a float y");
+        static_assert(not point_traits<Derived>::packed, "not a standard layout");
+
+        CHECK(point_cast(Vec2d{1, 2}) == Point(1, 2));
+        CHECK(point_cast(LatLng{48.85, 2.35}) == Point(2.35, 48.85));
+        CHECK(point_cast(Vec3f{1, 2, 3}) == basic_point_z<float>(1, 2, 3));
+    }
+
+    SECTION("views")
+    {
+        std::vector<Vec2d> points = {{0, 0}, {3, 0}, {3, 4}};
+        auto view                 = make_linestring_view(points.data(), points.size());
+        CHECK(view.size() == 3);
+        CHECK(view.wkt() == "LINESTRING(0 0,3 0,3 4)");
+        CHECK(view.bounds().maxy == 4);
+        CHECK(length(view) == Approx(7));
+
+        // the points are borrowed
+        points[1].x = 0;
+        CHECK(view[1] == Point(0, 0));
+
+        std::vector<Vec3f> points_3d = {{0, 0, 0}, {1, 2, 2}};
+        auto view_3d                 = make_linestring_view(points_3d.data(), points_3d.size());
+        CHECK(view_3d.has_z());
+        CHECK(length(view_3d) == Approx(3));
+    }
+
+    SECTION("polygon views")
+    {
+        // a square, then a triangle with the offsets in coordinates
+        std::vector<Vec2d> points  = {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}, {5, 5}, {6, 5}, {6, 6}, {5, 5}};
+        std::vector<size_t> rings = {10, 18};
+        auto square               = make_polygon_view(points.data(), 5, rings.data(), 1);
+        CHECK(square.wkt() == "POLYGON((0 0,2 0,2 2,0 2,0 0))");
+        CHECK(area(square) == Approx(4));
+        CHECK_THROWS_AS(make_polygon_view(points.data(), 4, rings.data(), 1), exceptions::geometry_error);
+
+        std::vector<size_t> polygons = {1, 2};
+        auto mp = make_multipolygon_view(points.data(), points.size(), rings.data(), rings.size(), polygons.data(),
+                                         polygons.size());
+        CHECK(mp.size() == 2);
+        CHECK(mp[1][0][2] == Point(6, 6));
+        CHECK(area(mp) == Approx(4.5));
+        CHECK_THROWS_AS(make_multipolygon_view(points.data(), points.size(), rings.data(), 1, polygons.data(), polygons.size()),
+                        exceptions::geometry_error);
+    }
+
+    SECTION("linestrings")
+    {
+        std::vector<Vec2d> points = {{1, 2}, {3, 4}};
+        CHECK(make_linestring(points.begin(), points.end()) == LineString({{1, 2}, {3, 4}}));
+        CHECK(make_linestring(points.data(), points.data() + 1) == LineString({{1, 2}}));
+
+        std::vector<LatLng> cities = {{48.85, 2.35}, {51.51, -0.13}};
+        auto ls                    = make_linestring(cities.begin(), cities.end());
+        CHECK(ls == LineString({{2.35, 48.85}, {-0.13, 51.51}}));
+        CHECK(ls.polyline() == make_linestring(cities.data(), cities.data() + 2).polyline());
+
+        std::vector<Mixed> mixed = {{1, 2.5f}, {3, 4.5f}};
+        CHECK(make_linestring(mixed.begin(), mixed.end()) == basic_linestring<basic_point<int32_t>>({{1, 2}, {3, 4}}));
+        Derived derived;
+        derived.x = 1;
+        derived.y = 2;
+        CHECK(make_linestring(&derived, &derived + 1) == LineString({{1, 2}}));
+
+        std::vector<Vec3f> empty;
+        CHECK(make_linestring(empty.begin(), empty.end()).empty());
+    }
+}
@@ -0,0 +1,144 @@
+#include <ciso646>
+#include <cmath>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("Simplify")
+{
+    SECTION("douglas-peucker linestring")
+    {
+        auto ls = LineString{{0, 0}, {1, 0.1}, {2, -0.1}, {3, 5}, {4, 6}, {5, 7}, {6, 8.1}, {7, 9}, {8, 9}, {9, 9}};
+        simplify(ls, 1.0);
+        CHECK(ls == LineString{{0, 0}, {2, -0.1}, {3, 5}, {7, 9}, {9, 9}});
+
+        simplify(ls, 100);
+        CHECK(ls == LineString{{0, 0}, {9, 9}});
+
+        auto two = LineString{{0, 0}, {1, 1}};
+        simplify(two, 100);
+        CHECK(two.size() == 2);
+    }
+
+    SECTION("douglas-peucker zero tolerance keeps the corners")
+    {
+        auto ls = LineString{{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}};
+        simplify(ls, 0);
+        CHECK(ls == LineString{{0, 0}, {2, 0}, {2, 2}});
+    }
+
+    SECTION("douglas-peucker keeps z")
+    {
+        auto ls = LineStringZ{{0, 0, 1}, {1, 0.01, 2}, {2, 0, 3}};
+        simplify(ls, 0.1);
+        CHECK(ls == LineStringZ{{0, 0, 1}, {2, 0, 3}});
+    }
+
+    SECTION("douglas-peucker long linestring")
+    {
+        // deep enough to overflow a recursive implementation with a small stack
+        LineString ls;
+        for (size_t i = 0; i < 200000; ++i)
+        {
+            ls.emplace_back(static_cast<double>(i), static_cast<double>(i * i));
+        }
+        simplify(ls, 1e-9);
+        CHECK(ls.size() == 200000);
+        simplify(ls, 1e12);
+        CHECK(ls.size() == 2);
+    }
+
+    SECTION("visvalingam linestring")
+    {
+        auto ls = LineString{{0, 0}, {1, 0.1}, {2, 0}, {3, 3}, {4, 0}, {5, 0.05}, {6, 0}};
+        simplify(ls, 0.5, simplify_method::VISVALINGAM);
+        CHECK(ls == LineString{{0, 0}, {2, 0}, {3, 3}, {4, 0}, {6, 0}});
+
+        simplify(ls, 5, simplify_method::VISVALINGAM);
+        CHECK(ls == LineString{{0, 0}, {3, 3}, {6, 0}});
+
+        simplify(ls, 100, simplify_method::VISVALINGAM);
+        CHECK(ls == LineString{{0, 0}, {6, 0}});
+    }
+
+    SECTION("polygon")
+    {
+        auto polygon = Polygon{
+            {{0, 0}, {5, 0.1}, {10, 0}, {10, 10}, {5, 10.1}, {0, 10}, {0, 0}},
+            {{4, 4}, {4.1, 4.1}, {4, 4.2}, {4, 4}},
+            {{2, 2}, {3, 2}, {3, 3}, {2, 3}, {2, 2}}};
+        simplify(polygon, 0.5);
+        REQUIRE(polygon.size() == 2);
+        CHECK(polygon[0] == LinearRing{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}});
+        CHECK(polygon[1] == LinearRing{{2, 2}, {3, 2}, {3, 3}, {2, 3}, {2, 2}});
+
+        // the shell collapses
+        simplify(polygon, 100);
+        CHECK(polygon.empty());
+    }
+
+    SECTION("polygon visvalingam")
+    {
+        auto polygon = Polygon{{{0, 0}, {5, 0.1}, {10, 0}, {10, 10}, {5, 10.1}, {0, 10}, {0, 0}}};
+        simplify(polygon, 1, simplify_method::VISVALINGAM);
+        REQUIRE(polygon.size() == 1);
+        CHECK(polygon[0] == LinearRing{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}});
+    }
+
+    SECTION("multi geometries")
+    {
+        auto mls = MultiLineString{{{0, 0}, {1, 0.1}, {2, 0}}, {{0, 0}, {1, 5}, {2, 0}}};
+        simplify(mls, 1);
+        CHECK(mls == MultiLineString{{{0, 0}, {2, 0}}, {{0, 0}, {1, 5}, {2, 0}}});
+
+        auto mp = MultiPolygon{Polygon{{{0, 0}, {0.1, 0}, {0.1, 0.1}, {0, 0}}},
+                               Polygon{{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}}}};
+        simplify(mp, 1);
+        REQUIRE(mp.size() == 1);
+        CHECK(mp[0][0].size() == 5);
+    }
+
+    SECTION("parallel")
+    {
+        MultiPolygon serial;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            LinearRing ring;
+            for (size_t k = 0; k < 100; ++k)
+            {
+                double angle = 2 * std::acos(-1.0) * static_cast<double>(k) / 100;
+                double r     = 1 + 0.1 * std::sin(7 * angle) + 0.01 * static_cast<double>(i);
+                ring.emplace_back(10 * static_cast<double>(i) + r * std::cos(angle), r * std::sin(angle));
+            }
+            ring.push_back(ring.front());
+            serial.push_back(Polygon{ring});
+        }
+        auto parallel = serial;
+        auto visvalingam = serial;
+        auto visvalingam_parallel = serial;
+
+        thread_pool pool(4);
+        simplify(serial, 0.05);
+        simplify(parallel, 0.05, simplify_method::DOUGLAS_PEUCKER, pool);
+        CHECK(serial == parallel);
+        CHECK(serial[0][0].size() < 100);
+
+        simplify(visvalingam, 0.01, simplify_method::VISVALINGAM);
+        simplify(visvalingam_parallel, 0.01, simplify_method::VISVALINGAM, pool);
+        CHECK(visvalingam == visvalingam_parallel);
+
+        auto ls = LineString{{0, 0}, {1, 0.1}, {2, 0}};
+        simplify(ls, 1, simplify_method::DOUGLAS_PEUCKER, pool);
+        CHECK(ls.size() == 2);
+        auto p = Point(1, 2);
+        simplify(p, 1, simplify_method::DOUGLAS_PEUCKER, pool);
+        CHECK(p == Point(1, 2));
+        MultiPoint mp;
+        simplify(mp, 1, simplify_method::DOUGLAS_PEUCKER, pool);
+        CHECK(mp.empty());
+        mp = MultiPoint{{0, 0}, {1, 0.1}, {2, 0}};
+        simplify(mp, 1, simplify_method::DOUGLAS_PEUCKER, pool);
+        CHECK(mp.size() == 3);
+    }
+}
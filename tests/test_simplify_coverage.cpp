@@ -0,0 +1,114 @@
+#include <ciso646>
+#include <algorithm>
+#include <cmath>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+// a wobbly border from (10, 0) to (10, 10)
+LinearRing border()
+{
+    LinearRing res;
+    for (size_t i = 0; i <= 100; ++i)
+    {
+        double y = static_cast<double>(i) / 10;
+        res.emplace_back(10 + 0.2 * std::sin(y * 3), y);
+    }
+    return res;
+}
+
+Polygon left()
+{
+    auto b = border();
+    LinearRing shell{{0, 0}};
+    shell.insert(shell.end(), b.begin(), b.end());
+    shell.emplace_back(0, 10);
+    shell.emplace_back(0, 0);
+    return Polygon{shell};
+}
+
+Polygon right()
+{
+    auto b = border();
+    LinearRing shell{{20, 0}, {20, 10}};
+    shell.insert(shell.end(), b.rbegin(), b.rend());
+    shell.emplace_back(20, 0);
+    return Polygon{shell};
+}
+
+std::vector<Point> border_vertices(const Polygon& polygon)
+{
+    std::vector<Point> res;
+    for (const auto& p : polygon[0])
+    {
+        if (p.x > 9 and p.x < 11)
+        {
+            res.emplace_back(p.x, p.y);
+        }
+    }
+    std::sort(res.begin(), res.end(), [](const Point& a, const Point& b) { return a.y < b.y or (a.y == b.y and a.x < b.x); });
+    res.erase(std::unique(res.begin(), res.end()), res.end());
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("SimplifyCoverage")
+{
+    SECTION("shared border")
+    {
+        std::vector<Polygon> polygons{left(), right()};
+        double before = area(polygons[0]) + area(polygons[1]);
+        CHECK(simplify_coverage(polygons, 0.05) == 3);
+        CHECK(polygons[0][0].size() < left()[0].size());
+        CHECK(border_vertices(polygons[0]) == border_vertices(polygons[1]));
+        // no gaps nor overlaps
+        CHECK(area(polygons[0]) + area(polygons[1]) == Approx(before));
+        CHECK(area(polygons[0]) + area(polygons[1]) == Approx(200));
+    }
+
+    SECTION("visvalingam")
+    {
+        std::vector<Polygon> polygons{left(), right()};
+        simplify_coverage(polygons, 0.01, simplify_method::VISVALINGAM);
+        CHECK(polygons[0][0].size() < left()[0].size());
+        CHECK(border_vertices(polygons[0]) == border_vertices(polygons[1]));
+        CHECK(area(polygons[0]) + area(polygons[1]) == Approx(200));
+    }
+
+    SECTION("island filling a hole")
+    {
+        LinearRing island;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            double angle = 2 * std::acos(-1.0) * static_cast<double>(i) / 50;
+            island.emplace_back(5 + 2 * std::cos(angle), 5 + 2 * std::sin(angle));
+        }
+        island.push_back(island.front());
+        LinearRing hole = island;
+        std::reverse(hole.begin(), hole.end());
+        std::vector<MultiPolygon> geoms{
+            MultiPolygon{Polygon{{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}}, hole}},
+            MultiPolygon{Polygon{island}}};
+        CHECK(simplify_coverage(geoms, 0.1) == 2);
+        REQUIRE(geoms[0][0].size() == 2);
+        CHECK(geoms[0][0][1].size() < 51);
+        CHECK(area(geoms[0]) + area(geoms[1]) == Approx(100));
+    }
+
+    SECTION("collapsed polygons")
+    {
+        std::vector<MultiPolygon> geoms{
+            MultiPolygon{Polygon{{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}}},
+                         Polygon{{{20, 0}, {20.1, 0}, {20.1, 0.1}, {20, 0}}}},
+            MultiPolygon{Polygon{{{30, 0}, {30.1, 0}, {30.1, 0.1}, {30, 0}}}}};
+        simplify_coverage(geoms, 1);
+        REQUIRE(geoms.size() == 2);
+        CHECK(geoms[0].size() == 1);
+        CHECK(geoms[1].empty());
+    }
+}
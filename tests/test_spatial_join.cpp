@@ -0,0 +1,122 @@
+#include <ciso646>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+std::vector<std::pair<size_t, size_t>> nested_loop(const std::vector<Point>& points, const std::vector<MultiPolygon>& zones,
+                                                    spatial_predicate predicate, double d)
+{
+    std::vector<std::pair<size_t, size_t>> res;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        for (size_t j = 0; j < zones.size(); ++j)
+        {
+            bool match = false;
+            switch (predicate)
+            {
+                case spatial_predicate::WITHIN:
+                    match = within(points[i], zones[j]);
+                    break;
+                case spatial_predicate::DWITHIN:
+                    match = dwithin(points[i], zones[j], d);
+                    break;
+                default:
+                    match = intersects(points[i], zones[j]);
+                    break;
+            }
+            if (match)
+            {
+                res.emplace_back(i, j);
+            }
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("SpatialJoin")
+{
+    std::vector<MultiPolygon> zones;
+    for (int i = 0; i < 10; ++i)
+    {
+        for (int j = 0; j < 10; ++j)
+        {
+            double x = i * 10;
+            double y = j * 10;
+            zones.push_back(MultiPolygon{
+                Polygon{{{x, y}, {x + 6, y}, {x + 6, y + 6}, {x, y + 6}, {x, y}}},
+                Polygon{{{x + 7, y + 7}, {x + 9, y + 7}, {x + 8, y + 9}, {x + 7, y + 7}}}});
+        }
+    }
+    std::vector<Point> points;
+    for (int i = 0; i < 400; ++i)
+    {
+        points.emplace_back((i * 37) % 101 - 0.5, (i * 53) % 103 - 0.5);
+    }
+    points.emplace_back(6, 3);
+
+    SECTION("intersects - single thread")
+    {
+        spatial_join_options options;
+        options.num_threads = 1;
+        auto res            = spatial_join(points, zones, spatial_predicate::INTERSECTS, options);
+        CHECK(not res.empty());
+        CHECK(res == nested_loop(points, zones, spatial_predicate::INTERSECTS, 0));
+    }
+
+    SECTION("within - thread pool")
+    {
+        spatial_join_options options;
+        options.chunk_size = 7;
+        thread_pool pool(4);
+        auto res = spatial_join(points, zones, spatial_predicate::WITHIN, pool, options);
+        CHECK(res == nested_loop(points, zones, spatial_predicate::WITHIN, 0));
+        CHECK(std::find(res.begin(), res.end(), std::make_pair(points.size() - 1, size_t{0})) == res.end());
+    }
+
+    SECTION("called from a pool thread")
+    {
+        spatial_join_options options;
+        options.chunk_size = 7;
+        thread_pool pool(1);
+        auto res = pool.submit([&] { return spatial_join(points, zones, spatial_predicate::INTERSECTS, pool, options); });
+        CHECK(res.get() == nested_loop(points, zones, spatial_predicate::INTERSECTS, 0));
+    }
+
+    SECTION("contains")
+    {
+        spatial_join_options options;
+        options.num_threads = 3;
+        options.chunk_size  = 5;
+        auto res            = spatial_join(zones, points, spatial_predicate::CONTAINS, options);
+        auto expected       = nested_loop(points, zones, spatial_predicate::WITHIN, 0);
+        CHECK(res.size() == expected.size());
+        for (const auto& pair : res)
+        {
+            CHECK(within(points[pair.second], zones[pair.first]));
+        }
+    }
+
+    SECTION("dwithin")
+    {
+        spatial_join_options options;
+        options.num_threads = 2;
+        options.chunk_size  = 16;
+        options.distance    = 1.5;
+        auto res            = spatial_join(points, zones, spatial_predicate::DWITHIN, options);
+        CHECK(res == nested_loop(points, zones, spatial_predicate::DWITHIN, 1.5));
+        CHECK(res.size() > nested_loop(points, zones, spatial_predicate::INTERSECTS, 0).size());
+    }
+
+    SECTION("empty")
+    {
+        std::vector<Point> none;
+        CHECK(spatial_join(none, zones, spatial_predicate::INTERSECTS).empty());
+        CHECK(spatial_join(points, std::vector<MultiPolygon>{}, spatial_predicate::INTERSECTS).empty());
+    }
+}
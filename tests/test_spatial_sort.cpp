@@ -0,0 +1,125 @@
+#include <ciso646>
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("SpatialSort")
+{
+    auto extent = bounds_t{0, 0, 4, 4};
+
+    SECTION("morton keys")
+    {
+        CHECK(morton_key(0.5, 0.5, extent) >> 60 == 0);
+        CHECK(morton_key(3.5, 0.5, extent) >> 60 == 10);
+        CHECK(morton_key(0.5, 3.5, extent) >> 60 == 5);
+        CHECK(morton_key(Point(3.5, 3.5), extent) >> 60 == 15);
+        // clamped to the extent
+        CHECK(morton_key(-10, -10, extent) == 0);
+        CHECK(morton_key(10, 10, extent) == UINT64_MAX);
+    }
+
+    SECTION("hilbert keys")
+    {
+        // the first order curve over a 4 by 4 grid, from the bottom row up
+        std::vector<uint64_t> expected = {0, 1, 14, 15, 3, 2, 13, 12, 4, 7, 8, 11, 5, 6, 9, 10};
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            double x = static_cast<double>(i % 4) + 0.5;
+            double y = static_cast<double>(i / 4) + 0.5;
+            CHECK(hilbert_key(x, y, extent) >> 60 == expected[i]);
+        }
+
+        // consecutive keys are neighbour cells
+        std::vector<std::pair<uint64_t, std::pair<int, int>>> cells;
+        auto grid = bounds_t{0, 0, 256, 256};
+        for (int x = 0; x < 256; ++x)
+        {
+            for (int y = 0; y < 256; ++y)
+            {
+                cells.push_back({hilbert_key(Point(x + 0.5, y + 0.5), grid), {x, y}});
+            }
+        }
+        std::sort(cells.begin(), cells.end());
+        size_t jumps = 0;
+        for (size_t i = 1; i < cells.size(); ++i)
+        {
+            const auto& a = cells[i - 1].second;
+            const auto& b = cells[i].second;
+            jumps += std::abs(a.first - b.first) + std::abs(a.second - b.second) == 1 ? 0 : 1;
+        }
+        CHECK(jumps == 0);
+    }
+
+    SECTION("batch keys")
+    {
+        MultiPoint points = {{0.5, 0.5}, {3.5, 1}, {2, 2.5}, {-1, 5}};
+        std::vector<uint64_t> keys = {42};
+        hilbert_keys(points, extent, keys);
+        REQUIRE(keys.size() == 4);
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(keys[i] == hilbert_key(points[i], extent));
+        }
+        morton_keys(points, extent, keys);
+        REQUIRE(keys.size() == 4);
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(keys[i] == morton_key(points[i], extent));
+        }
+
+        std::vector<bounds_t> boxes = {{0, 0, 1, 1}, {2, 1, 4, 3}};
+        hilbert_keys(boxes, extent, keys);
+        CHECK(keys == std::vector<uint64_t>{hilbert_key(0.5, 0.5, extent), hilbert_key(3, 2, extent)});
+        morton_keys(boxes, extent, keys);
+        CHECK(keys == std::vector<uint64_t>{morton_key(0.5, 0.5, extent), morton_key(3, 2, extent)});
+    }
+
+    SECTION("spatial sort")
+    {
+        std::vector<Point> points;
+        for (int i = 0; i < 64; ++i)
+        {
+            points.emplace_back(i % 8, i / 8);
+        }
+        std::shuffle(points.begin(), points.end(), std::mt19937(3));
+        auto serial = points;
+        spatial_sort(serial.begin(), serial.end());
+        auto b = bounds_t{0, 0, 7, 7};
+        CHECK(std::is_sorted(serial.begin(), serial.end(), [&](const Point& p, const Point& q) {
+            return hilbert_key(p, b) < hilbert_key(q, b);
+        }));
+        CHECK(serial.front() == Point(0, 0));
+        CHECK(serial.back() == Point(7, 0));
+
+        thread_pool pool(3);
+        auto parallel = points;
+        spatial_sort(parallel.begin(), parallel.end(), pool);
+        CHECK(parallel == serial);
+
+        spatial_sort(points.begin(), points.end(), pool, space_filling_curve::MORTON);
+        CHECK(std::is_sorted(points.begin(), points.end(), [&](const Point& p, const Point& q) {
+            return morton_key(p, b) < morton_key(q, b);
+        }));
+    }
+
+    SECTION("spatial sort of polygons")
+    {
+        std::vector<Polygon> polygons = {{{{10, 10}, {11, 10}, {11, 11}, {10, 10}}},
+                                         {},
+                                         {{{0, 0}, {1, 0}, {1, 1}, {0, 0}}},
+                                         {{{0, 10}, {1, 10}, {1, 11}, {0, 10}}}};
+        thread_pool pool(2);
+        spatial_sort(polygons.begin(), polygons.end(), pool);
+        REQUIRE(polygons.size() == 4);
+        CHECK(polygons[0].empty());
+        CHECK(polygons[1].bounds().minx == 0);
+        CHECK(polygons[1].bounds().miny == 0);
+        CHECK(polygons[2].bounds().miny == 10);
+        CHECK(polygons[3].bounds().minx == 10);
+    }
+}
@@ -0,0 +1,67 @@
+#include <ciso646>
+#include <algorithm>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("STRtree")
+{
+    SECTION("empty")
+    {
+        std::vector<bounds_t> boxes;
+        strtree tree(boxes.begin(), boxes.end());
+        CHECK(tree.empty());
+        CHECK(tree.size() == 0);
+        CHECK(tree.query(bounds_t{0, 0, 1, 1}).empty());
+    }
+
+    SECTION("single item")
+    {
+        std::vector<bounds_t> boxes{{0, 0, 1, 1}};
+        strtree tree(boxes.begin(), boxes.end());
+        CHECK(tree.size() == 1);
+        CHECK(tree.query(bounds_t{0.5, 0.5, 2, 2}) == std::vector<size_t>{0});
+        CHECK(tree.query(bounds_t{2, 2, 3, 3}).empty());
+    }
+
+    SECTION("query - matches brute force")
+    {
+        std::vector<bounds_t> boxes;
+        for (int i = 0; i < 50; ++i)
+        {
+            for (int j = 0; j < 40; ++j)
+            {
+                boxes.emplace_back(i, j, i + 0.5, j + 0.5);
+            }
+        }
+        strtree tree(boxes.begin(), boxes.end(), 4);
+        CHECK(tree.size() == boxes.size());
+        CHECK(tree.bounds().minx == 0);
+        CHECK(tree.bounds().maxx == 49.5);
+
+        std::vector<bounds_t> queries{{-1, -1, 0.2, 0.2}, {10.2, 3.7, 15.1, 9}, {48.6, 38.6, 48.9, 38.9}, {-10, -10, 100, 100}, {60, 60, 70, 70}};
+        for (const auto& q : queries)
+        {
+            auto res = tree.query(q);
+            std::sort(res.begin(), res.end());
+            std::vector<size_t> expected;
+            for (size_t k = 0; k < boxes.size(); ++k)
+            {
+                if (boxes[k].intersects(q))
+                {
+                    expected.push_back(k);
+                }
+            }
+            CHECK(res == expected);
+        }
+    }
+
+    SECTION("query - negative coordinates")
+    {
+        std::vector<bounds_t> boxes{{-10, -10, -5, -5}, {-4, -4, -1, -1}};
+        strtree tree(boxes.begin(), boxes.end());
+        CHECK(tree.query(bounds_t{-6, -6, -6, -6}) == std::vector<size_t>{0});
+        CHECK(tree.query(bounds_t{-2, -2, -2, -2}) == std::vector<size_t>{1});
+    }
+}
@@ -0,0 +1,70 @@
+#include <ciso646>
+#include <atomic>
+#include <stdexcept>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("ThreadPool")
+{
+    SECTION("size")
+    {
+        thread_pool pool(3);
+        CHECK(pool.size() == 3);
+        CHECK(thread_pool::default_concurrency() >= 1);
+    }
+
+    SECTION("submit")
+    {
+        thread_pool pool(2);
+        auto a = pool.submit([] { return 1 + 2; });
+        auto b = pool.submit([] { return std::string("shapes"); });
+        CHECK(a.get() == 3);
+        CHECK(b.get() == "shapes");
+    }
+
+    SECTION("submit - exception")
+    {
+        thread_pool pool(2);
+        auto f = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+        CHECK_THROWS_AS(f.get(), std::runtime_error);
+    }
+
+    SECTION("parallel_for")
+    {
+        thread_pool pool(4);
+        std::vector<int> values(1000, 0);
+        parallel_for(pool, 0, values.size(), 64, [&values](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++i)
+            {
+                values[i] = static_cast<int>(i);
+            }
+        });
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(values[i] == static_cast<int>(i));
+        }
+    }
+
+    SECTION("parallel_for - nested")
+    {
+        thread_pool pool(1);
+        CHECK_FALSE(pool.in_worker());
+        std::vector<int> values(100, 0);
+        auto f = pool.submit([&pool, &values] {
+            parallel_for(pool, 0, values.size(), 8, [&values](size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; ++i)
+                {
+                    values[i] = static_cast<int>(i);
+                }
+            });
+            return pool.in_worker();
+        });
+        CHECK(f.get());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(values[i] == static_cast<int>(i));
+        }
+    }
+}
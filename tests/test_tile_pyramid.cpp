@@ -0,0 +1,126 @@
+#include <ciso646>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+namespace
+{
+
+using tile_key = std::tuple<uint32_t, uint32_t, uint32_t>;
+
+template <typename Geometry>
+std::map<tile_key, std::string> pyramid(const std::vector<Geometry>& geoms, const pyramid_options& options,
+                                        size_t num_threads)
+{
+    std::map<tile_key, std::string> res;
+    std::mutex mutex;
+    thread_pool pool(num_threads);
+    generate_pyramid(geoms, options, pool, [&](const tile_id& tile, std::string&& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        res[std::make_tuple(tile.z, tile.x, tile.y)] = std::move(data);
+    });
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("TilePyramid")
+{
+    pyramid_options options;
+    options.bounds   = bounds_t{0, 0, 16, 16};
+    options.max_zoom = 3;
+
+    SECTION("a geometry covering the root is in every tile")
+    {
+        auto tiles = pyramid(std::vector<Polygon>{{{{-1, -1}, {17, -1}, {17, 17}, {-1, 17}, {-1, -1}}}}, options, 2);
+        CHECK(tiles.size() == 1 + 4 + 16 + 64);
+
+        auto layers = mvt::read_layers(tiles[std::make_tuple(3u, 5u, 2u)]);
+        REQUIRE(layers.size() == 1);
+        CHECK(layers[0].name() == "features");
+        REQUIRE(layers[0].size() == 1);
+        CHECK(layers[0][0].id() == 0);
+        MultiPolygon mp;
+        layers[0][0].polygons(mp, bounds_t{10, 10, 12, 12});
+        REQUIRE(mp.size() == 1);
+        // the tile with its buffer
+        auto b = mp.bounds();
+        CHECK(b.minx == Approx(10 - 2.0 * 64 / 4096));
+        CHECK(b.maxy == Approx(12 + 2.0 * 64 / 4096));
+    }
+
+    SECTION("a small geometry is only in the tiles it overlaps")
+    {
+        auto geoms = std::vector<LineString>{{{1, 1}, {1.5, 1.5}}, {{9, 9}, {15, 9}}};
+        auto tiles = pyramid(geoms, options, 2);
+        // root, z1 (0, 1), (1, 0), z2 (0, 3), (2, 1), (3, 1), z3 (0, 7), (4, 3) to (7, 3)
+        CHECK(tiles.size() == 1 + 2 + 3 + 5);
+        CHECK(tiles.count(std::make_tuple(3u, 0u, 7u)) == 1);
+        CHECK(tiles.count(std::make_tuple(3u, 3u, 3u)) == 0);
+
+        auto layers = mvt::read_layers(tiles[std::make_tuple(3u, 0u, 7u)]);
+        REQUIRE(layers[0].size() == 1);
+        CHECK(layers[0][0].id() == 0);
+        MultiLineString mls;
+        layers[0][0].linestrings(mls, bounds_t{0, 0, 2, 2});
+        CHECK(mls == MultiLineString{{{1, 1}, {1.5, 1.5}}});
+    }
+
+    SECTION("points and empty geometries")
+    {
+        auto geoms = std::vector<MultiPoint>{{{1, 1}, {15, 15}}, {}, {{100, 100}}};
+        auto tiles = pyramid(geoms, options, 1);
+        CHECK(tiles.size() == 1 + 2 + 2 + 2);
+        CHECK(mvt::read_layers(tiles[std::make_tuple(0u, 0u, 0u)])[0].size() == 1);
+    }
+
+    SECTION("the thread count does not change the tiles")
+    {
+        std::vector<Polygon> geoms;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            double x = static_cast<double>(i % 8) * 2;
+            double y = static_cast<double>(i / 8) * 2;
+            geoms.push_back(Polygon{{{x, y}, {x + 1.5, y}, {x + 1.5, y + 1.5}, {x, y + 1.5}, {x, y}}});
+        }
+        options.max_zoom = 5;
+        auto serial      = pyramid(geoms, options, 1);
+        CHECK(serial.size() > 64);
+        CHECK(pyramid(geoms, options, 4) == serial);
+    }
+
+    SECTION("called from a pool thread")
+    {
+        auto geoms = std::vector<LineString>{{{1, 1}, {1.5, 1.5}}, {{9, 9}, {15, 9}}};
+        thread_pool pool(1);
+        auto count = pool.submit([&] {
+            size_t res = 0;
+            generate_pyramid(geoms, options, pool, [&res](const tile_id&, std::string&&) { ++res; });
+            return res;
+        });
+        CHECK(count.get() == pyramid(geoms, options, 2).size());
+    }
+
+    SECTION("errors are rethrown")
+    {
+        thread_pool pool(3);
+        auto geoms = std::vector<Point>{{1, 1}, {9, 9}};
+        CHECK_THROWS_AS(generate_pyramid(geoms, options, pool,
+                                         [](const tile_id& tile, std::string&&) {
+                                             if (tile.z == 2)
+                                             {
+                                                 throw std::runtime_error("full");
+                                             }
+                                         }),
+                        std::runtime_error);
+
+        // the pool is still usable
+        CHECK(pool.submit([] { return 1; }).get() == 1);
+    }
+}
@@ -0,0 +1,131 @@
+#include <ciso646>
+#include <vector>
+#include <catch/catch.hpp>
+#include <simo/shapes.hpp>
+
+using namespace simo::shapes;
+
+TEST_CASE("View")
+{
+    SECTION("linestring view")
+    {
+        std::vector<double> coords = {1, 2, 3, 4, 5, 6};
+        LineStringView view(coords.data(), coords.size());
+        LineString ls(coords.begin(), coords.end());
+        CHECK(view.size() == 3);
+        CHECK(view.data() == reinterpret_cast<const Point*>(coords.data()));
+        CHECK(view[1] == Point(3, 4));
+        CHECK(view.back() == Point(5, 6));
+        CHECK(view == LineStringView(ls));
+        CHECK(view.geom_type() == geometry_type::LINESTRING);
+        CHECK(view.json() == ls.json());
+        CHECK(view.wkt() == ls.wkt());
+        CHECK(view.polyline() == ls.polyline());
+        CHECK(view.xy() == ls.xy());
+        CHECK(view.bounds().maxx == 5);
+        CHECK(view.is_valid());
+        CHECK(not view.is_closed());
+        CHECK(length(view) == Approx(length(ls)));
+        CHECK(centroid(view) == centroid(ls));
+
+        // the borrowed coordinates are not copied
+        coords[0] = 0;
+        CHECK(view[0] == Point(0, 2));
+
+        std::vector<double> xyzm = {1, 2, 3, 4, 5, 6, 7, 8};
+        LineStringViewZM zm(xyzm.data(), xyzm.size());
+        CHECK(zm.has_z());
+        CHECK(zm.has_m());
+        CHECK(zm.wkt() == LineStringZM({{1, 2, 3, 4}, {5, 6, 7, 8}}).wkt());
+
+        LineStringView empty;
+        CHECK(empty.empty());
+        CHECK(empty.wkt() == LineString().wkt());
+        CHECK_THROWS_AS(LineStringView(coords.data(), 5), exceptions::geometry_error);
+        CHECK_THROWS_AS(view.at(3), std::out_of_range);
+    }
+
+    SECTION("polygon view")
+    {
+        // a shell and a hole, the offsets are the ends of the rings
+        std::vector<double> coords  = {0, 0, 10, 0, 10, 10, 0, 10, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2};
+        std::vector<size_t> offsets = {10, 20};
+        PolygonView view(coords.data(), coords.size(), offsets.data(), offsets.size());
+        Polygon polygon(coords.begin(), coords.end(), offsets.begin(), offsets.end());
+        CHECK(view.size() == 2);
+        CHECK(view[1].size() == 5);
+        CHECK(view[1][2] == Point(4, 4));
+        CHECK(view.geom_type() == geometry_type::POLYGON);
+        CHECK(view.json() == polygon.json());
+        CHECK(view.wkt() == polygon.wkt());
+        CHECK(view.xy() == polygon.xy());
+        CHECK(view.bounds().maxy == 10);
+        CHECK(view.is_valid());
+        CHECK(view.is_closed());
+        CHECK(area(view) == Approx(96));
+        CHECK(perimeter(view) == Approx(48));
+        CHECK(centroid(view) == centroid(polygon));
+        CHECK(contains(view, Point(1, 1)));
+        CHECK(not contains(view, Point(3, 3)));
+        CHECK(distance(view, Point(20, 5)) == Approx(10));
+        CHECK(convex_hull(view).wkt() == convex_hull(polygon).wkt());
+
+        size_t points = 0;
+        for (const auto& ring : view)
+        {
+            points += ring.size();
+        }
+        CHECK(points == 10);
+
+        // the hole outside the shell
+        for (size_t i = 10; i < coords.size(); i += 2)
+        {
+            coords[i] += 20;
+        }
+        CHECK(view.validate().code == validity_code::HOLE_OUTSIDE_SHELL);
+
+        std::vector<size_t> decreasing = {10, 4};
+        CHECK_THROWS_AS(PolygonView(coords.data(), coords.size(), decreasing.data(), 2), exceptions::geometry_error);
+        std::vector<size_t> odd = {9};
+        CHECK_THROWS_AS(PolygonView(coords.data(), coords.size(), odd.data(), 1), exceptions::geometry_error);
+        // the second ring past the coordinates
+        CHECK_THROWS_AS(PolygonView(coords.data(), 18, offsets.data(), 2), exceptions::geometry_error);
+    }
+
+    SECTION("multipolygon view")
+    {
+        // two polygons, the second with a hole
+        std::vector<double> coords = {0, 0, 1, 0, 1, 1, 0, 0, 10, 10, 20, 10, 20, 20, 10, 20, 10, 10,
+                                      12, 12, 12, 14, 14, 14, 12, 12};
+        std::vector<size_t> ring_offsets    = {8, 18, 26};
+        std::vector<size_t> polygon_offsets = {1, 3};
+        MultiPolygonView view(coords.data(), coords.size(), ring_offsets.data(), ring_offsets.size(), polygon_offsets.data(),
+                              polygon_offsets.size());
+        CHECK(view.size() == 2);
+        CHECK(view[0].size() == 1);
+        CHECK(view[1].size() == 2);
+        CHECK(view[1][0][0] == Point(10, 10));
+        CHECK(view[1][1][1] == Point(12, 14));
+        CHECK(view.geom_type() == geometry_type::MULTIPOLYGON);
+
+        MultiPolygon mp = {{{{0, 0}, {1, 0}, {1, 1}, {0, 0}}},
+                           {{{10, 10}, {20, 10}, {20, 20}, {10, 20}, {10, 10}}, {{12, 12}, {12, 14}, {14, 14}, {12, 12}}}};
+        CHECK(view.json() == mp.json());
+        CHECK(view.wkt() == mp.wkt());
+        CHECK(view.bounds().minx == 0);
+        CHECK(view.bounds().maxx == 20);
+        CHECK(view.is_valid());
+        CHECK(area(view) == Approx(area(mp)));
+        CHECK(centroid(view) == centroid(mp));
+
+        // more rings than given
+        std::vector<size_t> too_many = {1, 4};
+        CHECK_THROWS_AS(MultiPolygonView(coords.data(), coords.size(), ring_offsets.data(), ring_offsets.size(),
+                                         too_many.data(), too_many.size()),
+                        exceptions::geometry_error);
+        // the last ring past the coordinates
+        CHECK_THROWS_AS(MultiPolygonView(coords.data(), 24, ring_offsets.data(), ring_offsets.size(),
+                                         polygon_offsets.data(), polygon_offsets.size()),
+                        exceptions::geometry_error);
+    }
+}